@@ -0,0 +1,115 @@
+"""
+host benchmark for the camera frame codecs (see frameCodec.py)
+
+usage: python3 codecBench.py [--baud 921600] [--quality 70]
+                             [--k210-ms MS | --slowdown 100] image.pgm ...
+
+for every 8-bit grayscale pgm image it reports the encoded size,
+the compression ratio, encode/decode time on this machine and the
+time needed to move the frame over the k210 uart link (framing
+overhead included). jpeg is measured only if pillow is installed.
+the 4-bit previews (gray4) are measured at half and quarter scale.
+
+rle is encoded in micropython on the k210, so it only beats raw if
+that takes less than the uart time it saves. the k210 prints its
+encode time in the capture log, pass it as --k210-ms. otherwise it
+is estimated as --slowdown times the encode time on this machine.
+"""
+
+import argparse, io, time
+from frameCodec import rleEncode, rleDecode, gray4Encode, gray4Decode, downscale
+
+# frame overhead per chunk (header + crc + offset), see uartHelper.h
+CHUNK_SIZE = 4096
+CHUNK_OVERHEAD = 9 + 4
+
+def readPgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos+1].isspace(): pos += 1
+        if data[pos:pos+1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end+1].isspace(): end += 1
+        fields.append(data[pos:end])
+        pos = end
+
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        raise ValueError(path + ": only 8-bit binary pgm is supported")
+
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, data[pos+1: pos+1 + width*height]
+
+def uartTimeMs(size, baud):
+    chunks = (size + CHUNK_SIZE - 1) // CHUNK_SIZE
+    return (size + chunks*CHUNK_OVERHEAD) * 10 * 1000 / baud
+
+def timed(fn, *args):
+    start = time.perf_counter()
+    result = fn(*args)
+    return result, (time.perf_counter() - start) * 1000
+
+def report(name, raw, size, encMs, decMs, baud):
+    print("  %-8s %7d bytes  ratio %5.2f  enc %7.1f ms  dec %7.1f ms  uart %6.1f ms"
+        % (name, size, raw / size, encMs, decMs, uartTimeMs(size, baud)))
+
+def rleVerdict(raw, size, encMs, args):
+    budget = uartTimeMs(raw, args.baud) - uartTimeMs(size, args.baud)
+    if args.k210_ms is not None: k210Ms, how = args.k210_ms, "measured"
+    else: k210Ms, how = encMs * args.slowdown, "estimated"
+    print("  rle saves %.1f ms of uart, k210 encode %.1f ms (%s): %s"
+        % (budget, k210Ms, how, "rle wins" if k210Ms < budget else "send raw"))
+
+def benchJpeg(width, height, pixels, quality, baud):
+    try: from PIL import Image
+    except ImportError:
+        print("  jpeg     skipped (pillow is not installed)")
+        return
+
+    img = Image.frombytes("L", (width, height), pixels)
+    def encode():
+        buf = io.BytesIO()
+        img.save(buf, "JPEG", quality=quality)
+        return buf.getvalue()
+
+    stream, encMs = timed(encode)
+    _, decMs = timed(lambda: Image.open(io.BytesIO(stream)).load())
+    report("jpeg", len(pixels), len(stream), encMs, decMs, baud)
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("images", nargs="+")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--quality", type=int, default=70)
+    parser.add_argument("--k210-ms", type=float)
+    parser.add_argument("--slowdown", type=float, default=100)
+    args = parser.parse_args()
+
+    for path in args.images:
+        width, height, pixels = readPgm(path)
+        print("%s (%dx%d)" % (path, width, height))
+
+        report("raw", len(pixels), len(pixels), 0, 0, args.baud)
+
+        stream, encMs = timed(rleEncode, pixels, width, height)
+        decoded, decMs = timed(rleDecode, stream)
+        if decoded != (width, height, bytearray(pixels)):
+            raise SystemExit(path + ": rle round trip failed")
+        report("rle", len(pixels), len(stream), encMs, decMs, args.baud)
+        rleVerdict(len(pixels), len(stream), encMs, args)
+
+        benchJpeg(width, height, pixels, args.quality, args.baud)
+
+        # previews are compared to the full frame they stand in for
+        for scale in (2, 4):
+            w, h, small = downscale(pixels, width, height, scale)
+            stream, encMs = timed(gray4Encode, small, w, h)
+            _, decMs = timed(gray4Decode, stream)
+            report("gray4/%d" % scale, len(pixels), len(stream), encMs, decMs, args.baud)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+import struct
+
+# ********************************************************************************************
+# lossless frame codec shared by the k210 script and the host tools
+#
+# stream: | width (u16 LE) | height (u16 LE) | rle(delta(pixels)) ... |
+#
+# delta: every pixel is replaced by its difference (mod 256) with the
+# pixel on its left; the first pixel of a row uses the pixel above it.
+# rle: a control byte c followed by either
+#   c < 0x80:  c+1 literal bytes
+#   c >= 0x80: one byte that is repeated c-0x80+2 times
+# ********************************************************************************************
+
+RLE_HEADER_SIZE = 4
+RLE_MAX_LITERAL = 128
+RLE_MAX_RUN = 129
+
+def deltaEncode(pixels, width, height):
+    out = bytearray(width*height)
+    for y in range(height):
+        base = y*width
+        prev = pixels[base - width] if y else 0
+        for x in range(width):
+            p = pixels[base + x]
+            out[base + x] = (p - prev) & 0xFF
+            prev = p
+    return out
+
+def deltaDecode(data, width, height):
+    out = bytearray(width*height)
+    for y in range(height):
+        base = y*width
+        prev = out[base - width] if y else 0
+        for x in range(width):
+            prev = (prev + data[base + x]) & 0xFF
+            out[base + x] = prev
+    return out
+
+def _flushLiterals(out, data, start, end):
+    while start < end:
+        n = min(end - start, RLE_MAX_LITERAL)
+        out.append(n - 1)
+        out.extend(data[start: start+n])
+        start += n
+
+def rleEncode(pixels, width, height):
+    data = deltaEncode(pixels, width, height)
+    out = bytearray(struct.pack("<HH", width, height))
+
+    n = len(data)
+    i = literal = 0
+    while i < n:
+        b = data[i]
+        run = 1
+        while i + run < n and run < RLE_MAX_RUN and data[i + run] == b:
+            run += 1
+
+        # a run of two doesn't pay for breaking a literal block
+        if run >= 3 or (run == 2 and literal == i):
+            _flushLiterals(out, data, literal, i)
+            out.append(0x80 + run - 2)
+            out.append(b)
+            i += run
+            literal = i
+        else:
+            i += 1
+
+    _flushLiterals(out, data, literal, n)
+    return out
+
+def rleDecode(stream):
+    width, height = struct.unpack_from("<HH", stream)
+    size = width*height
+    data = bytearray(size)
+
+    i, o = RLE_HEADER_SIZE, 0
+    while o < size:
+        c = stream[i]
+        if c < 0x80:
+            data[o: o+c+1] = stream[i+1: i+c+2]
+            o += c + 1
+            i += c + 2
+        else:
+            run = c - 0x80 + 2
+            data[o: o+run] = bytes((stream[i+1],))*run
+            o += run
+            i += 2
+
+    return width, height, deltaDecode(data, width, height)
+
+# ********************************************************************************************
+# 4-bit preview codec (thumbnails for slow links)
+#
+# stream: | width (u16 LE) | height (u16 LE) | packed pixels ... |
+#
+# the upper 4 bits of every pixel, two pixels per byte with the left
+# one in the high nibble. an odd row ends with a zero low nibble.
+# ********************************************************************************************
+
+GRAY4_HEADER_SIZE = 4
+
+def gray4Size(width, height):
+    return GRAY4_HEADER_SIZE + (width + 1) // 2 * height
+
+def downscale(pixels, width, height, scale):
+    """ averages scale x scale blocks (the k210 uses img.resize instead) """
+    outWidth, outHeight = width // scale, height // scale
+    out = bytearray(outWidth*outHeight)
+    area = scale*scale
+    for y in range(outHeight):
+        for x in range(outWidth):
+            total = 0
+            for row in range(y*scale, y*scale + scale):
+                base = row*width + x*scale
+                total += sum(pixels[base: base+scale])
+            out[y*outWidth + x] = total // area
+    return outWidth, outHeight, out
+
+def gray4Encode(pixels, width, height):
+    out = bytearray(gray4Size(width, height))
+    struct.pack_into("<HH", out, 0, width, height)
+
+    o = GRAY4_HEADER_SIZE
+    for y in range(height):
+        base = y*width
+        for x in range(base, base + width - 1, 2):
+            out[o] = (pixels[x] & 0xF0) | (pixels[x + 1] >> 4)
+            o += 1
+        if width & 1:
+            out[o] = pixels[base + width - 1] & 0xF0
+            o += 1
+    return out
+
+def gray4Decode(stream):
+    width, height = struct.unpack_from("<HH", stream)
+    pixels = bytearray(width*height)
+
+    i = GRAY4_HEADER_SIZE
+    for y in range(height):
+        for x in range(y*width, y*width + width, 2):
+            b = stream[i]
+            pixels[x] = (b >> 4) * 17
+            if x + 1 < y*width + width: pixels[x + 1] = (b & 0x0F) * 17
+            i += 1
+    return width, height, pixels
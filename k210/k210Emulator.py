@@ -0,0 +1,382 @@
+"""
+host emulator of the k210 side of the uart link (see microPython.py)
+
+opens a pseudo-terminal and answers the framed command set with
+frames taken from pgm images and canned meter readings, so that the
+esp32 protocol code can be exercised without the board
+(see tools/uartBench).
+
+usage: python3 k210Emulator.py [options]
+    --image f.pgm     frame(s) served by CAM_CAPTURE (8-bit binary pgm,
+                      a synthetic 320x240 frame is used by default)
+    --reading 01234   reading(s) served by AI_SEND (cycled)
+    --baud 921600     line speed that is emulated on the way out
+                      (LINK_SPEED changes it like on the board)
+    --latency-ms 0    delay before every response
+    --inference-ms 150  time spent in AI_READ (and per continuous inference)
+    --no-continuous   answer AI_SEND only with the result of AI_READ
+    --drop 0.0        probability of dropping an outgoing byte
+    --corrupt 0.0     probability of flipping a bit of an outgoing byte
+    --seed N          seed for the fault injection
+
+the path of the pty is printed on the first line of stdout.
+"""
+
+import argparse, os, random, select, struct, sys, time, tty, zlib
+from frameCodec import rleEncode, gray4Encode, downscale
+
+# ********************************************************************************************
+# link protocol (must match main/source/serial/uartHelper.h)
+
+FRAME_SOF = 0xA5
+FRAME_HEADER_SIZE = 5
+FRAME_CRC_SIZE = 4
+FRAME_MAX_PAYLOAD = 4100
+
+CMD_PING = 0x01
+CMD_LINK_SPEED = 0x02
+CMD_LINK_COMMIT = 0x03
+CMD_CAM_CAPTURE = 0x10
+CMD_CAM_CHUNK = 0x11
+CMD_CAM_ROI = 0x12
+CMD_AI_READ = 0x20
+CMD_AI_SEND = 0x21
+CMD_CONFIG = 0x30
+RSP_NACK = 0xFF
+
+ERR_CRC = 0x01
+ERR_UNKNOWN = 0x02
+ERR_ARGS = 0x03
+
+CODEC_RAW = 0x00
+CODEC_RLE = 0x01
+CODEC_JPEG = 0x02
+CODEC_GRAY4 = 0x03
+CAPTURE_SCALES = (1, 2, 4)
+
+ROI_WITH_CROPS = 0x01
+ROI_CROP_SIZE = 28
+
+FRAME_TIMEOUT_MS = 200
+
+LINK_RATES = (921600, 1500000, 2000000, 3000000)
+LINK_CONFIRM_MS = 1000
+
+# ********************************************************************************************
+
+def readPgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos+1].isspace(): pos += 1
+        if data[pos:pos+1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end+1].isspace(): end += 1
+        fields.append(data[pos:end])
+        pos = end
+
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        raise ValueError(path + ": only 8-bit binary pgm is supported")
+
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, bytes(data[pos+1: pos+1 + width*height])
+
+def syntheticFrame(width=320, height=240):
+    pixels = bytearray(width*height)
+    for y in range(height):
+        for x in range(width):
+            pixels[y*width + x] = 200 if (x//40 + y//40) % 2 else 30
+    return width, height, bytes(pixels)
+
+# ********************************************************************************************
+
+class Link:
+    """ master side of the pty with throttling and fault injection """
+
+    def __init__(self, args):
+        self.master, slave = os.openpty()
+        tty.setraw(slave)
+        self.slave = slave
+        self.path = os.ttyname(slave)
+        self.args = args
+        self.random = random.Random(args.seed)
+        self.dropped = self.corrupted = 0
+        self.baud = args.baud
+
+    def read(self):
+        ready, _, _ = select.select([self.master], [], [], 0.001)
+        return os.read(self.master, 4096) if ready else b""
+
+    def write(self, data):
+        out = bytearray()
+        for b in data:
+            if self.random.random() < self.args.drop:
+                self.dropped += 1
+                continue
+            if self.random.random() < self.args.corrupt:
+                b ^= 1 << self.random.randrange(8)
+                self.corrupted += 1
+            out.append(b)
+
+        # the line can't carry more than baud/10 bytes per second
+        start = time.monotonic()
+        os.write(self.master, out)
+        wire = len(data) * 10 / self.baud
+        spent = time.monotonic() - start
+        if wire > spent: time.sleep(wire - spent)
+
+# ********************************************************************************************
+
+class Emulator:
+
+    def __init__(self, args, link):
+        self.args = args
+        self.link = link
+        self.frames = [readPgm(p) for p in args.image] or [syntheticFrame()]
+        self.frameIndex = 0
+        self.readings = args.reading
+        self.readingIndex = 0
+        self.staged = b""
+        self.frame = self.frames[0]
+        self.digitCount = 0
+        self.invert = False
+        self.positions = []
+        self.lastRead = ""
+        self.frameCounter = 0
+        self.inferred = self.skipped = 0
+        self.lastStamp = 0
+        self.nextInference = 0
+        self.rxBuf = bytearray()
+        self.rxStamp = 0
+        self.linkPrevious = link.baud
+        self.linkDeadline = None
+        self.handlers = {
+            CMD_PING: self.ping,
+            CMD_LINK_SPEED: self.linkSpeed,
+            CMD_LINK_COMMIT: self.linkCommit,
+            CMD_CAM_CAPTURE: self.camCapture,
+            CMD_CAM_CHUNK: self.camChunk,
+            CMD_CAM_ROI: self.roiCapture,
+            CMD_AI_READ: self.aiRead,
+            CMD_AI_SEND: self.aiSend,
+            CMD_CONFIG: self.config,
+        }
+
+    # ****************************************************************************************
+
+    def sendFrame(self, ftype, seq, payload=b""):
+        header = struct.pack("<BBBH", FRAME_SOF, ftype, seq, len(payload))
+        crc = zlib.crc32(payload, zlib.crc32(header[1:]))
+        self.link.write(header + payload + struct.pack("<I", crc))
+
+    def respond(self, ftype, seq, payload=b""):
+        if self.args.latency_ms: time.sleep(self.args.latency_ms / 1000)
+        self.sendFrame(ftype | 0x80, seq, payload)
+
+    def nack(self, seq, error):
+        self.sendFrame(RSP_NACK, seq, bytes([error]))
+
+    def receiveFrames(self):
+        """ same framing rules as receiveFrames() in microPython.py """
+        frames = []
+        data = self.link.read()
+        if data:
+            self.rxBuf.extend(data)
+            self.rxStamp = time.monotonic()
+
+        while True:
+            start = self.rxBuf.find(bytes([FRAME_SOF]))
+            if start < 0: start = len(self.rxBuf)
+            if start > 0: del self.rxBuf[:start]
+
+            if len(self.rxBuf) < FRAME_HEADER_SIZE: break
+            _, ftype, seq, length = struct.unpack_from("<BBBH", self.rxBuf)
+            if length > FRAME_MAX_PAYLOAD:
+                del self.rxBuf[:1]
+                continue
+
+            frameSize = FRAME_HEADER_SIZE + length + FRAME_CRC_SIZE
+            if len(self.rxBuf) < frameSize: break
+
+            payload = bytes(self.rxBuf[FRAME_HEADER_SIZE: FRAME_HEADER_SIZE+length])
+            crc = struct.unpack_from("<I", self.rxBuf, frameSize-FRAME_CRC_SIZE)[0]
+            if crc == zlib.crc32(payload, zlib.crc32(self.rxBuf[1:FRAME_HEADER_SIZE])):
+                frames.append((ftype, seq, payload))
+            else:
+                self.nack(seq, ERR_CRC)
+            del self.rxBuf[:frameSize]
+
+        if self.rxBuf and time.monotonic() - self.rxStamp > FRAME_TIMEOUT_MS / 1000:
+            self.rxBuf = bytearray()
+
+        return frames
+
+    def run(self):
+        while True:
+            for ftype, seq, payload in self.receiveFrames():
+                handler = self.handlers.get(ftype)
+                if handler: handler(seq, payload)
+                else: self.nack(seq, ERR_UNKNOWN)
+
+            if self.linkDeadline and time.monotonic() > self.linkDeadline:
+                self.link.baud = self.linkPrevious
+                self.linkDeadline = None
+
+            # the board infers between commands, here it just takes as long
+            if self.args.continuous and self.digitCount and \
+                time.monotonic() >= self.nextInference:
+                self.infer()
+                self.nextInference = time.monotonic() + self.args.inference_ms / 1000
+
+    # ****************************************************************************************
+
+    def ping(self, seq, payload):
+        self.respond(CMD_PING, seq, payload)
+
+    def linkSpeed(self, seq, payload):
+        """ a pty has no line speed, only the throttling follows the rate """
+        try: baud, = struct.unpack("<I", payload)
+        except struct.error: return self.nack(seq, ERR_ARGS)
+        if baud not in LINK_RATES: return self.nack(seq, ERR_ARGS)
+
+        self.respond(CMD_LINK_SPEED, seq)
+        if self.linkDeadline is None: self.linkPrevious = self.link.baud
+        self.link.baud = baud
+        self.linkDeadline = time.monotonic() + LINK_CONFIRM_MS / 1000
+
+    def linkCommit(self, seq, payload):
+        self.linkDeadline = None
+        self.respond(CMD_LINK_COMMIT, seq)
+
+    def nextFrame(self):
+        self.frame = self.frames[self.frameIndex % len(self.frames)]
+        self.frameIndex += 1
+        return self.frame
+
+    def camCapture(self, seq, payload):
+        codec, quality, scale = CODEC_RAW, 70, 1
+        if len(payload) == 2: codec, quality = struct.unpack("<BB", payload)
+        elif len(payload) == 3: codec, quality, scale = struct.unpack("<BBB", payload)
+        elif payload: return self.nack(seq, ERR_ARGS)
+        if scale not in CAPTURE_SCALES: return self.nack(seq, ERR_ARGS)
+
+        width, height, pixels = self.nextFrame()
+        if scale > 1: width, height, pixels = downscale(pixels, width, height, scale)
+
+        if codec == CODEC_RAW: self.staged = bytes(pixels)
+        elif codec == CODEC_RLE: self.staged = bytes(rleEncode(pixels, width, height))
+        elif codec == CODEC_GRAY4: self.staged = bytes(gray4Encode(pixels, width, height))
+        else: return self.nack(seq, ERR_ARGS)
+
+        self.respond(CMD_CAM_CAPTURE, seq,
+            struct.pack("<HHIB", width, height, len(self.staged), codec))
+
+    def camChunk(self, seq, payload):
+        try: offset, size = struct.unpack("<IH", payload)
+        except struct.error: return self.nack(seq, ERR_ARGS)
+
+        if len(self.staged) <= offset: return self.nack(seq, ERR_ARGS)
+        chunk = self.staged[offset: offset+size]
+        self.respond(CMD_CAM_CHUNK, seq, struct.pack("<I", offset) + chunk)
+
+    def roiCapture(self, seq, payload):
+        if len(payload) != 1 or not self.digitCount:
+            return self.nack(seq, ERR_ARGS)
+        flags = payload[0]
+
+        width, height, pixels = self.nextFrame()
+        rects = []
+        for x, y, w, h in self.positions:
+            x, y = min(max(x, 0), width), min(max(y, 0), height)
+            rects.append((x, y, max(min(w, width - x), 0), max(min(h, height - y), 0)))
+
+        packed = bytearray(struct.pack("<BBHH", self.digitCount, flags, width, height))
+        for rect in rects: packed += struct.pack("<HHHH", *rect)
+        for x, y, w, h in rects:
+            for row in range(y, y + h):
+                packed += pixels[row*width + x: row*width + x + w]
+
+        # nearest neighbour and a fixed threshold stand in for getSubImg()
+        if flags & ROI_WITH_CROPS:
+            for x, y, w, h in rects:
+                for cy in range(ROI_CROP_SIZE):
+                    for cx in range(ROI_CROP_SIZE):
+                        p = pixels[(y + cy*h//ROI_CROP_SIZE)*width + x + cx*w//ROI_CROP_SIZE] \
+                            if w and h else 0
+                        packed.append(255 if (p < 128) == self.invert else 0)
+
+        self.staged = bytes(packed)
+        self.respond(CMD_CAM_ROI, seq, struct.pack("<I", len(self.staged)))
+
+    # ****************************************************************************************
+
+    def aiRead(self, seq, payload):
+        time.sleep(self.args.inference_ms / 1000)
+        self.infer()
+        self.respond(CMD_AI_READ, seq)
+
+    def infer(self):
+        reading = self.readings[self.readingIndex % len(self.readings)]
+        self.readingIndex += 1
+        previous = self.lastRead
+        self.lastRead = reading[-self.digitCount:].rjust(self.digitCount, "0") \
+            if self.digitCount else ""
+
+        # the change detector keeps the digits that stayed the same
+        for i, digit in enumerate(self.lastRead):
+            if i < len(previous) and previous[i] == digit: self.skipped += 1
+            else: self.inferred += 1
+        self.frameCounter += 1
+        self.lastStamp = time.monotonic()
+
+    def aiSend(self, seq, payload):
+        age = 0
+        if self.frameCounter:
+            age = min(int((time.monotonic() - self.lastStamp) * 1000), 0xFFFF)
+        self.respond(CMD_AI_SEND, seq, struct.pack("<IHHII",
+            self.frameCounter, 950, age, self.inferred, self.skipped)
+            + self.lastRead.encode())
+
+    def config(self, seq, payload):
+        try:
+            digitCount, invert = struct.unpack_from("<BB", payload)
+            if len(payload) != 2 + digitCount*8: raise ValueError()
+            positions = [struct.unpack_from("<HHHH", payload, 2 + i*8)
+                for i in range(digitCount)]
+        except (struct.error, ValueError): return self.nack(seq, ERR_ARGS)
+
+        self.digitCount = digitCount
+        self.invert = bool(invert)
+        self.positions = positions # grouped by meter, see configHandler
+        self.lastRead = ""
+        self.respond(CMD_CONFIG, seq)
+
+# ********************************************************************************************
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--image", action="append", default=[])
+    parser.add_argument("--reading", action="append", default=None)
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--latency-ms", type=float, default=0)
+    parser.add_argument("--inference-ms", type=float, default=150)
+    parser.add_argument("--no-continuous", dest="continuous", action="store_false")
+    parser.add_argument("--drop", type=float, default=0.0)
+    parser.add_argument("--corrupt", type=float, default=0.0)
+    parser.add_argument("--seed", type=int, default=None)
+    args = parser.parse_args()
+    args.reading = args.reading or ["0123456789"]
+
+    link = Link(args)
+    print(link.path, flush=True)
+
+    try: Emulator(args, link).run()
+    except KeyboardInterrupt:
+        print("dropped", link.dropped, "corrupted", link.corrupted, file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
@@ -1,10 +1,15 @@
-import Maix, gc, time
+import Maix, gc, time, struct
 from fpioa_manager import fm
 from machine import UART
 # from board import board_info
 import sensor, image
 import KPU as kpu
 
+# frameCodec.py must be copied next to this script to support
+# CODEC_RLE and CODEC_GRAY4
+try: from frameCodec import rleEncode, gray4Encode
+except ImportError: rleEncode = gray4Encode = None
+
 # ********************************************************************************************
 
 class Position:
@@ -20,6 +25,110 @@ class AiConfig:
         self.invert = False
         self.positions = None
 
+class AiResult:
+    def __init__(self, frame=0, confidence=0, number="", stamp=0,
+        probabilities=b""):
+        self.frame = frame           # inference counter (0 = none yet)
+        self.confidence = confidence # per mille
+        self.number = number
+        self.probabilities = probabilities # one byte per digit, 255 = 1
+        self.stamp = stamp           # ticks_ms when it was finished
+
+class DigitCache:
+    """ the last prediction of a digit and the window it was made on """
+    def __init__(self, signature, digit, probability):
+        self.signature = signature
+        self.digit = digit
+        self.probability = probability
+        self.skips = 0
+
+class InferenceJob:
+    """ a continuous inference in progress (one digit per step) """
+    def __init__(self, parentImg):
+        self.parentImg = parentImg
+        self.digit = 0
+        self.number = ""
+        self.probability = 1
+        self.probabilities = bytearray()
+
+
+# ********************************************************************************************
+# link protocol (must match source/serial/uartHelper.h on the esp32 side)
+#
+# | SOF | type | seq | length (LE) | payload ... | crc32 (LE) |
+# |  1  |  1   |  1  |      2      |   length    |     4      |
+
+FRAME_SOF = 0xA5
+FRAME_HEADER_SIZE = 5
+FRAME_CRC_SIZE = 4
+FRAME_MAX_PAYLOAD = 4100
+
+CMD_PING = 0x01
+CMD_LINK_SPEED = 0x02
+CMD_LINK_COMMIT = 0x03
+CMD_CAM_CAPTURE = 0x10
+CMD_CAM_CHUNK = 0x11
+CMD_CAM_ROI = 0x12
+CMD_AI_READ = 0x20
+CMD_AI_SEND = 0x21
+CMD_AI_REREAD = 0x22
+CMD_CONFIG = 0x30
+RSP_NACK = 0xFF
+
+ERR_CRC = 0x01
+ERR_UNKNOWN = 0x02
+ERR_ARGS = 0x03
+
+CODEC_RAW = 0x00
+CODEC_RLE = 0x01
+CODEC_JPEG = 0x02
+CODEC_GRAY4 = 0x03
+
+# the frame can be downscaled by these factors before it is encoded
+CAPTURE_SCALES = (1, 2, 4)
+
+ROI_WITH_CROPS = 0x01
+
+# partial frames older than this are dropped
+FRAME_TIMEOUT_MS = 200
+
+# link speed negotiation (see source/serial/linkSpeed.h on the esp32 side)
+BASE_BAUD_RATE = 921600
+LINK_RATES = (BASE_BAUD_RATE, 1500000, 2000000, 3000000)
+LINK_CONFIRM_MS = 1000  # an uncommitted rate is dropped after this long
+LINK_ERROR_BURST = 4    # corrupted frames in a row that reset the link
+
+# infer in the main loop between commands, so that CMD_AI_SEND is
+# answered right away with the latest result (CMD_AI_READ still works)
+CONTINUOUS_INFERENCE = True
+
+# a digit goes through the model only when its window changed since
+# its last inference: the window is downsampled to CHANGE_GRID squared
+# pixels and the mean absolute difference (brightness removed) must
+# exceed CHANGE_THRESHOLD gray levels. CHANGE_REFRESH skips in a row
+# force an inference anyway.
+CHANGE_GRID = 8
+CHANGE_THRESHOLD = 6
+CHANGE_REFRESH = 100
+
+try:
+    from ubinascii import crc32
+except ImportError:
+    crc32 = None
+
+if crc32 is None:
+    _crcTable = []
+    for n in range(256):
+        c = n
+        for k in range(8):
+            c = (0xEDB88320 ^ (c >> 1)) if c & 1 else (c >> 1)
+        _crcTable.append(c)
+
+    def crc32(data, crc=0):
+        crc ^= 0xFFFFFFFF
+        for b in data:
+            crc = _crcTable[(crc ^ b) & 0xFF] ^ (crc >> 8)
+        return crc ^ 0xFFFFFFFF
 
 def printMem(msg = ""):
     print("\n$ mem report", msg)
@@ -47,7 +156,7 @@ print("image size:", arr_size)
 fm.register(21, fm.fpioa.UART1_TX, force=True)
 fm.register(22, fm.fpioa.UART1_RX, force=True)
 uartHandle = UART(
-    UART.UART1, 921600, 8, 0, 0, timeout=1000, read_buf_len=4096)
+    UART.UART1, BASE_BAUD_RATE, 8, 0, 0, timeout=1000, read_buf_len=4096)
 time.sleep_ms(100) # wait till uart is ready
 
 print("loading kmodel")
@@ -101,130 +210,460 @@ def getSubImg(index, parentImg):
 
     return subImg.resize(28, 28)
 
+def runModel(index, parentImg):
+    subImg = getSubImg(index, parentImg)
+    subImg.pix_to_ai()
+    fmap = kpu.forward(task, subImg)
+    plist = fmap[:]
+    pmax = max(plist)
+    return plist.index(pmax), pmax
+
+# ********************************************************************************************
+
+digitCache = []
+inferredCount = 0
+skippedCount = 0
+
+def windowSignature(index, parentImg):
+    """ downsampled window pixels and their mean """
+    pos = aiConfig.positions[index]
+    window = parentImg.copy(roi=(pos.x, pos.y, pos.width, pos.height))
+    pixels = bytes(window.resize(CHANGE_GRID, CHANGE_GRID))
+    return pixels, sum(pixels) // len(pixels)
+
+def windowChanged(old, new):
+    oldPixels, oldMean = old
+    newPixels, newMean = new
+    offset = newMean - oldMean
+    sad = 0
+    for i in range(len(newPixels)):
+        sad += abs(newPixels[i] - oldPixels[i] - offset)
+    return sad > CHANGE_THRESHOLD * len(newPixels)
+
+def inferDigit(index, parentImg):
+    """ runs the model on a digit unless its window is unchanged """
+    global inferredCount, skippedCount
+
+    signature = windowSignature(index, parentImg)
+    cached = digitCache[index] if index < len(digitCache) else None
+    if cached and cached.skips < CHANGE_REFRESH and \
+        not windowChanged(cached.signature, signature):
+        cached.skips += 1
+        skippedCount += 1
+        return cached.digit, cached.probability
+
+    digit, pmax = runModel(index, parentImg)
+    inferredCount += 1
+    while len(digitCache) <= index: digitCache.append(None)
+    digitCache[index] = DigitCache(signature, digit, pmax)
+    return digit, pmax
+
 def aiProcess():
     print("performing neural net inference")
     parentImg = sensor.snapshot()
     parentImg.to_grayscale(0)
     number = ""
     probability = 1
+    probabilities = bytearray()
 
     for digit in range(aiConfig.digitCount):
-        subImg = getSubImg(digit, parentImg)
-        subImg.pix_to_ai()
-        fmap = kpu.forward(task, subImg)
-        plist = fmap[:]
-        pmax = max(plist)
-        max_index = plist.index(pmax)
+        max_index, pmax = inferDigit(digit, parentImg)
         number += str(max_index)
         probability *= pmax
+        probabilities.append(probabilityByte(pmax))
 
-    print("infered", number, "with probability", pmax)
-    return number
+    print("infered", number, "with probability", probability)
+    print("digits inferred:", inferredCount, "skipped:", skippedCount)
+    publishResult(number, probability, probabilities)
 
 # ********************************************************************************************
 
-lastPoint = 0
+# the finished result is swapped in as a whole (the job being filled is
+# the second buffer), so a command never sees a half-updated result
+latestResult = AiResult()
+frameCounter = 0
+inferenceJob = None
+
+def probabilityByte(p):
+    return min(max(int(p * 255 + 0.5), 0), 255)
+
+def publishResult(number, probability, probabilities):
+    global latestResult, frameCounter
+    frameCounter += 1
+    latestResult = AiResult(frameCounter, int(probability * 1000),
+        number, time.ticks_ms(), bytes(probabilities))
+
+def resetInference(clearResult=False):
+    """ the job's snapshot is overwritten by other captures """
+    global inferenceJob, latestResult, digitCache
+    inferenceJob = None
+    if clearResult:
+        latestResult = AiResult(frameCounter)
+        digitCache = []
+
+def inferenceStep():
+    """
+    one step of the continuous inference: a snapshot or a single digit,
+    so a command never waits for more than one kpu.forward
+    """
+    global inferenceJob
+    if not aiConfig.digitCount: return False
+
+    if inferenceJob is None:
+        parentImg = sensor.snapshot()
+        parentImg.to_grayscale(0)
+        inferenceJob = InferenceJob(parentImg)
+        return True
+
+    job = inferenceJob
+    max_index, pmax = inferDigit(job.digit, job.parentImg)
+    job.number += str(max_index)
+    job.probability *= pmax
+    job.probabilities.append(probabilityByte(pmax))
+    job.digit += 1
+
+    if job.digit == aiConfig.digitCount:
+        publishResult(job.number, job.probability, job.probabilities)
+        inferenceJob = None
+        gc.collect()
+    return True
 
-def camTransmitter(args):
+# ********************************************************************************************
+
+def sendFrame(ftype, seq, payload=b""):
+    header = struct.pack("<BBBH", FRAME_SOF, ftype, seq, len(payload))
+    crc = crc32(payload, crc32(header[1:])) & 0xFFFFFFFF
+    uartHandle.write(header)
+    if payload: uartHandle.write(payload)
+    uartHandle.write(struct.pack("<I", crc))
+
+def sendResponse(ftype, seq, payload=b""):
+    sendFrame(ftype | 0x80, seq, payload)
+
+def sendNack(seq, error):
+    sendFrame(RSP_NACK, seq, bytes([error]))
 
-    try: sendSize = int(args[1])
-    except: return False
+# ********************************************************************************************
 
-    global lastPoint
-    tmpIndx = lastPoint
+rxBuf = bytearray()
+rxStamp = 0
+
+# current rate, the rate to go back to and when (None once committed)
+linkBaud = BASE_BAUD_RATE
+linkPrevious = BASE_BAUD_RATE
+linkDeadline = None
+linkErrors = 0
+
+def setBaud(baud):
+    global rxBuf, linkBaud
+    uartHandle.init(baud, 8, 0, 0, timeout=1000, read_buf_len=4096)
+    rxBuf = bytearray()
+    linkBaud = baud
+
+def linkError():
+    """
+    a burst of garbage usually means the two ends disagree on
+    the rate, the base rate is where the esp32 looks for us
+    """
+    global linkErrors, linkDeadline
+    linkErrors += 1
+    if linkErrors >= LINK_ERROR_BURST and linkBaud != BASE_BAUD_RATE:
+        print("too many link errors, back to", BASE_BAUD_RATE)
+        linkDeadline = None
+        linkErrors = 0
+        setBaud(BASE_BAUD_RATE)
+
+def checkLink():
+    global linkDeadline
+    if linkDeadline is not None and time.ticks_diff(linkDeadline, time.ticks_ms()) <= 0:
+        print("rate", linkBaud, "not confirmed, back to", linkPrevious)
+        linkDeadline = None
+        setBaud(linkPrevious)
+
+def receiveFrames():
+    """
+    appends the available uart bytes to rxBuf and
+    returns the list of complete and valid frames as (type, seq, payload)
+    """
+    global rxBuf, rxStamp, linkErrors
+    frames = []
 
-    if args[0] == "camStart":
-        tmpIndx = 0
-        if arr_size <= sendSize:
-            uartHandle.write(arr)
-            lastPoint = arr_size
+    if uartHandle.any():
+        rxBuf.extend(uartHandle.read())
+        rxStamp = time.ticks_ms()
+
+    while True:
+        # skip stray bytes in front of the start of frame
+        start = 0
+        while start < len(rxBuf) and rxBuf[start] != FRAME_SOF:
+            start += 1
+        if start > 0:
+            rxBuf = rxBuf[start:]
+            linkError()
+
+        if len(rxBuf) < FRAME_HEADER_SIZE: break
+        sof, ftype, seq, length = struct.unpack_from("<BBBH", rxBuf)
+        if length > FRAME_MAX_PAYLOAD:
+            rxBuf = rxBuf[1:]
+            continue
+
+        frameSize = FRAME_HEADER_SIZE + length + FRAME_CRC_SIZE
+        if len(rxBuf) < frameSize: break
+
+        payload = bytes(rxBuf[FRAME_HEADER_SIZE: FRAME_HEADER_SIZE+length])
+        crc = struct.unpack_from("<I", rxBuf, frameSize-FRAME_CRC_SIZE)[0]
+        if crc == crc32(payload, crc32(rxBuf[1:FRAME_HEADER_SIZE])) & 0xFFFFFFFF:
+            frames.append((ftype, seq, payload))
+            linkErrors = 0
         else:
-            uartHandle.write(arr[:sendSize])
-            lastPoint = sendSize
+            print("frame crc mismatch")
+            sendNack(seq, ERR_CRC)
+            linkError()
+        rxBuf = rxBuf[frameSize:]
 
+    # give up on a partial frame that stopped arriving
+    if rxBuf and time.ticks_diff(time.ticks_ms(), rxStamp) > FRAME_TIMEOUT_MS:
+        print("dropping", len(rxBuf), "stale bytes")
+        rxBuf = bytearray()
+        linkError()
 
-    elif args[0] == "camNext":
-        if lastPoint+sendSize < arr_size:
-            uartHandle.write(arr[lastPoint: lastPoint+sendSize])
-            lastPoint += sendSize
+    return frames
 
-        elif lastPoint < arr_size:
-            uartHandle.write(arr[lastPoint:])
-            lastPoint = arr_size
+# ********************************************************************************************
 
-    else: return False
+def camCapture(seq, payload):
+    global img, arr, arr_size
+
+    # args: codec (1), jpeg quality (1), optionally scale (1)
+    codec, quality, scale = CODEC_RAW, 70, 1
+    if len(payload) == 2: codec, quality = struct.unpack("<BB", payload)
+    elif len(payload) == 3: codec, quality, scale = struct.unpack("<BBB", payload)
+    elif len(payload) != 0: return sendNack(seq, ERR_ARGS)
+
+    if codec in (CODEC_RLE, CODEC_GRAY4) and rleEncode is None:
+        return sendNack(seq, ERR_ARGS)
+    if codec not in (CODEC_RAW, CODEC_RLE, CODEC_JPEG, CODEC_GRAY4) or \
+        not 1 <= quality <= 100 or scale not in CAPTURE_SCALES:
+        return sendNack(seq, ERR_ARGS)
+
+    arr = None
+    resetInference()
+    gc.collect()
+    img = sensor.snapshot()
+    img.to_grayscale(0)
+    if scale > 1: img = img.resize(img.width() // scale, img.height() // scale)
+
+    # jpeg is done by the hardware encoder, rle and gray4 run in python.
+    # rle is only worth it for mostly flat scenes, gray4 is for previews
+    start = time.ticks_ms()
+    if codec == CODEC_JPEG: arr = bytes(img.compress(quality=quality))
+    elif codec == CODEC_RLE: arr = bytes(rleEncode(bytes(img), img.width(), img.height()))
+    elif codec == CODEC_GRAY4: arr = bytes(gray4Encode(bytes(img), img.width(), img.height()))
+    else: arr = bytes(img)
+
+    # the encode time is what codecBench.py compares with the uart time
+    arr_size = len(arr)
+    print("captured %dx%d codec %d: %d bytes, encoded in %d ms" % (img.width(),
+        img.height(), codec, arr_size, time.ticks_diff(time.ticks_ms(), start)))
+    gc.collect()
+    sendResponse(CMD_CAM_CAPTURE, seq, struct.pack("<HHIB",
+        img.width(), img.height(), arr_size, codec))
+
+def camTransmitter(seq, payload):
+    try: offset, sendSize = struct.unpack("<IH", payload)
+    except: return sendNack(seq, ERR_ARGS)
+
+    if arr_size <= offset: return sendNack(seq, ERR_ARGS)
+    chunk = arr[offset: offset+sendSize]
+
+    print("Sending", len(chunk), "bytes from", offset)
+    sendResponse(CMD_CAM_CHUNK, seq, struct.pack("<I", offset) + chunk)
+
+def roiCapture(seq, payload):
+    """
+    packs the configured digit windows (and optionally the crops fed
+    to the model) of a new snapshot, the result is fetched with
+    CMD_CAM_CHUNK like a camera image:
+    digitCount, flags, frame size, clipped rects, window pixels, crops
+    """
+    global img, arr, arr_size
+
+    if len(payload) != 1 or not aiConfig.digitCount:
+        return sendNack(seq, ERR_ARGS)
+    flags = payload[0]
+
+    arr = None
+    resetInference()
+    gc.collect()
+    img = sensor.snapshot()
+    img.to_grayscale(0)
+    width, height = img.width(), img.height()
+
+    rects = []
+    for pos in aiConfig.positions:
+        x, y = min(max(pos.x, 0), width), min(max(pos.y, 0), height)
+        w, h = min(pos.width, width - x), min(pos.height, height - y)
+        rects.append((x, y, max(w, 0), max(h, 0)))
+
+    packed = bytearray(struct.pack("<BBHH",
+        aiConfig.digitCount, flags, width, height))
+    for rect in rects: packed.extend(struct.pack("<HHHH", *rect))
+
+    for x, y, w, h in rects:
+        if w and h: packed.extend(bytes(img.copy(roi=(x, y, w, h))))
+
+    if flags & ROI_WITH_CROPS:
+        for digit in range(aiConfig.digitCount):
+            packed.extend(bytes(getSubImg(digit, img)))
 
-    print("Sending", lastPoint-tmpIndx, "bytes")    
-    return True
+    arr = bytes(packed)
+    arr_size = len(arr)
+    del packed
+    gc.collect()
+    sendResponse(CMD_CAM_ROI, seq, struct.pack("<I", arr_size))
 
 # ********************************************************************************************
 
-def configHandler(args):
+def configHandler(seq, payload):
 
     global aiConfig
 
-    if not args[0] == "config": return False
-
     try:
-        aiConfig.digitCount = int(args[1])
-        print("digitCount:", aiConfig.digitCount)
-        aiConfig.invert = bool(int(args[2]))
-        print("invert:", aiConfig.invert)
+        digitCount, invert = struct.unpack_from("<BB", payload)
+        if len(payload) != 2 + digitCount*8: raise ValueError()
 
-        aiConfig.positions = [None]*aiConfig.digitCount
-        for digit in range(aiConfig.digitCount):
-            index = digit*4 + 3
-            x = int(args[index])
-            y = int(args[index+1])
-            w = int(args[index+2])
-            h = int(args[index+3])
-            aiConfig.positions[digit] = Position(x, y, w, h)
+        positions = [None]*digitCount
+        for digit in range(digitCount):
+            x, y, w, h = struct.unpack_from("<HHHH", payload, 2 + digit*8)
+            positions[digit] = Position(x, y, w, h)
             print("Position", digit, ":", x, y, w, h)
 
-    except: return False
-    uartHandle.write("recieved")
+    except: return sendNack(seq, ERR_ARGS)
 
-    aiConfig.positions.sort(
-        key = lambda tmp: tmp.x,
-        reverse = False
-    )
+    aiConfig.digitCount = digitCount
+    print("digitCount:", aiConfig.digitCount)
+    aiConfig.invert = bool(invert)
+    print("invert:", aiConfig.invert)
+    # the positions of several meters come one meter after the other,
+    # each one already sorted from left to right by the esp32
+    aiConfig.positions = positions
 
-    return True
+    # the latest result belongs to the old layout
+    resetInference(clearResult=True)
+
+    sendResponse(CMD_CONFIG, seq)
+
+# ********************************************************************************************
+
+def aiReadHandler(seq, payload):
+    resetInference()
+    aiProcess()
+    gc.collect()
+    sendResponse(CMD_AI_READ, seq)
+
+def aiSendHandler(seq, payload):
+    """
+    frame (u32), confidence (u16), age in ms (u16),
+    inferred digits (u32), skipped digits (u32), digits,
+    probability of each digit (u8, 255 = 1)
+    """
+    result = latestResult
+    age = 0
+    if result.frame:
+        age = min(time.ticks_diff(time.ticks_ms(), result.stamp), 0xFFFF)
+
+    print("sending", result.number, "from frame", result.frame)
+    sendResponse(CMD_AI_SEND, seq, struct.pack("<IHHII",
+        result.frame, result.confidence, age, inferredCount, skippedCount)
+        + result.number.encode() + result.probabilities)
+
+def aiRereadHandler(seq, payload):
+    """
+    infers the digits listed in the payload (one index byte each) again
+    on a new snapshot, without the change detector: the esp32 asks for
+    this when a digit came out with a low probability.
+    responds with the digit (ascii) and its probability (u8) per index
+    """
+    if not payload or max(payload) >= aiConfig.digitCount:
+        return sendNack(seq, ERR_ARGS)
+
+    global inferredCount
+    resetInference()
+    parentImg = sensor.snapshot()
+    parentImg.to_grayscale(0)
+
+    response = bytearray()
+    for index in payload:
+        digit, pmax = runModel(index, parentImg)
+        inferredCount += 1
+        response.append(ord("0") + digit)
+        response.append(probabilityByte(pmax))
+
+    print("re-read", len(payload), "digits")
+    gc.collect()
+    sendResponse(CMD_AI_REREAD, seq, response)
+
+def pingHandler(seq, payload):
+    sendResponse(CMD_PING, seq, payload)
+
+def linkSpeedHandler(seq, payload):
+    """
+    answers at the current rate and then switches, the new rate
+    is kept only if CMD_LINK_COMMIT arrives within LINK_CONFIRM_MS
+    """
+    global linkPrevious, linkDeadline
+    try: baud, = struct.unpack("<I", payload)
+    except: return sendNack(seq, ERR_ARGS)
+    if baud not in LINK_RATES: return sendNack(seq, ERR_ARGS)
+
+    sendResponse(CMD_LINK_SPEED, seq)
+    time.sleep_ms(5) # let the response leave the fifo
+
+    # a pending rate was never confirmed, go back from the old one
+    if linkDeadline is None: linkPrevious = linkBaud
+    print("switching to", baud)
+    setBaud(baud)
+    linkDeadline = time.ticks_add(time.ticks_ms(), LINK_CONFIRM_MS)
+
+def linkCommitHandler(seq, payload):
+    global linkDeadline
+    linkDeadline = None
+    sendResponse(CMD_LINK_COMMIT, seq)
+
+handlers = {
+    CMD_PING: pingHandler,
+    CMD_LINK_SPEED: linkSpeedHandler,
+    CMD_LINK_COMMIT: linkCommitHandler,
+    CMD_CAM_CAPTURE: camCapture,
+    CMD_CAM_CHUNK: camTransmitter,
+    CMD_CAM_ROI: roiCapture,
+    CMD_AI_READ: aiReadHandler,
+    CMD_AI_SEND: aiSendHandler,
+    CMD_AI_REREAD: aiRereadHandler,
+    CMD_CONFIG: configHandler,
+}
 
 # ********************************************************************************************
 
 print("-"*50)
-last_read = ""
 
 while True:
-    if uartHandle.any():
-        read_data = uartHandle.read()
-        input_str = read_data.decode()
-        inputs = input_str.split(':')
-        print("\nCommand:", inputs[0])
+    frames = receiveFrames()
+    for ftype, seq, payload in frames:
+        print("\nCommand:", hex(ftype), "seq:", seq)
         clock.tick()
 
-        if(inputs[0] == "camTakeNew"):
-            img = sensor.snapshot()
-            img.to_grayscale(0)
-            arr = bytes(img)
-            gc.collect()
-
-        elif camTransmitter(inputs): pass    
-        elif configHandler(inputs): pass    
+        handler = handlers.get(ftype)
+        if handler: handler(seq, payload)
+        else: sendNack(seq, ERR_UNKNOWN)
 
-        elif (inputs[0] == "AIread"):
-            last_read = aiProcess()
-            gc.collect()
-            uartHandle.write("done")
+        print(1/clock.fps())
 
-        elif (inputs[0] == "AIsend"):
-            result = "num:" + last_read + ";"
-            print("sending", result)
-            uartHandle.write(result)
+    checkLink()
+    if frames: continue
 
-        print(1/clock.fps())
-    time.sleep_ms(100)
+    if not (CONTINUOUS_INFERENCE and inferenceStep()):
+        time.sleep_ms(1)
 
 uartHandle.deinit()
 del uartHandle
@@ -34,101 +34,93 @@
 
 //Resource data
 extern const uint8_t res[];
+//Resource index (the size is a power of two)
+extern const ResIndexEntry resIndex[];
+extern const uint32_t resIndexSize;
+extern const uint32_t resIndexSeed;
 
 
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length)
 {
-   bool_t found;
-   bool_t match;
-   uint_t n;
-   uint_t dirLength;
-   ResEntry *resEntry;
-
-   //Point to the resource header
-   ResHeader *resHeader = (ResHeader *) res;
+   const ResIndexEntry *entry;
 
-   //Make sure the resource data is valid
-   if(resHeader->totalSize < sizeof(ResHeader))
-      return ERROR_INVALID_RESOURCE;
+   //Look up the file in the resource index
+   entry = resFindEntry(path);
+   //Unable to find the specified file?
+   if(entry == NULL)
+      return ERROR_NOT_FOUND;
 
-   //Retrieve the length of the root directory
-   dirLength = resHeader->rootEntry.dataLength;
-   //Point to the contents of the root directory
-   resEntry = (ResEntry *) (res + resHeader->rootEntry.dataStart);
+   //Return the location of the specified resource
+   *data = res + entry->dataStart;
+   //Return the length of the resource
+   *length = entry->dataLength;
 
-   //Parse the entire path
-   for(found = FALSE; !found && path[0] != '\0'; path += n + 1)
-   {
-      //Search for the separator that terminates the current token
-      for(n = 0; path[n] != '\\' && path[n] != '/' && path[n] != '\0'; n++);
+   //Successful processing
+   return NO_ERROR;
+}
 
-      if(n == 0 && path[n] != '\0')
-      {
-         path++;
-         for(n = 0; path[n] != '\\' && path[n] != '/' && path[n] != '\0'; n++);
-      }
 
-      //Loop through the directory
-      for(match = FALSE; !match && dirLength > 0; )
-      {
-         //Check the number of remaining bytes
-         if(dirLength < sizeof(ResEntry))
-            return ERROR_INVALID_RESOURCE;
-         //Make sure the entry is valid
-         if(dirLength < (sizeof(ResEntry) + resEntry->nameLength))
-            return ERROR_INVALID_RESOURCE;
+/**
+ * @brief Hash a resource path (FNV-1a, case-insensitive, both separators)
+ * @param[in] path NULL-terminated path without the leading separator
+ * @param[in] seed Seed of the perfect hash
+ * @return Hash value
+ **/
 
-         //Compare current entry name against the expected one
-         if(resEntry->nameLength == n && !strncasecmp(resEntry->name, path, n))
-         {
-            //Check the type of the entry
-            if(resEntry->type == RES_TYPE_DIR)
-            {
-               //Save the length of the directory
-               dirLength = resEntry->dataLength;
-               //Point to the contents of the directory
-               resEntry = (ResEntry *) (res + resEntry->dataStart);
-            }
-            else
-            {
-               //A file may only appear at the end of the path
-               if(path[n] != '\0')
-                  return ERROR_NOT_FOUND;
+static uint32_t resHashPath(const char_t *path, uint32_t seed)
+{
+   uint32_t hash;
 
-               //The search process is complete
-               found = TRUE;
-            }
-            //The current entry matches the specified path
-            match = TRUE;
-         }
-         else
-         {
-            //Remaining bytes to process
-            dirLength -= sizeof(ResEntry) + resEntry->nameLength;
-            //Point to the next entry
-            resEntry = (ResEntry *) ((uint8_t *) resEntry + sizeof(ResEntry) + resEntry->nameLength);
-         }
-      }
+   //FNV offset basis, varied by the seed
+   hash = 2166136261U ^ seed;
 
-      //Unable to find the specified file?
-      if(!match)
-         return ERROR_NOT_FOUND;
+   //Hash the normalized characters
+   for(; *path != '\0'; path++)
+   {
+      hash ^= (*path == '\\') ? '/' : osTolower(*path);
+      hash *= 16777619U;
    }
 
-   //Unable to find the specified file?
-   if(!found)
-      return ERROR_NOT_FOUND;
-   //Enforce the entry type
-   if(resEntry->type != RES_TYPE_FILE)
-      return ERROR_NOT_FOUND;
+   //The low bits of a product only depend on the low bits of its factors,
+   //fold the high bits in so that every bit of the seed counts for a slot
+   hash ^= hash >> 16;
 
-   //Return the location of the specified resource
-   *data = res + resEntry->dataStart;
-   //Return the length of the resource
-   *length = resEntry->dataLength;
+   //Return the hash value
+   return hash;
+}
 
-   //Successful processing
-   return NO_ERROR;
+
+/**
+ * @brief Search the resource index for a file
+ * @param[in] path NULL-terminated path of the file
+ * @return Index entry of the file, or NULL if it does not exist
+ **/
+
+const ResIndexEntry *resFindEntry(const char_t *path)
+{
+   const char_t *p;
+   const char_t *q;
+   const ResIndexEntry *entry;
+
+   //Skip the leading separators
+   while(*path == '/' || *path == '\\')
+      path++;
+
+   //The path can only be stored in the slot it hashes to
+   entry = &resIndex[resHashPath(path, resIndexSeed) & (resIndexSize - 1)];
+   //Empty slot?
+   if(entry->path == NULL)
+      return NULL;
+
+   //Compare the paths (case-insensitive, both separators)
+   for(p = entry->path, q = path; *p != '\0'; p++, q++)
+   {
+      if(*q == '\\' ? *p != '/' : osTolower(*p) != osTolower(*q))
+         return NULL;
+   }
+
+   //The stored path must not be a prefix of the requested one
+   return (*q == '\0') ? entry : NULL;
 }
 
 
@@ -111,9 +111,29 @@ typedef struct
 } DirEntry;
 
 
+/**
+ * @brief Resource index entry
+ *
+ * The index is a perfect hash table of the file paths, generated with
+ * the resource data (tools/resCompiler). The path of an entry hashes to
+ * its slot, so a lookup is one hash and one compare.
+ **/
+
+typedef struct
+{
+   const char_t *path;     ///<Full path without the leading separator (NULL for an empty slot)
+   uint32_t dataStart;
+   uint32_t dataLength;
+   const char_t *mimeType; ///<MIME type of the original file (also for its .gz variant)
+   const char_t *etag;     ///<Strong entity tag, quoted
+} ResIndexEntry;
+
+
 //Resource management
 error_t resGetData(const char_t *path, const uint8_t **data, size_t *length);
 
+const ResIndexEntry *resFindEntry(const char_t *path);
+
 error_t resSearchFile(const char_t *path, DirEntry *dirEntry);
 
 //error_t resOpenDirectory(Directory *directory, const DirEntry *entry);
@@ -138,6 +138,16 @@ error_t httpServerInit(HttpServerContext *context, const HttpServerSettings *set
    if(!osCreateSemaphore(&context->semaphore, context->settings.maxConnections))
       return ERROR_OUT_OF_RESOURCES;
 
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+   //Create an event object to wake the poll task up
+   if(!osCreateEvent(&context->pollEvent))
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Create a mutex to hand sockets over between the poll task and the workers
+   if(!osCreateMutex(&context->pollMutex))
+      return ERROR_OUT_OF_RESOURCES;
+#endif
+
    //Loop through client connections
    for(i = 0; i < context->settings.maxConnections; i++)
    {
@@ -172,8 +182,13 @@ error_t httpServerInit(HttpServerContext *context, const HttpServerSettings *set
    if(context->socket == NULL)
       return ERROR_OPEN_FAILED;
 
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+   //The poll task only accepts pending connections, never wait
+   error = socketSetTimeout(context->socket, 0);
+#else
    //Set timeout for blocking functions
    error = socketSetTimeout(context->socket, INFINITE_DELAY);
+#endif
    //Any error to report?
    if(error)
       return error;
@@ -225,7 +240,11 @@ error_t httpServerStart(HttpServerContext *context)
       //Point to the current session
       connection = &context->connections[i];
 
-#if (OS_STATIC_TASK_SUPPORT == ENABLED)
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+      //Create a worker task
+      connection->taskId = osCreateTask("HTTP Worker", httpWorkerTask,
+         &context->connections[i], HTTP_SERVER_STACK_SIZE, HTTP_SERVER_PRIORITY);
+#elif (OS_STATIC_TASK_SUPPORT == ENABLED)
       //Create a task using statically allocated memory
       connection->taskId = osCreateStaticTask("HTTP Connection",
          (OsTaskCode) httpConnectionTask, connection, &connection->taskTcb,
@@ -241,7 +260,11 @@ error_t httpServerStart(HttpServerContext *context)
          return ERROR_OUT_OF_RESOURCES;
    }
 
-#if (OS_STATIC_TASK_SUPPORT == ENABLED)
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+   //Create the task that polls the connections
+   context->taskId = osCreateTask("HTTP Poll", httpPollTask,
+      context, HTTP_SERVER_STACK_SIZE, HTTP_SERVER_PRIORITY);
+#elif (OS_STATIC_TASK_SUPPORT == ENABLED)
       //Create a task using statically allocated memory
       context->taskId = osCreateStaticTask("HTTP Listener",
          (OsTaskCode) httpListenerTask, context, &context->taskTcb,
@@ -441,156 +464,8 @@ void httpConnectionTask(void *param)
          //Process incoming requests
          for(counter = 0; counter < HTTP_SERVER_MAX_REQUESTS; counter++)
          {
-            //Debug message
-            TRACE_INFO("Waiting for request...\r\n");
-
-            //Clear request header
-            osMemset(&connection->request, 0, sizeof(HttpRequest));
-            //Clear response header
-            osMemset(&connection->response, 0, sizeof(HttpResponse));
-
-            //Read the HTTP request header and parse its contents
-            error = httpReadRequestHeader(connection);
-            //Any error to report?
-            if(error)
-            {
-               //Debug message
-               TRACE_INFO("No HTTP request received or parsing error...\r\n");
-               break;
-            }
-
-#if (HTTP_SERVER_BASIC_AUTH_SUPPORT == ENABLED || HTTP_SERVER_DIGEST_AUTH_SUPPORT == ENABLED)
-            //No Authorization header found?
-            if(!connection->request.auth.found)
-            {
-               //Invoke user-defined callback, if any
-               if(connection->settings->authCallback != NULL)
-               {
-                  //Check whether the access to the specified URI is authorized
-                  connection->status = connection->settings->authCallback(connection,
-                     connection->request.auth.user, connection->request.uri);
-               }
-               else
-               {
-                  //Access to the specified URI is allowed
-                  connection->status = HTTP_ACCESS_ALLOWED;
-               }
-            }
-
-            //Check access status
-            if(connection->status == HTTP_ACCESS_ALLOWED)
-            {
-               //Access to the specified URI is allowed
-               error = NO_ERROR;
-            }
-            else if(connection->status == HTTP_ACCESS_BASIC_AUTH_REQUIRED)
-            {
-               //Basic access authentication is required
-               connection->response.auth.mode = HTTP_AUTH_MODE_BASIC;
-               //Report an error
-               error = ERROR_AUTH_REQUIRED;
-            }
-            else if(connection->status == HTTP_ACCESS_DIGEST_AUTH_REQUIRED)
-            {
-               //Digest access authentication is required
-               connection->response.auth.mode = HTTP_AUTH_MODE_DIGEST;
-               //Report an error
-               error = ERROR_AUTH_REQUIRED;
-            }
-            else
-            {
-               //Access to the specified URI is denied
-               error = ERROR_NOT_FOUND;
-            }
-#endif
-            //Debug message
-            TRACE_INFO("Sending HTTP response to the client...\r\n");
-
-            //Check status code
-            if(!error)
-            {
-               //Default HTTP header fields
-               httpInitResponseHeader(connection);
-
-               //Invoke user-defined callback, if any
-               if(connection->settings->requestCallback != NULL)
-               {
-                  error = connection->settings->requestCallback(connection,
-                     connection->request.uri);
-               }
-               else
-               {
-                  //Keep processing...
-                  error = ERROR_NOT_FOUND;
-               }
-
-               //Check status code
-               if(error == ERROR_NOT_FOUND)
-               {
-#if (HTTP_SERVER_SSI_SUPPORT == ENABLED)
-                  //Use server-side scripting to dynamically generate HTML code?
-                  if(httpCompExtension(connection->request.uri, ".stm") ||
-                     httpCompExtension(connection->request.uri, ".shtm") ||
-                     httpCompExtension(connection->request.uri, ".shtml"))
-                  {
-                     //SSI processing (Server Side Includes)
-                     error = ssiExecuteScript(connection, connection->request.uri, 0);
-                  }
-                  else
-#endif
-                  {
-                     //Set the maximum age for static resources
-                     connection->response.maxAge = HTTP_SERVER_MAX_AGE;
-
-                     //Send the contents of the requested page
-                     error = httpSendResponse(connection, connection->request.uri);
-                  }
-               }
-
-               //The requested resource is not available?
-               if(error == ERROR_NOT_FOUND)
-               {
-                  //Default HTTP header fields
-                  httpInitResponseHeader(connection);
-
-                  //Invoke user-defined callback, if any
-                  if(connection->settings->uriNotFoundCallback != NULL)
-                  {
-                     error = connection->settings->uriNotFoundCallback(connection,
-                        connection->request.uri);
-                  }
-               }
-            }
-
-            //Check status code
-            if(error)
-            {
-               //Default HTTP header fields
-               httpInitResponseHeader(connection);
-
-               //Bad request?
-               if(error == ERROR_INVALID_REQUEST)
-               {
-                  //Send an error 400 and close the connection immediately
-                  httpSendErrorResponse(connection, 400,
-                     "The request is badly formed");
-               }
-               //Authorization required?
-               else if(error == ERROR_AUTH_REQUIRED)
-               {
-                  //Send an error 401 and keep the connection alive
-                  error = httpSendErrorResponse(connection, 401,
-                     "Authorization required");
-               }
-               //Page not found?
-               else if(error == ERROR_NOT_FOUND)
-               {
-                  //Send an error 404 and keep the connection alive
-                  error = httpSendErrorResponse(connection, 404,
-                     "The requested page could not be found");
-               }
-            }
-
+            //Read and answer one request
+            error = httpProcessRequest(connection);
             //Internal error?
             if(error)
             {
@@ -643,6 +518,496 @@ void httpConnectionTask(void *param)
 }
 
 
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+
+/**
+ * @brief HTTP server poll task (event-driven mode)
+ *
+ * Accepts the incoming connections and watches the idle ones with a single
+ * socketPoll. A connection that becomes readable is handed to a free worker,
+ * which answers one request and gives the connection back if it is
+ * persistent. An idle connection only costs its socket, no task stack.
+ *
+ * @param[in] param Pointer to the HTTP server context
+ **/
+
+void httpPollTask(void *param)
+{
+   uint_t i;
+   uint_t n;
+   uint_t open;
+   systime_t time;
+   systime_t timeout;
+   HttpServerContext *context;
+   HttpConnection *connection;
+   HttpConnection *worker;
+   Socket *socket;
+   SocketEventDesc eventDesc[HTTP_SERVER_MAX_SOCKETS + 1];
+
+   //Task prologue
+   osEnterTask();
+
+   //Retrieve the HTTP server context
+   context = (HttpServerContext *) param;
+
+   //Process events
+   while(1)
+   {
+      //Current time
+      time = osGetSystemTime();
+      //Number of open client connections
+      open = 0;
+
+      //Get exclusive access
+      osAcquireMutex(&context->pollMutex);
+
+      //Loop through the workers
+      for(i = 0; i < context->settings.maxConnections; i++)
+      {
+         //Point to the current worker
+         connection = &context->connections[i];
+
+         //Busy worker? (its connection may come back, keep a slot for it)
+         if(connection->running)
+         {
+            open++;
+         }
+         //The connection of the last request is persistent?
+         else if(connection->socket != NULL)
+         {
+            //Wait for the next request
+            httpPollAddIdleSocket(context, connection->socket,
+               connection->requestCount, time);
+            connection->socket = NULL;
+         }
+      }
+
+      //Release exclusive access
+      osReleaseMutex(&context->pollMutex);
+
+      //Readable connections can only be served by an idle worker
+      worker = httpPollGetIdleWorker(context);
+      //No timeout unless a connection is idle
+      timeout = INFINITE_DELAY;
+      //Number of monitored sockets
+      n = 0;
+
+      //Loop through the idle connections
+      for(i = 0; i < HTTP_SERVER_MAX_SOCKETS; i++)
+      {
+         socket = context->idleSockets[i];
+         //Empty slot?
+         if(socket == NULL)
+            continue;
+
+         //Close the connections that stayed idle for too long
+         if(timeCompare(time, context->idleTimestamps[i] + HTTP_SERVER_IDLE_TIMEOUT) >= 0)
+         {
+            //Debug message
+            TRACE_INFO("Closing idle connection...\r\n");
+            //Graceful shutdown
+            socketShutdown(socket, SOCKET_SD_BOTH);
+            socketClose(socket);
+            context->idleSockets[i] = NULL;
+            continue;
+         }
+
+         //Wake up when the oldest idle connection expires
+         timeout = MIN(timeout, context->idleTimestamps[i] + HTTP_SERVER_IDLE_TIMEOUT - time);
+         open++;
+
+         //Monitor the connection only if a worker can serve it
+         eventDesc[n].socket = (worker != NULL) ? socket : NULL;
+         eventDesc[n].eventMask = SOCKET_EVENT_RX_READY;
+         eventDesc[n].eventFlags = 0;
+         n++;
+      }
+
+      //Accept new connections as long as they can be kept open
+      eventDesc[n].socket = (open < HTTP_SERVER_MAX_SOCKETS) ? context->socket : NULL;
+      eventDesc[n].eventMask = SOCKET_EVENT_RX_READY;
+      eventDesc[n].eventFlags = 0;
+      n++;
+
+      //Wait for a readable socket, a worker that is done or an idle timeout
+      socketPoll(eventDesc, n, &context->pollEvent, timeout);
+
+      //Any pending connection?
+      if(eventDesc[n - 1].eventFlags != 0)
+      {
+         uint16_t clientPort;
+         IpAddr clientIpAddr;
+
+         //Accept the incoming connection (the listening socket never blocks)
+         socket = socketAccept(context->socket, &clientIpAddr, &clientPort);
+
+         //Make sure the socket handle is valid
+         if(socket != NULL)
+         {
+            //Debug message
+            TRACE_INFO("Connection established with client %s port %" PRIu16 "...\r\n",
+               ipAddrToString(&clientIpAddr, NULL), clientPort);
+
+            //Set timeout for blocking functions
+            socketSetTimeout(socket, HTTP_SERVER_TIMEOUT);
+            //Wait for the first request
+            httpPollAddIdleSocket(context, socket, 0, osGetSystemTime());
+         }
+      }
+
+      //Hand the readable connections to the idle workers
+      for(i = 0; i < (n - 1) && worker != NULL; i++)
+      {
+         //Not readable?
+         if(eventDesc[i].eventFlags == 0)
+            continue;
+
+         //The connection is no longer idle, its request count goes along
+         worker->requestCount = httpPollRemoveIdleSocket(context,
+            eventDesc[i].socket);
+
+         //Reference to the HTTP server settings
+         worker->settings = &context->settings;
+         //Reference to the HTTP server context
+         worker->serverContext = context;
+         //Reference to the socket
+         worker->socket = eventDesc[i].socket;
+
+         //The worker is now running...
+         worker->running = TRUE;
+         //Service the request
+         osSetEvent(&worker->startEvent);
+
+         //Find the next idle worker
+         worker = httpPollGetIdleWorker(context);
+      }
+   }
+}
+
+
+/**
+ * @brief Find a worker that can serve a request (event-driven mode)
+ * @param[in] context Pointer to the HTTP server context
+ * @return Idle worker, or NULL if every worker is busy
+ **/
+
+HttpConnection *httpPollGetIdleWorker(HttpServerContext *context)
+{
+   uint_t i;
+   HttpConnection *worker;
+
+   //Get exclusive access
+   osAcquireMutex(&context->pollMutex);
+
+   //A worker whose connection was not taken back yet is not idle
+   for(worker = NULL, i = 0; i < context->settings.maxConnections; i++)
+   {
+      if(!context->connections[i].running &&
+         context->connections[i].socket == NULL)
+      {
+         worker = &context->connections[i];
+         break;
+      }
+   }
+
+   //Release exclusive access
+   osReleaseMutex(&context->pollMutex);
+
+   //Return the worker, if any
+   return worker;
+}
+
+
+/**
+ * @brief Add a connection to the idle ones (event-driven mode)
+ * @param[in] context Pointer to the HTTP server context
+ * @param[in] socket Socket of the connection
+ * @param[in] requestCount Number of requests already answered on the connection
+ * @param[in] time Time at which the connection became idle
+ **/
+
+void httpPollAddIdleSocket(HttpServerContext *context, Socket *socket,
+   uint_t requestCount, systime_t time)
+{
+   uint_t i;
+
+   //Loop through the idle connections
+   for(i = 0; i < HTTP_SERVER_MAX_SOCKETS; i++)
+   {
+      //Free slot?
+      if(context->idleSockets[i] == NULL)
+      {
+         context->idleSockets[i] = socket;
+         context->idleTimestamps[i] = time;
+         context->idleRequestCounts[i] = requestCount;
+         return;
+      }
+   }
+
+   //The accept limit keeps a slot for every open connection, this should not
+   //happen. Close the connection rather than leak it
+   socketShutdown(socket, SOCKET_SD_BOTH);
+   socketClose(socket);
+}
+
+
+/**
+ * @brief Remove a connection from the idle ones (event-driven mode)
+ * @param[in] context Pointer to the HTTP server context
+ * @param[in] socket Socket of the connection
+ * @return Number of requests already answered on the connection
+ **/
+
+uint_t httpPollRemoveIdleSocket(HttpServerContext *context, Socket *socket)
+{
+   uint_t i;
+   uint_t requestCount;
+
+   //Loop through the idle connections
+   for(requestCount = 0, i = 0; i < HTTP_SERVER_MAX_SOCKETS; i++)
+   {
+      //Matching slot?
+      if(context->idleSockets[i] == socket)
+      {
+         context->idleSockets[i] = NULL;
+         requestCount = context->idleRequestCounts[i];
+      }
+   }
+
+   //Return the request count
+   return requestCount;
+}
+
+
+/**
+ * @brief Task that answers the requests handed by the poll task
+ * @param[in] param Structure representing an HTTP connection with a client
+ **/
+
+void httpWorkerTask(void *param)
+{
+   error_t error;
+   Socket *socket;
+   HttpConnection *connection;
+
+   //Task prologue
+   osEnterTask();
+
+   //Point to the structure representing the HTTP connection
+   connection = (HttpConnection *) param;
+
+   //Endless loop
+   while(1)
+   {
+      //Wait for a readable connection
+      osWaitForEvent(&connection->startEvent, INFINITE_DELAY);
+
+      //Read and answer one request
+      error = httpProcessRequest(connection);
+      connection->requestCount++;
+
+      //Close the connection on error, if it is not persistent or if it
+      //reached the limit advertised in the Keep-Alive field
+      if(error || !connection->request.keepAlive || !connection->response.keepAlive ||
+         connection->requestCount >= HTTP_SERVER_MAX_REQUESTS)
+      {
+         //Debug message
+         TRACE_INFO("Graceful shutdown...\r\n");
+         //Graceful shutdown
+         socketShutdown(connection->socket, SOCKET_SD_BOTH);
+
+         //Debug message
+         TRACE_INFO("Closing socket...\r\n");
+         //Close socket
+         socketClose(connection->socket);
+         socket = NULL;
+      }
+      else
+      {
+         //The poll task takes the connection back
+         socket = connection->socket;
+      }
+
+      //Get exclusive access
+      osAcquireMutex(&connection->serverContext->pollMutex);
+      //Ready to serve the next request
+      connection->socket = socket;
+      connection->running = FALSE;
+      //Release exclusive access
+      osReleaseMutex(&connection->serverContext->pollMutex);
+
+      //Wake the poll task up
+      osSetEvent(&connection->serverContext->pollEvent);
+   }
+}
+
+#endif
+
+/**
+ * @brief Read one HTTP request and send the response
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code (the connection must be closed on error)
+ **/
+
+error_t httpProcessRequest(HttpConnection *connection)
+{
+   error_t error;
+
+   //Debug message
+   TRACE_INFO("Waiting for request...\r\n");
+
+   //Clear request header
+   osMemset(&connection->request, 0, sizeof(HttpRequest));
+   //Clear response header
+   osMemset(&connection->response, 0, sizeof(HttpResponse));
+
+   //Read the HTTP request header and parse its contents
+   error = httpReadRequestHeader(connection);
+   //Any error to report?
+   if(error)
+   {
+      //Debug message
+      TRACE_INFO("No HTTP request received or parsing error...\r\n");
+      return error;
+   }
+
+#if (HTTP_SERVER_BASIC_AUTH_SUPPORT == ENABLED || HTTP_SERVER_DIGEST_AUTH_SUPPORT == ENABLED)
+   //No Authorization header found?
+   if(!connection->request.auth.found)
+   {
+      //Invoke user-defined callback, if any
+      if(connection->settings->authCallback != NULL)
+      {
+         //Check whether the access to the specified URI is authorized
+         connection->status = connection->settings->authCallback(connection,
+            connection->request.auth.user, connection->request.uri);
+      }
+      else
+      {
+         //Access to the specified URI is allowed
+         connection->status = HTTP_ACCESS_ALLOWED;
+      }
+   }
+
+   //Check access status
+   if(connection->status == HTTP_ACCESS_ALLOWED)
+   {
+      //Access to the specified URI is allowed
+      error = NO_ERROR;
+   }
+   else if(connection->status == HTTP_ACCESS_BASIC_AUTH_REQUIRED)
+   {
+      //Basic access authentication is required
+      connection->response.auth.mode = HTTP_AUTH_MODE_BASIC;
+      //Report an error
+      error = ERROR_AUTH_REQUIRED;
+   }
+   else if(connection->status == HTTP_ACCESS_DIGEST_AUTH_REQUIRED)
+   {
+      //Digest access authentication is required
+      connection->response.auth.mode = HTTP_AUTH_MODE_DIGEST;
+      //Report an error
+      error = ERROR_AUTH_REQUIRED;
+   }
+   else
+   {
+      //Access to the specified URI is denied
+      error = ERROR_NOT_FOUND;
+   }
+#endif
+   //Debug message
+   TRACE_INFO("Sending HTTP response to the client...\r\n");
+
+   //Check status code
+   if(!error)
+   {
+      //Default HTTP header fields
+      httpInitResponseHeader(connection);
+
+      //Invoke user-defined callback, if any
+      if(connection->settings->requestCallback != NULL)
+      {
+         error = connection->settings->requestCallback(connection,
+            connection->request.uri);
+      }
+      else
+      {
+         //Keep processing...
+         error = ERROR_NOT_FOUND;
+      }
+
+      //Check status code
+      if(error == ERROR_NOT_FOUND)
+      {
+#if (HTTP_SERVER_SSI_SUPPORT == ENABLED)
+         //Use server-side scripting to dynamically generate HTML code?
+         if(httpCompExtension(connection->request.uri, ".stm") ||
+            httpCompExtension(connection->request.uri, ".shtm") ||
+            httpCompExtension(connection->request.uri, ".shtml"))
+         {
+            //SSI processing (Server Side Includes)
+            error = ssiExecuteScript(connection, connection->request.uri, 0);
+         }
+         else
+#endif
+         {
+            //Set the maximum age for static resources
+            connection->response.maxAge = HTTP_SERVER_MAX_AGE;
+
+            //Send the contents of the requested page
+            error = httpSendResponse(connection, connection->request.uri);
+         }
+      }
+
+      //The requested resource is not available?
+      if(error == ERROR_NOT_FOUND)
+      {
+         //Default HTTP header fields
+         httpInitResponseHeader(connection);
+
+         //Invoke user-defined callback, if any
+         if(connection->settings->uriNotFoundCallback != NULL)
+         {
+            error = connection->settings->uriNotFoundCallback(connection,
+               connection->request.uri);
+         }
+      }
+   }
+
+   //Check status code
+   if(error)
+   {
+      //Default HTTP header fields
+      httpInitResponseHeader(connection);
+
+      //Bad request?
+      if(error == ERROR_INVALID_REQUEST)
+      {
+         //Send an error 400 and close the connection immediately
+         httpSendErrorResponse(connection, 400,
+            "The request is badly formed");
+      }
+      //Authorization required?
+      else if(error == ERROR_AUTH_REQUIRED)
+      {
+         //Send an error 401 and keep the connection alive
+         error = httpSendErrorResponse(connection, 401,
+            "Authorization required");
+      }
+      //Page not found?
+      else if(error == ERROR_NOT_FOUND)
+      {
+         //Send an error 404 and keep the connection alive
+         error = httpSendErrorResponse(connection, 404,
+            "The requested page could not be found");
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Send HTTP response header
  * @param[in] connection Structure representing an HTTP connection
@@ -925,6 +1290,8 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
       {
          //Use gzip format
          connection->response.gzipEncoding = TRUE;
+         //The representation depends on Accept-Encoding
+         connection->response.varyEncoding = TRUE;
       }
       else
       {
@@ -941,6 +1308,22 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    else
 #endif
    {
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+      //Calculate the length of the pathname
+      n = osStrlen(connection->buffer);
+
+      //Sanity check
+      if(n < (HTTP_SERVER_BUFFER_SIZE - 4))
+      {
+         //A gzip-compressed variant would be served to other clients
+         osStrcpy(connection->buffer + n, ".gz");
+         if(!fsGetFileSize(connection->buffer, &length))
+            connection->response.varyEncoding = TRUE;
+
+         //Strip the gzip extension
+         connection->buffer[n] = '\0';
+      }
+#endif
       //Retrieve the size of the specified file
       error = fsGetFileSize(connection->buffer, &length);
       //The specified URI cannot be found?
@@ -957,6 +1340,7 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    error_t error;
    size_t length;
    const uint8_t *data;
+   const ResIndexEntry *entry;
 
    //Retrieve the full pathname
    httpGetAbsolutePath(connection, uri, connection->buffer,
@@ -990,6 +1374,8 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
       {
          //Use gzip format
          connection->response.gzipEncoding = TRUE;
+         //The representation depends on Accept-Encoding
+         connection->response.varyEncoding = TRUE;
       }
       else
       {
@@ -1006,17 +1392,67 @@ error_t httpSendResponse(HttpConnection *connection, const char_t *uri)
    else
 #endif
    {
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+      size_t n;
+
+      //Calculate the length of the pathname
+      n = osStrlen(connection->buffer);
+
+      //Sanity check
+      if(n < (HTTP_SERVER_BUFFER_SIZE - 4))
+      {
+         //A gzip-compressed variant would be served to other clients
+         osStrcpy(connection->buffer + n, ".gz");
+         if(resFindEntry(connection->buffer) != NULL)
+            connection->response.varyEncoding = TRUE;
+
+         //Strip the gzip extension
+         connection->buffer[n] = '\0';
+      }
+#endif
       //Get the resource data associated with the URI
       error = resGetData(connection->buffer, &data, &length);
       //The specified URI cannot be found?
       if(error)
          return error;
    }
+
+   //Index entry of the resource (it exists since resGetData succeeded),
+   //the MIME type and the entity tag were computed at build time
+   entry = resFindEntry(connection->buffer);
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //Entity tag of the resource
+   connection->response.etag = entry->etag;
+
+   //The client already holds the current representation?
+   if(httpCompareEtag(connection))
+   {
+      //Format HTTP response header (no body)
+      connection->response.statusCode = 304;
+      connection->response.contentType = entry->mimeType;
+      connection->response.chunkedEncoding = FALSE;
+      connection->response.contentLength = 0;
+
+      //Send the header to the client
+      error = httpWriteHeader(connection);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Properly close output stream
+      return httpCloseStream(connection);
+   }
+#endif
 #endif
 
    //Format HTTP response header
    connection->response.statusCode = 200;
+#if (HTTP_SERVER_FS_SUPPORT == ENABLED)
    connection->response.contentType = mimeGetType(uri);
+#else
+   connection->response.contentType = entry->mimeType;
+#endif
    connection->response.chunkedEncoding = FALSE;
    connection->response.contentLength = length;
 
@@ -107,6 +107,13 @@
    #error HTTP_SERVER_GZIP_TYPE_SUPPORT parameter is not valid
 #endif
 
+//Entity tags for static resources (ETag and If-None-Match)
+#ifndef HTTP_SERVER_ETAG_SUPPORT
+   #define HTTP_SERVER_ETAG_SUPPORT DISABLED
+#elif (HTTP_SERVER_ETAG_SUPPORT != ENABLED && HTTP_SERVER_ETAG_SUPPORT != DISABLED)
+   #error HTTP_SERVER_ETAG_SUPPORT parameter is not valid
+#endif
+
 //Multipart content type support
 #ifndef HTTP_SERVER_MULTIPART_TYPE_SUPPORT
    #define HTTP_SERVER_MULTIPART_TYPE_SUPPORT DISABLED
@@ -121,6 +128,24 @@
    #error HTTP_SERVER_COOKIE_SUPPORT parameter is not valid
 #endif
 
+//Event-driven mode: a single task polls the listening socket and the idle
+//keep-alive connections, and hands every request to a pool of worker tasks
+//(one per HttpConnection) instead of dedicating a task to each connection
+#ifndef HTTP_SERVER_POLL_SUPPORT
+   #define HTTP_SERVER_POLL_SUPPORT DISABLED
+#elif (HTTP_SERVER_POLL_SUPPORT != ENABLED && HTTP_SERVER_POLL_SUPPORT != DISABLED)
+   #error HTTP_SERVER_POLL_SUPPORT parameter is not valid
+#elif (HTTP_SERVER_POLL_SUPPORT == ENABLED && HTTP_SERVER_TLS_SUPPORT == ENABLED)
+   #error HTTP_SERVER_POLL_SUPPORT does not support TLS
+#endif
+
+//Maximum number of open client connections (event-driven mode)
+#ifndef HTTP_SERVER_MAX_SOCKETS
+   #define HTTP_SERVER_MAX_SOCKETS 8
+#elif (HTTP_SERVER_MAX_SOCKETS < 1)
+   #error HTTP_SERVER_MAX_SOCKETS parameter is not valid
+#endif
+
 //Stack size required to run the HTTP server
 #ifndef HTTP_SERVER_STACK_SIZE
    #define HTTP_SERVER_STACK_SIZE 650
@@ -274,6 +299,13 @@
    #error HTTP_SERVER_COOKIE_MAX_LEN parameter is not valid
 #endif
 
+//Maximum length for the If-None-Match field
+#ifndef HTTP_SERVER_ETAG_MAX_LEN
+   #define HTTP_SERVER_ETAG_MAX_LEN 63
+#elif (HTTP_SERVER_ETAG_MAX_LEN < 3)
+   #error HTTP_SERVER_ETAG_MAX_LEN parameter is not valid
+#endif
+
 //Application specific context
 #ifndef HTTP_SERVER_PRIVATE_CONTEXT
    #define HTTP_SERVER_PRIVATE_CONTEXT
@@ -501,6 +533,9 @@ typedef struct
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    char_t cookie[HTTP_SERVER_COOKIE_MAX_LEN + 1];            ///<Cookie header field
 #endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   char_t ifNoneMatch[HTTP_SERVER_ETAG_MAX_LEN + 1];         ///<If-None-Match header field
+#endif
 } HttpRequest;
 
 
@@ -516,6 +551,7 @@ typedef struct
    bool_t noCache;
    uint_t maxAge;
    const char_t *location;
+   const char_t *allow;                              ///<Allow header field (405 responses)
    const char_t *contentType;
    bool_t chunkedEncoding;
    size_t contentLength;
@@ -525,10 +561,14 @@ typedef struct
 #endif
 #if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
    bool_t gzipEncoding;
+   bool_t varyEncoding;                              ///<Vary: Accept-Encoding (a gzip variant exists)
 #endif
 #if (HTTP_SERVER_COOKIE_SUPPORT == ENABLED)
    char_t setCookie[HTTP_SERVER_COOKIE_MAX_LEN + 1]; ///<Set-Cookie header field
 #endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   const char_t *etag;                               ///<ETag header field
+#endif
 } HttpResponse;
 
 
@@ -587,6 +627,13 @@ struct _HttpServerContext
 #endif
    Socket *socket;                                               ///<Listening socket
    HttpConnection *connections;                                  ///<Client connections
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+   OsEvent pollEvent;                                            ///<Wakes the poll task up when a worker is done
+   OsMutex pollMutex;                                            ///<Guards the hand-over of sockets between the tasks
+   Socket *idleSockets[HTTP_SERVER_MAX_SOCKETS];                 ///<Connections waiting for their next request
+   systime_t idleTimestamps[HTTP_SERVER_MAX_SOCKETS];            ///<Time at which each connection became idle
+   uint_t idleRequestCounts[HTTP_SERVER_MAX_SOCKETS];            ///<Requests already answered on each connection
+#endif
 #if (HTTP_SERVER_TLS_SUPPORT == ENABLED && TLS_TICKET_SUPPORT == ENABLED)
    TlsTicketContext tlsTicketContext;                            ///<TLS ticket encryption context
 #endif
@@ -617,6 +664,9 @@ struct _HttpConnection
    OsStackType taskStack[HTTP_SERVER_STACK_SIZE];      ///<Task stack
 #endif
    Socket *socket;                                     ///<Socket
+#if (HTTP_SERVER_POLL_SUPPORT == ENABLED)
+   uint_t requestCount;                                ///<Requests answered on the connection
+#endif
 #if (HTTP_SERVER_TLS_SUPPORT == ENABLED)
    TlsContext *tlsContext;                             ///<TLS context
 #endif
@@ -647,6 +697,18 @@ error_t httpServerStart(HttpServerContext *context);
 void httpListenerTask(void *param);
 void httpConnectionTask(void *param);
 
+void httpPollTask(void *param);
+void httpWorkerTask(void *param);
+
+HttpConnection *httpPollGetIdleWorker(HttpServerContext *context);
+
+void httpPollAddIdleSocket(HttpServerContext *context, Socket *socket,
+   uint_t requestCount, systime_t time);
+
+uint_t httpPollRemoveIdleSocket(HttpServerContext *context, Socket *socket);
+
+error_t httpProcessRequest(HttpConnection *connection);
+
 error_t httpWriteHeader(HttpConnection *connection);
 
 error_t httpReadStream(HttpConnection *connection,
@@ -67,6 +67,7 @@ static const HttpStatusCodeDesc statusCodeList[] =
    {401, "Unauthorized"},
    {403, "Forbidden"},
    {404, "Not Found"},
+   {405, "Method Not Allowed"},
    //Server error
    {500, "Internal Server Error"},
    {501, "Not Implemented"},
@@ -120,6 +121,12 @@ error_t httpReadRequestHeader(HttpConnection *connection)
    //Default value for properties
    connection->request.chunkedEncoding = FALSE;
    connection->request.contentLength = 0;
+#if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
+   connection->request.acceptGzipEncoding = FALSE;
+#endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   osStrcpy(connection->request.ifNoneMatch, "");
+#endif
 #if (HTTP_SERVER_WEB_SOCKET_SUPPORT == ENABLED)
    connection->request.upgradeWebSocket = FALSE;
    connection->request.connectionUpgrade = FALSE;
@@ -488,6 +495,15 @@ void httpParseHeaderField(HttpConnection *connection,
       httpParseCookieField(connection, value);
    }
 #endif
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //If-None-Match header field?
+   else if(!osStrcasecmp(name, "If-None-Match"))
+   {
+      //Save the list of entity tags
+      strSafeCopy(connection->request.ifNoneMatch, value,
+         HTTP_SERVER_ETAG_MAX_LEN + 1);
+   }
+#endif
 }
 
 
@@ -751,12 +767,19 @@ void httpInitResponseHeader(HttpConnection *connection)
    connection->response.noCache = FALSE;
    connection->response.maxAge = 0;
    connection->response.location = NULL;
+   connection->response.allow = NULL;
    connection->response.contentType = mimeGetType(connection->request.uri);
    connection->response.chunkedEncoding = TRUE;
 
 #if (HTTP_SERVER_GZIP_TYPE_SUPPORT == ENABLED)
    //Do not use gzip encoding
    connection->response.gzipEncoding = FALSE;
+   connection->response.varyEncoding = FALSE;
+#endif
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //No entity tag
+   connection->response.etag = NULL;
 #endif
 
 #if (HTTP_SERVER_PERSISTENT_CONN_SUPPORT == ENABLED)
@@ -842,6 +865,13 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
       p += osSprintf(p, "Location: %s\r\n", connection->response.location);
    }
 
+   //Valid list of allowed methods?
+   if(connection->response.allow != NULL)
+   {
+      //Set Allow field
+      p += osSprintf(p, "Allow: %s\r\n", connection->response.allow);
+   }
+
    //Persistent connection?
    if(connection->response.keepAlive)
    {
@@ -914,6 +944,22 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
       //Set Transfer-Encoding field
       p += osSprintf(p, "Content-Encoding: gzip\r\n");
    }
+
+   //The representation depends on the Accept-Encoding field?
+   if(connection->response.varyEncoding)
+   {
+      //Set Vary field
+      p += osSprintf(p, "Vary: Accept-Encoding\r\n");
+   }
+#endif
+
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   //Valid entity tag?
+   if(connection->response.etag != NULL)
+   {
+      //Set ETag field
+      p += osSprintf(p, "ETag: %s\r\n", connection->response.etag);
+   }
 #endif
 
    //Use chunked encoding transfer?
@@ -922,8 +968,9 @@ error_t httpFormatResponseHeader(HttpConnection *connection, char_t *buffer)
       //Set Transfer-Encoding field
       p += osSprintf(p, "Transfer-Encoding: chunked\r\n");
    }
-   //Persistent connection?
-   else if(connection->response.keepAlive)
+   //Persistent connection? (a 304 response never has a body)
+   else if(connection->response.keepAlive &&
+      connection->response.statusCode != 304)
    {
       //Set Content-Length field
       p += osSprintf(p, "Content-Length: %" PRIuSIZE "\r\n", connection->response.contentLength);
@@ -1118,6 +1165,41 @@ bool_t httpCompExtension(const char_t *filename, const char_t *extension)
 }
 
 
+/**
+ * @brief Check the If-None-Match field against the entity tag of the response
+ * @param[in] connection Structure representing an HTTP connection
+ * @return TRUE if the client already holds the current representation, else FALSE
+ **/
+
+bool_t httpCompareEtag(HttpConnection *connection)
+{
+#if (HTTP_SERVER_ETAG_SUPPORT == ENABLED)
+   const char_t *list;
+
+   //Point to the list of entity tags sent by the client
+   list = strTrimWhitespace(connection->request.ifNoneMatch);
+
+   //The resource has no entity tag?
+   if(connection->response.etag == NULL)
+      return FALSE;
+
+   //Any current representation matches the wildcard
+   if(!osStrcmp(list, "*"))
+      return TRUE;
+
+   //Entity tags are quoted, so a substring match is an exact match of one
+   //tag of the list (weak comparison, the W/ prefix is ignored)
+   if(osStrstr(list, connection->response.etag) != NULL)
+      return TRUE;
+   else
+      return FALSE;
+#else
+   //Entity tags are not supported
+   return FALSE;
+#endif
+}
+
+
 /**
  * @brief Decode a percent-encoded string
  * @param[in] input NULL-terminated string to be decoded
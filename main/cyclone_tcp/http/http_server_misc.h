@@ -75,6 +75,7 @@ void httpGetAbsolutePath(HttpConnection *connection,
    const char_t *relative, char_t *absolute, size_t maxLen);
 
 bool_t httpCompExtension(const char_t *filename, const char_t *extension);
+bool_t httpCompareEtag(HttpConnection *connection);
 
 error_t httpDecodePercentEncodedString(const char_t *input,
    char_t *output, size_t outputSize);
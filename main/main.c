@@ -6,8 +6,12 @@
 #include "source/envTypes.h"
 #include "source/storage/storage.h"
 #include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/serial/linkSpeed.h"
+#include "source/camera/frameCache.h"
 #include "source/network/network.h"
 #include "source/mqtt/mqttHelper.h"
+#include "source/mqtt/aiTask.h"
 
 // ********************************************************************************************
 // Global Variables
@@ -28,13 +32,21 @@ void app_main(void)
 
    // initialize serial communication and serial task
    serialInit();
+   uartBrokerInit();
+   frameCacheInit();
 
    // initialize and retrieve appEnv from nvs
    retrieveEnvironment(&appEnv);
 
+   // step the k210 link up to the persisted baud rate
+   linkSpeedInit();
+
    // initialize network interfaces and http server
    initializeNetworks();
 
    // initialize mqtt client task
    mqttInitialize();
+
+   // start sampling the meter in the background
+   aiTaskInit();
 }
@@ -153,7 +153,8 @@
 #define BSD_SOCKET_SUPPORT DISABLED
 
 //Number of sockets that can be opened simultaneously
-#define SOCKET_MAX_COUNT 10
+//(the http server keeps up to HTTP_SERVER_MAX_SOCKETS of them)
+#define SOCKET_MAX_COUNT 16
 
 //LLMNR responder support
 #define LLMNR_RESPONDER_SUPPORT ENABLED
@@ -166,4 +167,14 @@
 // enable cookie support
 #define HTTP_SERVER_COOKIE_SUPPORT ENABLED
 
+// serve the precompressed variant (name.gz) of static resources
+#define HTTP_SERVER_GZIP_TYPE_SUPPORT ENABLED
+// answer If-None-Match with 304 using the tags of the res.c index
+#define HTTP_SERVER_ETAG_SUPPORT ENABLED
+
+// one task polls the open connections and hands each request to a worker
+// (APP_HTTP_WORKERS in server.c), an idle connection costs no task stack
+#define HTTP_SERVER_POLL_SUPPORT ENABLED
+#define HTTP_SERVER_MAX_SOCKETS 8
+
 #endif
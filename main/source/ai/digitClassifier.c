@@ -0,0 +1,63 @@
+#include <math.h>
+#include "digitClassifier.h"
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void digitClassify(const uint8_t *crop,
+   DigitClassifierArena *arena, DigitPrediction *prediction);
+static int32_t dotProduct(const int8_t *a, const int8_t *b, uint_t length);
+
+// ********************************************************************************************
+
+void digitClassify(const uint8_t *crop,
+   DigitClassifierArena *arena, DigitPrediction *prediction)
+{
+   // pixels are fed as 0..127 so that they fit an int8
+   for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+      arena->input[i] = crop[i] >> 1;
+
+   int64_t rounding = (int64_t) 1 << (digitModelHiddenShift - 1);
+   for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+   {
+      int32_t acc = digitModelHiddenBias[h] + dotProduct(arena->input,
+         digitModelHiddenWeights + h * DIGIT_CROP_PIXELS, DIGIT_CROP_PIXELS);
+
+      // relu and requantization in one step
+      int64_t value = acc <= 0 ? 0 : ((int64_t) acc * digitModelHiddenMult
+         + rounding) >> digitModelHiddenShift;
+      arena->hidden[h] = value > 127 ? 127 : value;
+   }
+
+   uint_t best = 0;
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+   {
+      arena->logits[c] = digitModelOutputBias[c] + dotProduct(arena->hidden,
+         digitModelOutputWeights + c * DIGIT_MODEL_HIDDEN, DIGIT_MODEL_HIDDEN);
+
+      if (arena->logits[c] > arena->logits[best])
+         best = c;
+   }
+
+   // softmax probability of the winner (the other terms are <= 1)
+   float sum = 0;
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+   {
+      sum += expf((arena->logits[c] - arena->logits[best]) *
+         digitModelLogitScale);
+   }
+
+   prediction->digit = best;
+   prediction->confidence = (uint16_t) (1000.0f / sum + 0.5f);
+}
+
+// ********************************************************************************************
+
+// kept as a plain loop, compilers vectorize it where they can
+static int32_t dotProduct(const int8_t *a, const int8_t *b, uint_t length)
+{
+   int32_t acc = 0;
+   for (uint_t i = 0; i < length; i++)
+      acc += a[i] * b[i];
+   return acc;
+}
@@ -0,0 +1,32 @@
+#ifndef __digitClassifier_H__
+#define __digitClassifier_H__
+
+#include "os_port.h"
+#include "digitModel.h"
+
+/**
+ * int8 digit classifier that runs on the esp32 when the k210 can't
+ * infer (see aiTask.c). it works on the 28x28 crops of digitPrep.h
+ * and uses no heap, all intermediate values live in the arena.
+ */
+typedef struct _DigitClassifierArena DigitClassifierArena;
+typedef struct _DigitPrediction DigitPrediction;
+
+struct _DigitClassifierArena
+{
+   int8_t input[DIGIT_CROP_PIXELS];
+   int8_t hidden[DIGIT_MODEL_HIDDEN];
+   int32_t logits[DIGIT_MODEL_CLASSES];
+};
+
+struct _DigitPrediction
+{
+   uint8_t digit;
+   uint16_t confidence; // softmax probability of the digit, per mille
+};
+
+// classifies one crop (white digit on black, as made by digitPrepare)
+void digitClassify(const uint8_t *crop,
+   DigitClassifierArena *arena, DigitPrediction *prediction);
+
+#endif
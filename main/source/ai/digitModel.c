@@ -0,0 +1,1613 @@
+// generated by tools/digitModel/digitTrain, do not edit
+
+#include "digitModel.h"
+
+const int32_t digitModelHiddenMult = 1236994304;
+const uint8_t digitModelHiddenShift = 42;
+const float digitModelLogitScale = 0.00594029808f;
+
+const int32_t digitModelHiddenBias[32] = {
+   -6969, 215, 733, 2151, -180, 2618, -297, -808,
+   -206, 4218, -7828, -650, 619, 2744, -1135, -1252,
+   1402, 1274, -465, 3148, -1810, -2630, 3434, -2869,
+   -760, -1328, -275, -6555, -3882, -1277, -4819, -389,
+};
+
+const int32_t digitModelOutputBias[10] = {
+   -9, 374, 155, -115, -157, 20, -127, 140,
+   -93, -189,
+};
+
+const int8_t digitModelOutputWeights[320] = {
+   -18, 1, 75, -4, -9, -33, -16, 9, -7, -2, -4, -1, -5, -52, -8, -8,
+   -41, -36, 19, 97, 13, 8, -33, 31, 50, -10, 6, -25, 5, 16, -60, 19,
+   -27, -5, -2, 40, -31, 48, 6, -19, -7, 53, 57, -5, 43, 7, -26, -10,
+   -35, 65, 7, 7, -44, -30, 29, 12, -32, -13, 10, -60, -11, -28, 13, -7,
+   8, 1, 7, -37, -3, -31, -1, 8, -3, 35, 1, -13, -38, -51, 84, -7,
+   60, 127, 18, -2, 16, 32, -3, 18, -11, 17, -2, -35, -28, -98, -23, 10,
+   -16, -10, -29, -17, 10, -60, -15, 2, 6, -10, 27, 3, 29, 31, 47, -2,
+   71, 3, -21, -8, -41, -7, 78, 26, -20, 25, -5, -15, -21, 25, -62, 14,
+   96, 21, 26, -32, -3, 66, 5, -8, -16, -21, -6, 2, 0, -58, -27, 2,
+   12, -13, -8, -28, -8, -19, -64, 56, -18, 38, 12, -3, 14, -69, -36, -5,
+   -96, -19, -61, 91, -35, 21, -1, -7, 5, -29, 7, -12, -6, 68, -40, -24,
+   -27, -22, 12, 4, 17, -14, 49, -45, -26, -47, 0, -23, -23, 71, 41, 4,
+   52, 19, 1, 51, 12, 68, -9, -16, -15, -13, -14, 18, -14, 10, -115, -8,
+   -61, -41, 19, 38, 6, -43, -74, -69, -5, 45, -5, 25, -25, 18, 60, -7,
+   -24, -1, 21, -22, -11, -57, 28, 4, -1, 55, -17, -20, -3, 0, 28, -20,
+   48, -23, -10, -51, 45, 29, 18, 3, -37, 27, -5, -68, 55, -62, 36, -4,
+   47, -23, -33, 1, -2, -15, 19, -5, -9, -53, -16, -11, 20, 20, 30, 1,
+   -7, -40, 1, 1, -45, -23, -26, 11, 18, -26, 11, 80, -34, 40, -8, -6,
+   -28, -11, -26, -29, 5, -18, -6, 1, -13, -13, -54, 4, -18, 71, 45, -7,
+   9, -38, -8, -46, 44, 68, 32, 12, -1, -41, -10, -6, 32, 54, -50, -12,
+};
+
+const int8_t digitModelHiddenWeights[25088] = {
+   -5, -6, 4, 5, 18, 27, 48, 43, 31, 36, 36, 13, 4, -14, -13, -19,
+   -7, 0, 19, 27, 30, 34, 15, 2, 2, 1, -1, 1, 9, 7, -2, 8,
+   33, 29, 60, 43, 40, 51, 37, 20, 5, -11, -14, -10, -8, 1, 17, 25,
+   36, 24, 17, 9, 0, -1, 2, 0, -2, -2, 10, 6, 18, 38, 54, 53,
+   41, 63, 50, 20, 3, -20, -23, -32, -11, 20, 25, 21, 38, 41, 2, -5,
+   -3, -2, 7, -7, 2, 0, -4, 6, 22, 33, 41, 42, 57, 57, 49, 31,
+   -5, -39, -34, -18, -6, 12, 39, 35, 39, 36, 5, 7, 4, 0, 3, 8,
+   -11, -3, 0, 15, 13, 31, 34, 24, 60, 69, 64, 46, 13, -9, -13, 5,
+   24, 42, 40, 37, 18, 44, 5, -1, -5, -1, -4, -1, 10, -2, -5, 8,
+   19, 20, 28, 19, 55, 46, 63, 62, 22, -7, 0, 11, -7, 16, 14, 24,
+   5, 15, 4, -6, -7, 4, -4, 0, 8, -1, -6, 8, 1, 21, -4, 19,
+   24, 31, 60, 46, 53, 33, 25, 14, 8, 40, 21, 33, 9, 16, -5, -2,
+   4, 5, -3, 2, -7, 1, -9, 1, 13, 23, 18, 6, 5, 10, 41, 49,
+   49, 39, 28, 1, 9, 9, 15, 9, 0, 2, -16, -2, -2, 8, 5, -3,
+   -3, 0, 1, 8, 19, 11, 15, 1, 3, 17, 44, 42, 38, 26, 12, 4,
+   -9, -21, -14, -4, 5, 3, -3, -7, 4, -2, -1, -2, -11, 3, 3, 11,
+   11, -1, 16, 6, -1, 19, 13, -5, -6, -27, -15, 4, -6, -24, -14, -12,
+   -1, -4, 8, -4, -2, 3, 1, -2, -10, 0, -6, 10, 2, 7, 15, 12,
+   9, 6, -22, -38, -47, -61, -38, -45, -45, -41, -23, -7, 5, 21, 0, -3,
+   -1, 1, -4, 3, -1, -2, -4, 4, 1, -8, 19, 20, 21, -14, -48, -78,
+   -81, -61, -63, -61, -55, -67, -33, -1, 11, 27, 6, -10, 1, 1, -6, -3,
+   -7, -6, -10, 1, -8, -3, 16, 13, 18, -16, -65, -99, -85, -68, -52, -52,
+   -35, -49, -15, -3, 31, 38, 11, 4, 4, -3, 4, -1, 3, -2, 2, -3,
+   -18, -21, 6, 1, -8, -27, -51, -59, -64, -78, -60, -55, -36, -16, 4, 8,
+   46, 30, 11, 6, 3, 5, 0, 1, -8, -7, -3, -4, -17, -36, -17, -37,
+   -46, -56, -52, -47, -44, -42, -58, -31, -42, -13, 16, 27, 40, 23, 5, 1,
+   3, 6, -3, -5, -2, 1, 5, -2, -16, -46, -61, -86, -83, -65, -34, -43,
+   -43, -49, -58, -43, -42, -20, 7, 3, -6, 21, 11, 6, 6, -3, 8, 7,
+   -5, 0, -4, -1, -29, -48, -62, -100, -93, -85, -72, -71, -53, -55, -57, -40,
+   -27, -28, -19, -1, -5, 2, -2, -6, -4, 3, -3, -5, 13, 3, -2, 2,
+   -14, -55, -85, -111, -110, -98, -96, -83, -30, -29, -13, -6, 0, -9, -32, -34,
+   -17, -6, -1, -8, 1, 6, -3, -6, 7, -2, -2, -2, -9, -49, -68, -101,
+   -115, -95, -70, -52, -10, 11, 23, 1, 17, 11, -35, -29, -34, -16, -2, -14,
+   -2, 1, 4, -4, 0, -4, 6, -10, -23, -40, -63, -81, -63, -65, -37, 2,
+   1, 21, 24, 3, -6, 2, -21, -24, -15, -19, -18, 1, -6, 2, 2, 5,
+   -2, 5, -7, -7, -14, -22, -44, -66, -26, -22, -8, -4, 12, 33, 23, -6,
+   -9, -25, -22, -8, -13, -17, -22, -10, 7, 5, 3, 3, -1, -4, -3, -1,
+   -7, -18, -9, -24, 2, 23, 9, 45, 37, 39, 24, 13, -20, -23, -28, 7,
+   7, -5, -12, -12, -3, -7, 0, -6, -5, 3, -8, -6, -5, -3, -1, 13,
+   42, 48, 40, 46, 41, 39, 17, 4, -7, -30, -14, 12, -3, -10, -9, -9,
+   5, 9, -2, -5, 4, 4, 1, 9, -3, 3, 14, 10, 27, 29, 27, 24,
+   14, 23, -9, 10, -9, -18, -10, 11, 13, 0, 4, 10, -4, -8, -6, 1,
+   5, 1, 8, 3, 10, 20, 24, 19, 24, 24, -4, -24, 0, 9, 20, 10,
+   -18, -17, 5, 29, 3, 5, 5, -2, 5, -2, -5, 8, 5, 3, -13, -2,
+   2, 13, 19, 16, 27, 7, 19, 19, 10, 9, 14, 4, 2, 7, 1, -11,
+   -5, 15, 3, 0, 15, -1, 5, 7, 1, -4, -7, -4, 3, 8, 17, 8,
+   29, 30, 25, 27, 34, 20, 29, 0, 3, -4, -1, 9, 17, 19, 12, -8,
+   1, -5, -4, 5, -2, 4, 0, 3, -1, 26, 19, 25, 28, 35, 36, 30,
+   26, 47, 23, 9, 17, -5, 0, 23, 18, 39, 2, 3, 6, 5, 8, 7,
+   0, -2, -2, 1, 1, -2, -6, -7, -6, -3, -1, -1, -11, -6, -4, -6,
+   -3, 3, 4, -2, -5, 0, -1, 4, -5, -1, -2, -3, -12, -2, 4, 5,
+   -5, 2, 5, 0, -5, -1, -7, 5, -8, 0, 3, -7, 7, 2, -8, -3,
+   -3, 10, 3, -1, -1, 3, -10, 7, -7, -3, 11, -9, -5, -2, 7, 0,
+   1, -4, -2, -6, -9, 4, -8, 3, -6, -8, -7, 7, 1, 3, -12, 0,
+   -5, 1, -1, 0, 5, 5, 1, 0, -4, 5, -5, -4, -4, 1, -7, -3,
+   -14, 3, -8, 2, -1, 7, -4, 8, 4, 15, 8, 1, 2, 0, -3, 3,
+   -6, -1, -2, -1, -4, 3, 1, -2, -2, 1, 6, -8, -12, -4, -1, 5,
+   -2, -2, 2, -5, 9, 2, 2, 0, 1, 0, 1, 1, 4, 5, 4, 5,
+   -5, 2, 8, 2, 0, -4, -12, -9, -12, -3, -8, -9, 4, 1, 0, -1,
+   4, -12, 7, 3, -1, -5, -6, 1, -3, 0, -4, -3, -6, 5, -4, 7,
+   4, 5, -9, -4, 1, 0, -3, -6, -1, -5, 3, 4, -4, -6, -4, 4,
+   -1, 3, -1, 1, -1, -2, 2, -3, 3, 3, 7, -4, -4, -3, 2, -4,
+   -2, -3, 6, 8, 6, 10, -3, 8, 0, 10, 0, 4, -10, -9, -3, -11,
+   -7, 2, 3, -1, -3, 6, 0, -2, 2, -4, -12, -4, 0, 2, 8, 15,
+   6, -3, 10, -2, -13, 2, -1, -4, 11, 0, 8, -7, -5, -3, -4, -3,
+   -8, 0, 1, 4, 4, -9, -5, 6, -1, 5, 5, 7, 12, 5, 11, -10,
+   -7, -10, 2, 3, 8, 9, -5, 0, -1, -3, 9, 3, -8, -7, 4, 0,
+   -5, -3, 9, -6, 7, 6, 4, 4, -5, 0, -4, 3, -5, -8, 3, 3,
+   11, 5, -5, -3, 4, 3, 8, -2, -4, 4, -5, 0, -11, -3, -1, 0,
+   8, 10, -1, 0, 4, 2, 3, -3, -10, -2, 4, -2, 4, -4, -3, 1,
+   5, 4, -5, -5, -8, -3, -5, -14, -1, 3, 10, 11, 7, 14, 3, 7,
+   0, -4, 0, -3, -3, -9, -4, -4, -3, 3, 3, 7, -5, 4, -3, -1,
+   1, -3, 2, -11, -4, 5, 9, 0, -6, 2, 5, 8, -5, -8, -8, 0,
+   -4, 5, -6, 6, -1, -4, 5, -1, -3, -1, -2, -4, 2, 0, 7, -7,
+   -6, 0, 9, 1, 13, 1, 11, 10, 0, 6, 7, -4, -9, 4, -1, 1,
+   3, -1, -7, 0, 10, 7, -1, -3, -2, -4, 2, -3, -2, -5, 6, 3,
+   12, 12, 7, 4, 4, 12, 12, -1, 0, 2, -7, -6, 10, 0, 2, -3,
+   1, 5, -5, -3, -1, -8, -5, 4, -10, -1, 7, -1, 8, -4, 0, 5,
+   3, -4, -3, 7, 1, 9, -4, 3, 3, 3, 4, 1, 2, 7, 5, 8,
+   2, -7, 1, -4, -6, -6, -1, 2, 7, 3, -6, -1, 2, 7, 9, 3,
+   5, -20, -5, -8, -4, -4, -5, 0, -1, -3, 4, -1, -1, -16, -3, -11,
+   -1, 9, -11, 3, 4, -13, 14, -3, 6, 6, -5, 5, -1, -2, 8, 5,
+   1, 5, -1, 0, 4, 2, -4, -1, 5, -4, 1, -4, 5, 1, -6, -4,
+   0, -3, -3, -12, 3, 4, 1, 14, 4, -3, -2, 5, 10, 0, -1, 10,
+   -3, -3, 3, 6, 8, 0, 0, -2, 0, -6, 1, 3, 1, 0, -2, -3,
+   -10, 5, 0, -5, 1, 3, 7, 1, -1, -1, -2, 5, -4, 4, -6, 2,
+   0, 1, 6, -2, 4, -2, -5, 1, -2, -4, -6, -11, 1, 0, 0, 5,
+   -6, 7, 2, 6, -1, -3, 1, -8, -1, 0, 7, 1, 7, -1, -7, -5,
+   2, 2, -3, -8, -5, -5, 4, -4, -1, 3, 1, -5, -15, -3, 8, 0,
+   0, 0, -3, 8, 3, -2, -3, 2, 4, 11, 0, -1, 0, -2, -3, -8,
+   1, -14, 10, 4, -14, -5, -4, -1, -1, 5, -7, -1, -13, -1, 0, -3,
+   0, 3, -7, -6, 10, 5, -4, 1, -1, -9, -8, -9, -14, -2, 1, -6,
+   -12, 6, -5, -12, -3, 5, 5, 4, 4, -10, 3, 2, 6, -2, 2, 3,
+   -6, -4, 0, -8, -2, 1, -17, -3, -6, 7, -5, -2, -3, 2, 4, 2,
+   -2, -8, 1, 1, -1, -12, -7, 2, -1, 1, -1, -3, 4, 5, -1, -4,
+   -5, -3, 0, 4, -9, 0, -3, -12, 0, -4, -4, -2, 2, -2, -4, 1,
+   -1, -7, -4, -5, 2, 0, -2, 4, 3, 0, -5, 4, 1, 6, -3, -2,
+   -6, 2, -2, -7, -1, -5, -2, 0, -5, 5, -3, -3, -5, 2, -1, -7,
+   -7, -2, -1, 2, -4, 21, 27, 6, 32, 31, 31, 23, -1, -9, -13, -2,
+   17, 20, 25, 30, 23, 6, 13, -6, 2, 2, 3, 4, 1, 4, 2, 3,
+   3, 10, 28, 27, 42, 40, 27, 2, -22, -34, -41, -5, 7, 29, 44, 28,
+   33, 20, 19, 6, -8, -2, -2, 3, 3, -2, -6, 2, 1, 7, 33, 30,
+   41, 40, 18, -18, -43, -46, -49, -24, -16, 11, 41, 50, 36, 23, 27, -4,
+   -5, 4, 2, -8, 1, 0, 1, 1, 1, 11, 28, 20, 45, 25, 14, -24,
+   -45, -46, -38, -36, -11, 15, 16, 40, 36, 14, 26, -3, -6, -9, -1, -11,
+   1, -2, 1, 7, 7, 7, 30, 18, 25, 25, 1, -20, -38, -33, -34, -17,
+   -16, 9, 6, 17, 30, 9, 10, 2, -7, 0, 2, -3, 9, 3, 8, 10,
+   7, 0, 10, 12, 8, 10, -2, 1, -18, -15, -22, -7, 0, 5, 5, -1,
+   14, 5, 4, -6, -2, 4, 6, -3, 5, -2, 2, -8, -1, 5, 9, 0,
+   2, 19, -9, -24, -8, -10, -16, -15, -15, -18, 6, 4, -5, -5, 1, -5,
+   -12, 3, 3, 6, -3, -1, 8, -3, 0, -2, 4, -7, -11, -4, -12, -36,
+   -16, -18, -15, -19, -32, -33, 1, -1, -12, -15, 0, -9, -5, 4, -9, -6,
+   -1, 1, 5, 8, -9, -15, -9, -16, -14, -7, -12, -24, -12, -7, 12, 2,
+   6, -29, -5, -4, -15, -24, -8, -9, -9, -6, -1, -1, -9, 7, -11, 5,
+   -11, -13, -19, -19, -4, -14, -24, -9, 1, 35, 49, 37, 20, -7, -6, -8,
+   -7, -29, -13, -1, -6, 0, -3, 3, -2, 3, 10, 0, -20, -9, -25, -26,
+   0, -24, -36, 7, 36, 75, 74, 60, 31, -2, -15, -17, -17, -40, -23, -10,
+   6, 7, 6, -2, -6, -2, 3, -2, -10, -30, -29, -41, -27, -32, -11, 16,
+   44, 66, 76, 68, 33, -4, -12, -13, -23, -31, -13, -12, -2, -1, -4, 4,
+   -3, 0, 6, 9, -9, -30, -28, -48, -27, -28, -2, 20, 44, 71, 80, 40,
+   27, 4, -8, -7, -24, -16, -2, -14, -2, 0, 3, 2, -3, 6, -5, 1,
+   -19, -35, -41, -51, -29, -26, -21, 14, 41, 65, 87, 45, 8, 4, 10, -10,
+   -23, -12, -3, -16, -1, 3, -3, 3, -1, -9, -2, -2, -20, -44, -42, -27,
+   -32, -29, -40, 12, 21, 54, 86, 58, 26, -5, 7, -10, 0, 7, -7, -1,
+   -8, -2, -5, 7, -5, 3, 6, 6, -13, -32, -45, -45, -26, -38, -23, 10,
+   24, 77, 96, 71, 55, 12, 11, -13, -6, 7, -9, 4, -4, 0, -2, 1,
+   0, 1, 2, 0, -6, -23, -29, -36, -28, -34, -39, -17, 14, 67, 85, 72,
+   27, 7, 0, -4, 8, 16, -10, -2, -15, 0, 6, 0, 3, 14, -5, -9,
+   -13, -3, -22, -42, -37, -38, -49, -27, -3, 50, 72, 64, 13, 2, 6, -4,
+   7, 20, 6, -1, -3, 5, -7, -4, -1, 2, 2, 7, -4, -10, -18, -39,
+   -42, -39, -56, -62, -21, 44, 63, 51, -3, -11, 7, 5, 9, 24, 9, -7,
+   -4, 1, -5, -5, 1, 9, 7, 6, -1, -7, -9, -33, -34, -50, -67, -50,
+   -22, -6, 30, 12, -14, 2, -4, 7, 25, 6, 16, 13, -2, -2, 0, 1,
+   -1, 3, -3, -1, -7, 5, -3, -25, -33, -37, -62, -37, -21, -12, 1, 5,
+   -26, -10, 7, 12, 10, 5, 14, 1, -10, 0, 1, 0, -4, -2, 1, 2,
+   2, -7, -10, -20, -47, -27, -42, -44, -25, -24, -1, -20, -16, -33, -12, -10,
+   -4, 1, -1, -5, 1, 1, -4, 1, 6, -5, 7, -4, -1, -5, -1, -15,
+   -35, -26, -19, -37, -35, -26, -36, -34, -17, -31, -20, -32, 3, 1, -5, -6,
+   1, 0, 0, 7, 0, 3, 0, -5, -8, 0, 7, -25, -23, -10, -1, -15,
+   -31, -30, -19, -34, -26, -15, -30, -5, 11, 11, 4, 1, -8, 1, 10, -8,
+   4, -1, -1, 8, 15, -6, 17, 14, 13, -8, -7, -24, -44, -45, -48, -30,
+   -31, -4, 0, 16, 15, 12, 6, 2, -5, -6, -8, 7, -8, 4, -2, -2,
+   2, 1, 15, 11, 22, 0, -8, -5, -32, -45, -40, -38, -1, 13, 3, 12,
+   29, 16, 6, -3, -11, 1, 2, 5, -3, -1, -7, 0, 2, 9, 21, 15,
+   14, 12, 13, -5, -19, -22, -33, -27, 8, 8, 2, 25, 33, 20, 2, -4,
+   -10, 5, -6, -10, 4, 6, -1, -6, 10, 12, 25, 21, 18, 22, 14, -1,
+   -5, 6, -1, -3, -2, -7, 10, 22, 31, 13, 5, -8, -8, -4, 6, -7,
+   -5, 4, -10, -13, 1, -4, -10, -20, -2, -1, 2, -11, 3, -20, -13, -3,
+   -5, -2, -11, -7, -15, -3, 0, -4, -3, -3, -15, 3, -4, 2, -1, -7,
+   -3, 7, -10, -16, -7, 3, 3, 18, 5, 2, 9, 11, 5, 8, 12, 12,
+   -11, 7, 4, -1, -11, 9, 8, 0, 5, 13, 4, 0, -1, 4, -11, -18,
+   -10, 6, 4, 12, 14, 1, 4, 6, 9, 25, 22, 21, -5, 4, 2, 1,
+   2, 4, -6, -9, -3, -1, -3, 3, -6, -4, -9, -6, -8, 10, 10, 9,
+   15, 16, 4, -17, 7, 12, 16, -7, -12, -8, -8, -5, -6, -8, -5, -3,
+   5, 9, -6, 2, -4, 7, -9, -6, 19, 20, 12, 12, 12, 15, 1, 19,
+   7, -3, -1, -10, -5, -14, -2, -3, -8, 3, 3, -9, -4, 2, -6, -8,
+   -8, -1, -9, -1, 21, 24, 23, 16, 10, -2, -11, -13, -11, -8, 3, -15,
+   -19, -16, -18, -4, -4, 0, -9, -4, 3, -5, -3, 2, -9, -5, -3, -2,
+   22, 35, 21, 10, -1, -4, -7, -27, -20, -18, -20, -21, -31, -22, -7, -8,
+   0, 7, 3, 1, -2, -5, -4, -3, 6, 3, 2, -1, 13, 29, 25, 22,
+   9, -9, -17, -31, -39, -39, -47, -42, -41, -13, -19, -5, -3, 1, 1, -4,
+   3, 5, 1, 3, -10, 16, -11, -5, 17, 25, 16, 33, 20, 0, -24, -27,
+   -40, -43, -64, -65, -46, -20, -31, -12, 0, -4, -1, 4, -10, -4, 5, -9,
+   -6, 2, 3, 10, 20, 23, 27, 30, 20, 0, -7, -9, -26, -49, -55, -57,
+   -57, -30, -17, -9, -3, -7, -2, 1, -2, -14, -6, -6, 2, 8, -4, 17,
+   29, 18, 20, 29, 16, 16, -5, -7, -24, -30, -17, -45, -39, -40, -19, -11,
+   -2, -5, 7, 2, -3, 1, 5, 5, -3, 4, 18, 18, 31, 24, 17, 19,
+   23, 29, 16, 13, -4, -17, -5, -13, -26, -22, -13, -5, -4, 5, 8, -1,
+   6, -2, -3, -1, -15, 12, 15, 19, 36, 29, 25, 3, 11, 21, 23, 12,
+   2, -1, 3, 11, -8, -8, -7, 1, 5, 8, 1, 0, -3, -6, 7, 0,
+   2, 18, 7, 14, 19, 8, 23, -1, 2, 1, 1, -2, -13, 10, 15, 10,
+   -12, 0, -6, -8, -4, -3, 7, 1, -9, -6, 0, -7, -10, -2, 4, -10,
+   -5, 2, 5, 1, -4, -4, -6, -17, -23, 2, 14, 21, 3, 5, 4, -7,
+   0, 0, 6, -5, 3, 6, -2, -11, -6, 7, -13, -20, -28, -10, -2, -13,
+   -25, -15, -26, -20, -5, 1, 8, 13, 12, 12, 6, 7, -2, 4, 1, -1,
+   6, -3, -4, 2, -6, -22, -29, -36, -27, -25, -12, -20, -31, -46, -29, -24,
+   -18, 2, 2, 9, 11, 11, 4, -6, -2, 6, -5, 5, 1, 0, -7, 3,
+   -14, -27, -37, -46, -27, -25, -11, -14, -36, -41, -37, -28, -19, 5, 0, 4,
+   10, 5, 2, 1, -2, 0, 1, -3, -6, 4, -5, -9, -17, -13, -31, -50,
+   -35, -16, -7, -9, -10, -24, -3, -5, -3, -1, 0, 16, 13, 20, -2, 10,
+   -6, 6, -14, -2, 1, -8, -9, 1, -10, -13, -24, -38, -37, -19, -2, -6,
+   -1, 4, 13, 3, 18, 1, 19, 6, 5, 19, 5, 8, -4, 2, 5, 0,
+   -7, -9, 0, -6, -6, -9, -29, -32, -19, -18, 6, 3, 6, 0, 21, 11,
+   17, 1, 10, 14, 14, 6, 11, 7, 3, 1, 1, -11, 6, 0, -3, -14,
+   1, -3, -2, -7, -5, -1, 11, 6, 18, 15, 24, 20, 19, 18, 9, 12,
+   11, 7, 6, 15, 13, -8, 1, 1, 6, 1, 1, -6, -5, 13, 8, 13,
+   10, 6, 1, 10, 9, 7, 12, 4, 5, 12, 10, 16, 0, 14, 18, 6,
+   -1, 6, 3, -2, 3, 4, -1, -6, -6, -3, 5, 11, 17, 10, 1, -5,
+   0, 5, 14, 16, 17, 11, 3, 10, -4, 7, 5, 6, -5, -3, -7, -8,
+   -4, 1, 10, 0, 1, -2, 12, 6, 10, 14, 16, 9, 5, 8, 0, -2,
+   4, 7, 9, 5, -4, 9, 0, 2, -11, 7, -1, 0, -8, -8, 9, -8,
+   1, 1, 10, -7, -4, 7, 20, 7, 13, 12, 2, 4, 0, -2, 4, -5,
+   -7, 0, 2, 5, -3, -1, -3, -4, -2, 5, -4, -7, -6, -3, 3, -10,
+   -4, 14, 9, 10, 12, 11, 4, -1, 3, 3, 5, -12, -13, 3, -5, 2,
+   -3, 1, -2, -1, 2, -1, 5, -2, 5, -3, -18, -13, -22, -7, -9, 5,
+   -9, -6, -10, -17, -5, -9, 5, -14, -16, 8, -15, -3, -7, 4, 0, -2,
+   -7, 4, 2, 7, 6, 2, 1, 4, -4, 0, 1, -8, 1, -12, 3, 9,
+   -1, 3, -2, -6, 7, 1, -9, -5, -1, -2, 8, -8, 13, 2, 7, -4,
+   -6, -1, -2, -5, 2, -5, 13, -6, -11, 1, -8, 2, 4, -5, 2, -1,
+   -4, 6, -6, 3, -1, 5, 5, -2, -5, -2, 0, 9, 7, 7, -3, -8,
+   1, -1, -8, 2, -2, 4, 2, 3, -4, 0, 3, 9, 6, -3, 8, 7,
+   0, 0, 0, -8, 5, 2, -6, -2, 10, -5, 7, -2, -1, -4, -7, -7,
+   -3, -4, 4, -2, -4, -11, -7, 1, 3, -2, 5, 4, 2, 4, -4, -7,
+   6, 2, 5, -8, -2, -8, 1, 2, -1, -4, 3, -6, -7, 4, -2, 3,
+   2, 7, -3, 6, -2, -1, 7, 1, -5, 2, 3, -3, -1, 0, -4, -3,
+   5, -3, 0, -5, 1, -12, -1, -1, 2, 4, -4, -3, 1, 0, 0, 0,
+   10, 1, -11, 4, 2, -6, -3, 2, -3, -6, 5, 0, -6, -3, 0, -8,
+   -1, -3, -4, -2, -3, -2, 2, 2, -5, -2, 9, -9, -2, -8, 1, 5,
+   -3, -1, 3, 6, -3, -1, 4, 4, -3, 3, -5, -1, 0, 4, 4, 0,
+   4, 3, -12, 0, -1, -2, -5, 1, 4, 1, 3, -3, 0, -5, -2, 3,
+   2, -3, 4, -3, -5, 2, -3, -8, -1, 0, -2, 1, -5, -6, 7, 1,
+   12, -4, -7, -1, -4, -7, -1, 6, 0, 7, 3, -5, 6, 4, -3, -2,
+   -1, 8, -6, -6, 2, -2, 2, 0, -1, 0, -1, -3, -2, 3, 4, -3,
+   6, -11, 0, -6, -5, -1, -9, 8, 5, -11, 4, -14, -2, 11, -1, -5,
+   -3, 4, 2, -3, 0, -3, 1, 2, 5, 0, 0, 0, -4, -2, -4, -7,
+   -3, 1, -5, 8, 2, 4, -3, -1, -4, 0, 8, 5, -8, 5, -8, -3,
+   -4, 0, 4, -7, -5, -3, -1, 0, 7, -1, -12, 4, 11, 5, -10, -8,
+   6, 2, -10, -5, -3, 1, -2, -3, 1, -3, -4, -7, -4, -4, -3, -2,
+   4, 4, -2, 5, -4, -6, 1, 4, 1, 9, -7, 0, 1, -7, -3, -5,
+   8, 8, -4, -1, 0, 3, -6, -2, 0, 0, 3, -2, -1, 3, -2, -2,
+   5, 1, 6, 5, -6, -11, 1, -5, 5, -3, 3, -4, 1, 0, -10, -6,
+   4, 3, -6, 3, 4, -4, 0, -1, -10, -2, -5, 4, -7, -2, 1, 3,
+   2, 9, 6, -3, 4, -4, -3, 0, 3, 0, -15, -4, 1, 3, 2, -4,
+   0, 4, 4, -3, -5, -2, 3, -1, -3, -1, 1, -1, 3, -2, 3, -3,
+   -7, -4, 1, 4, 3, 5, -8, -10, -7, 5, -3, -6, 0, -1, -3, -7,
+   -5, -3, -5, 2, -5, 1, 1, 6, 4, -8, 2, 1, -2, -3, 7, 4,
+   -4, -4, -5, 3, 8, -3, -7, -6, 0, 0, -4, 0, -1, 10, 9, 4,
+   2, -2, 0, 0, -3, -5, 2, 4, -3, -1, -5, 7, 5, 6, -5, 3,
+   2, -6, 2, -8, -3, -7, -2, -8, 5, -5, -1, -1, -2, 7, 6, 1,
+   10, 3, -1, 7, -3, 6, 5, 4, -1, 0, 7, -4, 8, -3, -2, 3,
+   -4, -3, 2, 0, -1, 0, -3, 6, -7, -5, 1, 2, 9, 4, -2, 3,
+   0, 3, 3, 0, -2, -4, 1, -3, -3, 4, 5, -3, -9, -5, 6, -8,
+   2, 13, 3, 1, 1, -4, -3, 3, -2, 0, 4, -5, -1, 8, 11, -2,
+   0, 4, 4, 17, -1, 5, -6, -8, -6, -3, -3, -8, -7, -1, -5, 4,
+   -2, 5, -2, -3, 1, -2, 1, -8, 2, -3, 2, -1, -1, -4, 2, -3,
+   0, 0, -3, -4, -6, -6, -5, -4, -2, 4, -6, 2, 1, 0, 0, -7,
+   4, 1, 2, -8, -4, 7, -11, -5, 5, -2, -8, 2, 12, 2, -5, -3,
+   9, -5, 4, -5, 6, -4, -13, -7, -1, 13, -6, 1, -4, 4, -8, 3,
+   5, -1, 9, 0, -1, -3, 7, 3, 1, -7, 0, 3, -9, -1, -7, -4,
+   -1, 2, -3, 9, 9, 6, -7, 3, -3, 8, 5, 6, 1, 0, 5, 3,
+   -4, -3, 8, 0, 5, 9, 1, -5, -2, -2, -1, 2, 4, -1, 2, 3,
+   -8, 6, 6, -6, -4, 4, -1, 0, 1, 7, 1, -4, -6, 4, 2, -2,
+   6, -2, -5, -5, 6, -7, 2, -2, -3, 5, -3, -3, -1, -6, -1, -4,
+   4, 3, 10, 4, -3, 8, 4, -2, -2, -8, 3, -4, -3, 7, -11, -4,
+   6, -12, -7, 7, 1, -7, 2, -4, 4, -6, 3, -4, -3, 3, -4, 4,
+   -1, -8, -2, -3, -10, -19, -28, -54, -51, -47, -50, -41, -21, -19, 9, 2,
+   1, 7, 0, 5, 2, -1, 3, 1, -1, 4, 3, 4, -3, 0, -7, -12,
+   1, -18, -28, -55, -49, -60, -43, -36, -26, -6, 24, 16, 10, 5, 8, 2,
+   4, -10, 0, -1, -3, -3, 3, -3, -7, 3, -4, -9, -8, -23, -32, -64,
+   -62, -58, -56, -51, -31, -11, -7, 9, 2, 13, 15, 22, 9, -2, -6, 2,
+   4, -5, 1, 2, 2, -4, 0, -3, -7, -16, -31, -52, -45, -57, -54, -31,
+   -8, -5, 7, 24, 16, 9, 26, 26, 12, 7, -15, -6, -2, 1, -1, -2,
+   4, -6, 4, -8, -3, -13, -23, -31, -44, -26, -33, -16, -11, -14, 22, 35,
+   13, 22, 20, 1, 2, -5, -18, -3, 9, -4, 1, -2, 4, 5, -1, -5,
+   -1, -16, -26, -24, -26, -24, -37, -24, -26, -16, 21, 34, 29, 11, 12, 2,
+   3, 5, -4, 8, 9, -5, 4, -2, 3, -10, 0, 5, -12, -23, -26, -19,
+   -24, -38, -33, -33, -7, -11, 9, 21, 12, 4, 11, 3, -11, -10, -10, -3,
+   -1, 5, -5, 1, -1, 8, 1, 1, -7, -12, -25, -26, -15, -9, -24, -28,
+   14, 1, 7, 3, -11, -7, -9, -18, -23, -23, -16, 6, 12, 2, 0, 9,
+   -1, 16, 0, -3, -20, -17, -24, -42, -30, -19, -32, -6, 11, 14, 28, -8,
+   -46, -26, -31, -29, -34, -25, -21, -2, 2, -1, 6, -2, 3, 4, -1, 1,
+   -10, -12, -20, -19, -19, -17, -28, 24, 26, 39, 33, 6, -43, -51, -39, -46,
+   -44, -23, -16, -22, -2, -2, -3, 0, -1, -4, 0, -9, -10, -1, -23, -21,
+   -2, -4, 5, 32, 53, 51, 28, 0, -50, -21, -40, -51, -50, -36, -25, -2,
+   15, 5, 2, -1, 3, 0, -8, -10, 8, 7, -13, -14, 0, 20, 17, 24,
+   39, 50, 38, 0, -32, -30, -12, -42, -60, -31, -23, 7, -3, -3, 8, 0,
+   7, -3, 0, 0, -5, 6, 7, 12, 19, 17, 20, 24, 28, 47, 34, 25,
+   -15, -11, -23, -26, -44, -33, -17, -9, 0, -6, -5, 3, -1, -3, -1, -4,
+   7, 10, 24, 22, 21, 17, 27, 10, 16, 39, 43, 23, -3, 15, 0, -33,
+   -35, -17, -26, -10, -2, -1, 3, 4, 0, -1, -2, -3, 6, 16, 43, 27,
+   23, 30, 6, -2, -10, 15, 52, 24, 13, 31, 2, -7, -6, -13, -22, -1,
+   3, 11, 2, 0, 6, -1, -8, -2, 18, 25, 35, 34, 38, 33, 20, -3,
+   -23, 2, 24, 33, 23, 38, 12, 7, 9, 0, -25, 1, -6, -1, -2, -8,
+   -7, -2, -12, 1, 12, 18, 23, 20, 30, 28, 3, -3, -13, -1, 12, 17,
+   24, 6, 12, 9, -7, 8, -7, 2, 2, 1, 3, 2, 6, -2, 7, 9,
+   9, 13, 34, 7, 30, -5, -15, -14, -3, -6, 6, 15, 24, 8, 8, -2,
+   9, 3, 6, 7, 5, 2, -4, 5, -5, -5, -11, 6, 0, 11, 13, -2,
+   10, 12, 0, -3, 5, -6, 20, 28, 17, 13, 23, 11, -6, 14, 7, 9,
+   2, 4, 5, -3, 1, -4, -4, 11, 13, 3, -2, -10, 8, 1, -13, -14,
+   14, 12, 31, 16, 26, 17, 17, 17, 8, 3, 12, 5, 3, -4, 10, 0,
+   -10, -2, -6, 2, 6, -4, -16, -26, -9, -16, -16, -20, -16, -1, 11, 21,
+   23, 18, 19, 27, 10, 16, 13, 13, -1, 2, -1, -3, 0, -6, -11, 0,
+   0, -8, -14, -23, -9, -20, -37, -33, -48, -7, 9, 13, 33, 19, 15, 31,
+   -5, 15, 11, 11, 6, 3, 6, -2, -9, -5, 9, -2, -2, -14, -27, -16,
+   -26, -5, -23, -33, -31, -33, -4, 6, 37, 30, 22, 2, -5, 14, 11, 20,
+   1, -2, 3, -4, -4, 5, -1, 3, 0, -12, -11, -23, -14, -14, -3, -26,
+   -17, -27, -12, 17, 29, 27, 7, -2, -2, 4, 14, 16, 4, -5, 5, -5,
+   -2, 0, -4, -4, -5, -14, 0, -7, -11, -1, -2, -19, -16, 1, -4, 22,
+   39, 34, 28, 16, 6, 9, 6, 13, 8, 14, -6, -2, 4, 0, -6, 8,
+   -5, -7, -16, -8, -3, -4, -1, -10, -7, -13, -5, 16, 24, 38, 20, 5,
+   -1, 11, 4, 3, 1, 0, 4, 5, 2, -4, -7, 3, 7, 0, -24, -18,
+   -13, 0, 1, -17, -12, -18, -20, -4, 11, 30, 22, 16, -6, -7, -6, 10,
+   4, 3, 4, 0, -1, -4, -4, 0, -4, -15, -24, -24, -7, -11, -16, -15,
+   -6, -23, -20, -4, -3, -6, 3, -7, -17, 1, -1, 5, -1, 0, 3, 6,
+   4, 1, 6, 5, -3, 3, 1, 3, -3, 1, -3, -1, -6, 4, 2, -4,
+   -5, 2, -11, 6, 0, 0, -7, -1, 2, 5, -3, -2, 3, -4, -5, -7,
+   12, -2, -4, 1, -2, -3, 3, -5, -1, -19, -2, 1, 5, -4, -8, -2,
+   -7, -5, -7, -5, -8, -12, 3, -3, 6, -1, -9, -8, 0, 2, -1, -2,
+   -10, 1, -5, -8, 7, 0, -11, 11, -3, 0, -3, -5, -4, 2, -2, 4,
+   -4, -8, -7, -2, -3, 1, 7, -1, -9, -1, 1, -6, -7, -12, -10, -13,
+   -4, -3, -7, -6, -4, -1, 2, -5, -3, 2, -1, 5, 10, 7, -2, 1,
+   -1, 1, 0, -2, 4, 9, -7, -5, -2, -6, -5, -5, 1, 0, -3, -1,
+   6, -2, -5, 7, 2, 9, -6, 10, -7, -3, -3, 2, 2, 5, -2, -1,
+   3, -3, -1, -1, -4, 3, 0, -1, 4, -7, 1, 0, -3, 3, 1, 9,
+   -3, -1, -10, 1, -4, -2, -10, -3, -3, -3, 6, 1, 3, 4, 6, -7,
+   5, -1, 4, -1, -4, 4, -3, 0, 3, -7, -6, -2, 3, -1, -4, -1,
+   -5, -4, 6, -1, 13, 0, 4, 4, -1, 1, -1, -7, 0, -3, 2, -9,
+   -7, -2, -4, 5, -5, 1, 0, -4, -7, 6, -6, -2, 4, 10, 7, 7,
+   -3, 10, 4, 7, 8, -5, -11, 1, -3, 14, -8, 0, -3, 1, 5, -3,
+   10, 5, -4, -3, -10, -2, -2, 0, 3, -3, -1, 3, -1, -8, -2, -5,
+   -3, -3, -10, -4, -11, -1, -2, 0, 2, 1, 2, 0, 2, 9, 3, -9,
+   4, 0, -2, -2, -1, 5, 0, -6, 4, -2, 2, 4, 11, 2, 2, -4,
+   -4, -11, 4, 4, 3, -4, 0, -9, -4, 3, -2, -4, -10, 1, -3, 4,
+   -1, -9, -5, -10, -1, 9, -2, -3, 5, -11, -3, -1, -2, 1, -6, 2,
+   -2, -3, 4, -4, -8, -5, 1, -3, 5, -11, -4, 6, -3, -1, 0, 0,
+   1, -7, 0, 6, 10, 0, 3, 2, -2, -2, 1, 3, 2, 5, 4, 3,
+   0, -5, -9, -3, -2, 15, 2, 3, -4, 2, -5, -2, 8, -2, -5, 1,
+   1, 4, 0, 12, -5, -9, 3, 5, -6, -3, -9, 4, -3, 4, -3, -3,
+   2, -1, -3, -3, -4, 6, -6, 7, -1, 1, 8, 13, 1, 3, -7, 0,
+   -5, -6, -1, -3, -2, 4, 4, 1, -2, 5, -10, -14, 7, -13, 6, -2,
+   -2, -5, -2, 3, 6, 6, 6, 6, 4, -5, 0, -2, -6, -4, -8, 5,
+   -10, 8, 0, 2, -11, -6, 1, -1, -3, 4, -13, 2, -1, -1, 8, 12,
+   1, -2, 6, -1, -11, 2, 0, -6, -7, -11, -1, -3, -5, 6, -1, 3,
+   2, -4, -1, 0, -6, -8, -7, -4, -2, -4, -3, 3, 0, 2, -1, 1,
+   -6, -1, 7, -2, -6, -6, 0, 1, 1, -10, 9, 3, 0, -7, -4, -4,
+   0, -3, -7, 2, 0, 1, -8, -8, -3, 3, 0, -4, -5, -5, 2, -3,
+   -2, -2, -2, -4, -5, 6, 5, -1, 1, 2, 2, -13, -8, -3, -5, 1,
+   4, 0, 0, 2, -9, 3, 1, -9, 3, 1, -3, 4, -1, -7, 0, -11,
+   3, 1, 1, -2, 4, 10, 0, -2, -6, 1, -3, -3, -6, 5, -2, 2,
+   -1, -1, -1, -3, -4, 3, 1, 1, 10, 4, -11, 0, 0, 6, -7, -1,
+   -8, -2, -10, 5, -13, 8, -7, 1, -8, 0, 4, -3, -7, 5, 0, 1,
+   7, -6, 0, 5, -6, 1, -6, -4, 4, -8, 2, -9, -3, 6, 0, 0,
+   -11, -6, 1, 4, 5, 2, 4, -3, -2, 9, -6, -6, 7, -6, -1, -1,
+   -1, -5, -6, 0, -1, -6, 6, -1, -14, -10, -5, -6, 2, -1, 5, -3,
+   -2, 2, 5, 6, -6, -3, -2, -3, 1, -1, -20, -1, 1, 2, -2, -7,
+   -2, -5, 1, -2, 0, -5, -5, -5, -1, 6, -4, 1, -3, 10, -2, -4,
+   -7, 9, 0, 12, 7, -1, 5, 2, -4, -1, 2, -10, -1, 0, -6, -6,
+   -4, 1, -6, -2, -1, 0, 4, 1, -1, 0, -5, -1, 3, -1, -2, -2,
+   1, 3, -2, -1, -4, 6, -10, -6, 1, -1, 1, 0, 0, 0, 2, 2,
+   -13, 11, -2, 1, 7, 5, -1, 5, -3, 1, 4, 14, 6, -2, 4, -5,
+   2, 5, -6, -6, 5, -7, 8, -3, 0, -2, -8, -4, 5, 4, -2, -1,
+   -2, 2, -1, 4, 0, 0, -9, -1, -2, -4, 6, -5, 2, -2, 0, -1,
+   -5, -1, -1, 3, -7, -2, -2, 6, 5, 3, 0, -6, -1, 8, -4, -9,
+   8, -1, 2, 3, -7, 4, 8, -4, -5, -13, 3, -4, 1, -3, -6, -4,
+   -4, 1, -3, -4, -12, 7, 5, -9, 6, -4, 0, 5, -1, 2, 0, 3,
+   4, 10, -6, 1, 7, 3, 5, -1, 5, -7, -10, -2, 3, 2, 0, 7,
+   -6, -4, 8, 1, -3, -4, -5, 1, -4, 0, 5, 9, -4, -4, -6, 5,
+   4, -8, -1, -7, -9, -5, -5, 0, 2, -5, -2, -11, 0, 2, -4, 3,
+   -1, -2, -6, -3, -2, -2, -6, 0, -7, 4, 3, -5, -7, -3, 2, -4,
+   -4, 6, 3, 1, -4, -5, -10, -4, 1, -10, 0, 8, -2, -3, -3, 4,
+   0, -4, -2, -4, -14, 3, -3, -2, 5, 2, -1, -2, -17, -6, -1, 4,
+   -4, -3, -12, 2, -12, 8, -3, 0, -5, -2, 0, -6, 2, -5, -5, 9,
+   4, 4, -3, -7, 1, -8, -4, -2, -3, 3, -7, 5, -4, -8, 3, -3,
+   -1, 0, 1, 0, -1, 9, -6, 4, 6, -3, 0, 3, -5, 5, -7, -4,
+   -6, -2, -8, 0, 7, -6, -18, -3, -6, -2, 2, 0, 10, 0, 0, 6,
+   7, -8, 5, -4, 2, 0, -1, 0, 5, 6, -4, -11, 2, 2, 1, -9,
+   -10, -8, 3, -2, 4, -5, -1, -7, 6, -11, 9, -8, 6, 5, 7, -4,
+   -7, -2, -1, -1, 0, 1, -8, -5, -8, -8, 2, -8, -5, -9, 0, -10,
+   -7, 3, 0, 1, -1, 4, -9, -5, -10, -7, 7, -2, -8, -16, 1, -5,
+   -7, -3, 7, 8, -1, 1, 8, -3, -3, -5, -14, -8, -2, 0, 3, -8,
+   -7, -2, 2, 2, 1, 0, 6, 1, 3, -3, 11, -2, 2, -4, 0, -5,
+   -4, -5, -13, -1, -7, 0, -11, -1, 0, -1, 11, 8, -1, -3, -3, -7,
+   -14, -2, 1, -2, -2, 1, -7, -2, -11, -3, -6, -5, 2, -7, 4, -8,
+   -3, -5, -5, -3, -5, -5, -1, 0, 4, 1, -1, 2, -3, 9, -4, 3,
+   5, -2, -7, -2, 6, -1, 4, -1, -9, 3, -3, -1, 1, 3, -9, -2,
+   -1, -6, 2, 6, -1, 4, 2, 3, 1, -3, 2, -4, -1, 9, 0, 4,
+   -3, -4, 4, -1, -2, -4, -5, -5, -5, -11, -1, 6, 3, 1, 0, 3,
+   -10, -7, -5, -2, 2, -2, 7, 4, -6, 5, -2, 3, -1, -4, -5, -8,
+   -9, -8, -3, -2, -11, -8, 2, -9, -6, -4, -3, 1, -11, 5, 6, 7,
+   -5, -2, 7, 0, -7, -7, 12, 0, -2, 8, -9, -4, -2, 1, 1, -1,
+   -1, 6, -11, -8, -12, 2, 5, -2, -4, 1, -2, -4, -7, 0, -3, -6,
+   5, -2, 4, -5, -13, 8, -4, 5, -6, -2, -4, 3, -3, 1, -3, -13,
+   -6, -6, -1, -5, -4, -9, -3, 2, -1, 7, -4, 6, 1, -3, -5, -6,
+   0, -7, -8, 1, 1, -4, -7, -12, -7, -3, 0, -6, -6, 3, 13, 10,
+   5, -8, -4, 0, -2, -4, 4, 2, 0, -1, 9, 7, 0, -1, -3, 1,
+   -2, -4, 1, -4, 1, -6, -5, 5, -9, -2, -2, 5, -2, -1, 7, 3,
+   4, -5, 0, -1, -9, -1, 3, 4, 10, 11, 5, 3, 8, 8, 3, -7,
+   7, 3, -4, -10, -1, -6, 1, -6, -2, 14, -5, 2, 6, 1, -4, -2,
+   -1, 3, 11, 4, -2, 1, -17, -4, -3, 1, 1, -2, -5, -1, -4, 2,
+   5, -2, -6, 2, 2, 2, 10, -3, -5, -8, -2, -2, -6, 5, 9, -2,
+   10, -11, 1, 3, 0, -3, -5, 6, -11, 2, -12, -2, -5, 0, -2, 4,
+   2, -6, -3, 2, 9, -1, -2, 2, -2, 0, 7, -4, 2, -4, -12, 6,
+   0, -5, -6, -11, 2, -3, -14, -3, -6, -10, -4, -1, -1, -2, -4, 9,
+   4, -5, 12, 0, 14, -1, 3, -7, 0, -14, 5, -9, -13, -11, 2, -1,
+   -2, -5, -3, -6, 0, 3, -2, 0, -2, -1, -9, 0, -6, 7, 5, -2,
+   -6, 6, 4, -1, -5, -6, 3, -7, -9, -8, -4, -8, -4, -9, -2, -7,
+   -6, 1, -12, -7, -14, -3, -2, -4, -2, 3, 3, 9, 5, 2, 9, -6,
+   -2, 1, -5, 8, 8, -6, 10, 1, -5, -9, 0, -7, -4, -8, -13, -11,
+   -7, 4, -5, -3, 8, -3, -2, 7, 5, 0, 6, 4, -2, -4, -5, -5,
+   4, 1, -9, 1, 1, -9, -8, -3, -6, -6, -1, -7, -1, -1, 2, -1,
+   0, -1, 6, -6, 3, 7, -2, -3, 3, -3, 3, -4, 1, -11, -9, 2,
+   -9, -11, 2, 2, -3, 0, -2, -2, -4, -4, 2, 4, 2, -1, 4, -11,
+   -6, -1, -4, -4, -2, -3, -3, -4, -3, -6, 0, -5, 5, 0, 3, -7,
+   -1, -3, -2, -6, 4, -4, -1, 5, -6, -7, 4, -5, 2, 6, 8, 3,
+   7, 1, -5, -4, 0, 1, 4, 2, 5, -7, -1, -3, -3, -9, 0, -2,
+   1, 2, -1, 8, -2, -2, -11, -4, -4, -2, -1, -3, -2, 0, -4, -7,
+   -5, 0, -6, -7, -2, 4, -6, -4, -10, 0, -10, 2, 4, -2, -1, 15,
+   0, -3, 5, -4, 1, 1, 4, 9, 3, 2, 6, 1, -5, -11, -1, 9,
+   -7, -9, -1, -3, 0, 0, 13, 1, 12, 1, 4, -3, 6, 1, -4, 2,
+   6, -3, 7, -1, 1, 11, 4, 3, -3, 4, -17, -13, 1, -4, 4, 4,
+   -6, -11, 3, 3, -13, -3, 5, 0, -3, 3, 4, -1, 1, -15, -2, 1,
+   0, -4, -7, -5, 4, 6, -3, -3, 4, -1, -3, -3, 4, -4, -8, -3,
+   -1, 10, 3, 2, 1, -3, -1, -4, -3, 2, -1, -9, 3, -9, -10, 9,
+   0, 2, -1, 2, 2, 6, -4, 3, -10, 3, 11, 4, -1, 0, -1, -1,
+   5, 0, -1, -9, -3, 1, -11, 1, 3, -4, -1, 5, 8, 8, -12, 1,
+   5, 0, 7, -2, 4, -5, 4, 7, -3, 1, -6, 3, -7, -7, 2, 0,
+   1, -3, -1, 1, -4, -5, 6, 0, 4, 0, -1, 5, -1, 2, -7, 0,
+   2, -12, -4, 3, -4, 2, -1, -9, 8, 2, -3, 5, 0, 3, 0, 0,
+   -2, -6, 0, 9, -3, -11, 0, 1, 6, -4, -1, 2, -1, -13, 5, -5,
+   2, -1, -8, -10, 7, -6, 3, -1, -4, -2, 5, 4, 1, 1, -5, 6,
+   0, 5, 6, 5, 3, 8, 5, 5, -2, -8, 0, -4, 2, -5, -3, -1,
+   -1, 4, 1, 0, -5, 0, 1, -4, 3, -10, -9, -2, -2, 2, 5, 4,
+   5, -7, -1, -8, 4, 2, -8, 7, 1, 9, 2, -10, 5, -7, 2, 7,
+   2, 4, -8, 0, 7, -2, 4, 0, 2, -5, 1, -3, -8, 11, 0, -3,
+   0, -2, -2, 1, -2, 0, 1, -3, 0, 8, -2, -1, 0, 4, 7, 12,
+   -2, -1, 0, 1, -5, -3, -7, 3, 3, -1, -3, 7, -2, -3, -5, 5,
+   0, 9, 2, -11, 1, 1, -6, -5, -5, -8, -6, -5, -5, -4, 4, -2,
+   -2, 7, 7, -5, -4, -6, -9, 5, -1, -6, 9, 2, -9, -11, 1, 6,
+   0, -2, -9, 0, 6, 0, 6, 4, 4, 4, -4, -2, 2, -1, 2, -9,
+   6, 3, -1, 0, -2, -4, -4, -2, -4, -1, 1, -4, -1, 0, 11, -3,
+   0, -8, 2, -11, 7, -4, 9, 1, -1, -8, 2, -10, 0, -5, 8, -6,
+   -6, 7, 13, -4, 6, -5, 1, -6, 8, -3, -1, 0, 0, 2, -4, -7,
+   -8, -6, -5, -1, 0, 1, 1, 2, 3, -2, 4, -3, -5, 2, 2, -8,
+   7, -4, -6, -3, -1, -4, -2, -8, 1, 0, 6, -3, 1, -4, 1, 3,
+   -4, 0, 2, 0, 7, -7, 2, -2, 3, 2, -7, -6, -5, -10, 4, 3,
+   0, -2, 4, -1, 2, -5, -5, 0, -1, -5, 2, -6, -10, 6, 0, -3,
+   -8, -7, 3, 2, -1, -2, -7, 7, -2, -12, -1, 0, -2, -6, 2, 9,
+   -4, 2, 0, 6, -6, -4, 2, -1, -4, 0, -1, 4, -6, 0, -4, 0,
+   0, 1, -1, 4, 4, -3, -6, -8, 8, -3, -1, 2, 10, 0, 2, 4,
+   -6, 7, 2, 5, -3, -2, 1, 5, -2, -4, -6, -6, -2, 10, 9, 1,
+   1, -1, 1, 7, 0, 6, -2, -5, 3, 8, 5, 0, -6, -7, -9, 4,
+   -3, 6, 4, 2, 0, 4, -4, 8, -1, -5, -5, 1, 4, 0, 5, 2,
+   -1, 0, 2, 1, 4, 0, -3, -6, -3, -3, -7, -6, -1, 3, -5, 8,
+   4, -1, 6, -7, 1, -7, -3, -1, 0, 2, 1, 5, -1, -1, 4, 4,
+   -1, 4, 2, 4, 0, -1, 4, -1, -2, -4, -1, -4, -7, -1, -8, 1,
+   -4, 6, -1, -7, 7, 7, 1, 1, 3, 4, -5, 2, -1, 4, -9, -2,
+   10, -3, 5, -5, -7, -6, -8, -2, -2, -3, -8, 3, -2, -5, -3, 3,
+   2, -2, -7, 5, -3, -2, 0, 2, 3, -5, -2, 0, 6, -6, -1, -6,
+   4, 3, -8, -3, 6, -6, 2, 0, -1, -2, 0, 5, -6, 4, 5, 11,
+   2, -2, -1, -1, -2, 2, 0, 8, 3, -1, -2, -6, -1, -2, 6, 0,
+   -8, 0, 2, 0, -8, 3, 2, -9, 3, -2, -10, -1, 4, 3, 3, -1,
+   -11, 4, -4, -14, -7, -5, 5, 1, 4, -6, -9, 0, 1, -8, 0, 4,
+   9, 20, 8, 7, -6, -16, -1, 1, 1, -6, -7, 2, 6, -4, 4, -1,
+   -17, -1, 10, 9, 4, 10, 16, 13, 1, -7, 1, 10, 7, 12, 16, 12,
+   2, 1, 5, 4, 13, 0, 0, 5, -6, 4, 7, 5, -6, 4, 14, 9,
+   12, 11, 15, 11, -4, 5, 3, 3, 11, 9, 11, 10, 21, 7, 6, -4,
+   -2, 1, 0, 0, -4, 4, -6, 3, -14, -9, -4, 3, 13, 22, 20, 13,
+   17, 15, -1, 13, 20, 18, 19, 15, 22, 6, -6, 5, 9, 8, 6, 11,
+   5, 0, -7, 2, -14, -7, 3, 7, 12, 28, 23, 2, 9, 10, 7, 11,
+   13, 19, 22, 9, 21, 2, 13, 2, -3, 6, 4, 1, 6, -1, 2, 9,
+   -10, 0, 10, 5, 6, 8, 24, 12, 21, 19, 19, 35, 23, 19, 26, 14,
+   29, 4, 17, 2, 4, 6, -1, -7, -1, -4, 8, 2, -8, -3, -1, 11,
+   17, 14, 18, 11, 6, 22, 30, 22, 21, 19, 21, 5, 6, 4, 3, -2,
+   0, -9, -5, -8, -2, 5, 5, -6, -9, -14, 6, 1, 11, 10, 13, 4,
+   7, 25, 17, 17, 31, 5, 2, -5, -5, -2, 0, -11, 7, -1, -3, -4,
+   -11, 1, -1, -1, -15, -13, -13, -4, -3, 9, 0, -9, 0, 8, -6, 11,
+   15, 3, 0, 11, -5, -7, -2, 0, -4, 5, -8, 2, 1, -5, 8, -1,
+   -1, -10, -7, -10, 3, -6, -5, -10, -13, 2, 3, 21, 18, 6, 13, -5,
+   -5, 3, 3, -5, -4, 1, -3, -1, 1, -4, 4, 3, -15, -13, -9, -13,
+   -6, -19, -13, -13, -7, 4, 6, 33, 25, 11, 4, -9, -15, -1, -3, 10,
+   -4, 8, 2, -2, 1, -4, -3, -8, -11, -23, -13, -26, -18, -24, -18, -24,
+   -11, 10, 14, 26, 8, 7, -2, -9, -14, -2, 9, -5, -7, -2, 0, -2,
+   3, 4, 7, 0, -10, -21, -16, -31, -29, -21, -29, -29, -5, 0, -3, 13,
+   5, 0, -5, -19, -25, -10, -4, 3, -11, 9, 2, -4, 3, -10, -3, -7,
+   -13, -20, -21, -29, -36, -39, -27, -15, -15, 2, 11, 0, 0, 2, -4, -23,
+   -21, -6, -5, -3, 6, 1, -3, -4, -8, 1, -7, -4, -8, -2, -25, -22,
+   -38, -47, -28, -17, -3, 10, 5, -6, -14, -14, -7, -34, -23, -5, -10, 5,
+   -5, 1, -3, -5, -3, -2, -4, -1, -16, -15, -12, -26, -38, -36, -35, -14,
+   -6, 12, 9, -3, -8, -9, -19, -30, -26, -4, -5, 8, 4, 0, -4, 1,
+   -5, -7, -6, -4, -13, -25, -20, -21, -37, -45, -25, -7, 5, 20, 0, -12,
+   -3, -15, -19, -31, -27, -5, -10, -2, -1, -4, -8, -1, 3, 2, 1, -6,
+   0, -7, -7, -20, -28, -20, -24, -5, 0, 21, 27, 10, -5, -21, -26, -26,
+   -24, -11, -7, -8, 7, 3, -7, -6, -2, 3, 7, -7, -13, -11, -15, -5,
+   -20, -29, -17, -4, 19, 31, 30, 20, -9, -35, -21, -26, -13, -14, -7, -4,
+   1, 2, 6, -1, 5, 3, -2, 0, -15, -11, -4, 0, -14, -28, -23, -9,
+   9, 24, 15, 3, -14, -33, -22, -31, -14, -12, -3, -8, 2, 1, -4, -3,
+   -5, -7, -3, 6, -14, -14, -4, 0, 0, -16, -21, 9, 33, 24, 24, -9,
+   -15, -37, -19, -18, -17, -5, -1, -13, 2, -5, 12, 3, -1, 1, 5, -10,
+   -21, -16, 8, -13, -6, -17, -14, 10, 39, 30, 24, -8, -16, -12, -14, -15,
+   0, 1, -15, -9, 6, -5, 2, 2, -7, -1, 2, 7, -15, 1, -2, -10,
+   -17, -22, 0, 17, 47, 27, 17, 2, -2, -9, -6, -4, 2, -6, -8, 7,
+   3, -1, 2, 2, 7, 2, 0, -4, -6, -3, 3, -14, -2, -7, 12, 20,
+   23, 15, 12, 16, 14, 4, -1, 6, -2, -1, 3, 6, -2, -1, 7, -3,
+   -2, 1, 2, -13, -4, 6, 4, 6, 12, 8, 8, 6, -6, 2, 12, 13,
+   4, 3, -13, 4, 4, 6, 3, -3, 0, -1, -6, 0, -1, -8, 8, 5,
+   1, 4, 6, 6, 13, 23, 19, 13, 4, -6, 10, -6, 4, 3, -8, -1,
+   2, -5, 10, 5, -1, -1, -2, -4, -3, -3, -3, 4, 6, 16, 3, -3,
+   -3, 5, 6, 8, -7, -14, -10, 1, -3, -5, -5, -2, 5, 4, 4, -1,
+   5, -3, -1, 1, 11, -7, 5, 2, -4, 13, -4, 6, -3, -2, -8, -5,
+   -4, -14, -4, -4, -17, -2, 0, 1, 16, -5, -1, 1, -11, 3, 5, -3,
+   -1, 7, -7, -6, -1, -15, -18, -10, 11, 9, 0, 7, -3, 14, 24, 20,
+   18, 15, 12, 2, -21, -20, -13, -2, 2, -3, 6, -4, -9, -2, -16, -8,
+   8, -7, -8, 14, 22, 2, 8, 5, 2, -1, -4, -7, -9, -2, 1, 18,
+   0, -25, -16, -6, 5, 9, -1, 4, 5, -4, -11, 9, 6, 4, 10, 11,
+   31, 3, 6, -8, 21, 10, -10, -7, -15, -14, -8, 17, 5, -25, 0, -1,
+   5, 1, 0, 6, -2, -5, -10, 0, 3, 11, 7, 18, 13, 4, 9, 27,
+   16, 2, -2, 9, 0, 12, 2, 26, 4, -21, -9, -1, 0, -1, 6, 2,
+   -6, 1, -13, -4, 9, 10, -16, 30, -1, 0, 3, 6, -5, -7, -12, 10,
+   -1, 11, 22, 29, 14, 1, -10, 0, 11, -2, 1, -1, 4, -9, -6, 3,
+   16, -3, -11, 22, -10, -22, -28, -36, -17, -16, -10, 21, 15, -2, 22, 21,
+   16, 8, 21, -2, 6, 7, 9, -1, -2, 5, -1, 11, 13, -4, 5, 26,
+   9, -24, -14, -39, -47, -39, -21, 10, 11, 15, -6, 16, 27, 0, 10, 7,
+   -1, 3, 3, -8, -10, -1, -11, 3, 5, 5, 9, 20, 17, -7, -15, -19,
+   -48, -56, -33, 9, -6, 5, -9, 0, 23, -5, 17, 1, 0, 3, 6, -4,
+   0, 2, -2, -3, 11, 8, 19, 29, 10, 5, 22, 4, -19, -51, -22, 15,
+   -9, 8, -15, 2, 12, 6, 15, 6, 7, 1, 4, 5, -7, -2, -4, -7,
+   -4, 7, 13, 31, 18, 17, 38, 30, -10, -56, -26, -6, -17, -8, -14, 4,
+   17, 16, 19, 10, -1, 6, -4, 12, 3, 4, -6, 5, 8, 18, 21, 28,
+   29, 29, 47, 30, -28, -62, -73, -33, -26, -15, 3, 2, 28, 13, 14, 12,
+   9, -1, 0, 8, 7, 8, -12, 0, 12, 22, 19, 31, 24, 32, 38, 31,
+   -30, -76, -76, -56, -33, 1, 21, 32, 40, 36, 26, 10, 1, 2, -7, -9,
+   3, 9, -15, 5, 4, 22, 21, 29, 30, 43, 45, 26, -26, -74, -74, -61,
+   -19, 3, 20, 62, 45, 29, 26, 6, 5, 8, 5, -2, -1, -7, -10, 0,
+   23, 22, 23, 41, 32, 41, 23, 3, -4, -41, -77, -42, -19, -7, 14, 59,
+   40, 35, 20, 1, 7, -1, 4, 7, 0, 7, -14, 8, 20, 25, 25, 22,
+   30, 37, 35, 24, 13, -38, -53, -31, -1, 3, 13, 28, 34, 37, 12, 8,
+   0, 2, 3, -17, 1, 1, -11, 3, 23, 21, 25, 36, 28, 35, 25, 40,
+   31, 9, 0, -6, 15, 3, 10, 19, 20, 32, -9, -4, 7, 3, -5, -4,
+   2, 1, -12, 2, 12, 24, 21, 19, 27, 17, 44, 60, 57, 47, 23, -2,
+   6, -5, -6, -25, -6, -6, -24, -21, -6, -4, 7, -7, -6, 2, -18, -3,
+   18, 18, 30, 25, 13, 12, 42, 70, 62, 38, 21, 14, 8, -2, -13, -31,
+   -11, -8, -21, -15, -3, 10, 5, 1, -3, 0, -7, -7, 2, 6, 4, 12,
+   -11, -5, 28, 57, 58, 35, 12, 3, 13, -4, -17, -30, -23, -17, -30, -18,
+   -8, -4, -10, -2, -2, -8, 0, 3, 7, 13, 3, -11, -32, -13, 11, 53,
+   56, 31, -8, -17, 6, -10, -40, -22, -25, -36, -36, -13, -7, 1, -5, -4,
+   0, 7, -7, -3, 8, 0, -11, -17, -37, -35, -1, 26, 24, 24, -23, -35,
+   -10, -19, -16, -26, -24, -32, -19, -8, 0, 6, 4, 2, -5, -8, -12, 2,
+   3, -3, -24, -27, -42, -38, -7, 11, -11, -12, -41, -44, -31, -29, -18, -22,
+   -37, -33, -23, -9, -3, 11, -5, 0, 6, -2, -7, -5, -2, -7, -34, -22,
+   -33, -45, -35, -28, 7, 4, -26, -27, -16, -16, -31, -14, -24, -17, -7, -17,
+   4, -2, -6, -2, -3, 0, -9, -1, -10, -12, -8, -4, -9, -36, -14, -12,
+   6, 12, -1, -25, -19, -31, -28, -12, -17, 4, -3, 4, 1, 3, 2, -6,
+   -6, 7, -2, 7, -1, -6, -5, 6, -12, -35, -60, -31, -4, -5, -5, -39,
+   -44, -37, -21, 4, -6, 11, 6, -4, 6, 3, 4, 0, 8, -1, -14, 0,
+   11, -8, -11, 2, -24, -37, -51, -30, -8, -7, -8, -25, -35, -24, -6, 20,
+   20, 23, 19, 13, 5, -1, -3, -9, 5, -1, -6, -5, 7, -1, -15, 8,
+   -18, -34, -46, -17, -3, -15, -13, -34, -27, -30, 4, 26, 37, 35, 23, 9,
+   1, -8, 3, 2, -1, -3, -4, 0, -1, -12, -15, -5, -12, -29, -27, -9,
+   0, -3, -6, 3, -20, -7, 18, 41, 44, 34, 30, 5, -3, 0, 0, 6,
+   -9, -2, 6, -16, 7, -6, -9, 2, -4, -4, -13, 1, -3, -2, 1, -8,
+   6, -6, -4, -5, 1, -3, 0, 2, -9, -1, -7, -8, 4, 8, 7, -2,
+   -7, -5, -2, -7, 2, 1, -1, -7, 0, -6, 3, -1, -6, -4, -7, -2,
+   -2, 2, -2, -10, 11, 1, 3, -2, -2, -1, 2, -3, 2, -5, -5, -3,
+   -3, -5, 4, 1, -1, -4, 3, -3, -9, -7, 2, -2, 1, 4, -2, 3,
+   -1, 7, -4, 4, 8, -4, -3, -4, 5, 7, -2, -5, -3, -5, -8, 2,
+   -4, -5, -5, 1, -5, -4, 1, -3, -9, 1, 4, -2, -5, 10, -14, -3,
+   -4, -2, -9, -9, 7, 2, 0, -3, 18, 7, -2, 0, -2, -2, -4, 2,
+   -4, -8, 4, 14, 3, -2, -2, -5, 4, -2, -4, -6, 2, 1, -5, 0,
+   10, -7, 1, -11, -7, -10, -2, -6, -8, -3, -2, -20, 1, 6, -13, 1,
+   1, 1, -1, 4, -4, 1, -1, -7, -3, -1, -5, -11, -14, -2, 0, -2,
+   -10, -12, -3, -7, 5, -7, 5, -6, -7, 0, -5, -8, -5, 0, 1, 6,
+   3, 2, -1, 4, 3, -6, -9, -1, 2, -11, -6, 2, -3, -5, 1, 5,
+   -2, -2, -15, -5, 2, -7, 1, -7, -1, -11, -1, 1, 1, 7, -7, 5,
+   0, -1, -6, 13, 0, -7, 3, -6, 1, -4, -11, -1, -1, 1, 2, 2,
+   -1, -2, -10, -6, 0, 4, -1, 5, 8, -5, -1, 4, -1, -4, 2, 3,
+   0, 15, -8, -1, -2, 10, -12, 1, 2, 2, 7, 1, 11, -1, -5, 3,
+   2, -1, 5, 1, 0, 2, 3, 0, -4, 3, 0, 0, -4, 0, -11, 0,
+   -10, -10, -10, -6, 1, -1, -6, -15, -4, 3, 2, -8, -8, -10, 2, 4,
+   -6, 0, -9, -8, 6, 2, 7, -3, -10, 4, -2, 2, -5, -4, -4, -4,
+   -7, -10, -3, -2, 1, -4, 3, -3, -3, -2, -5, -1, 1, 5, -6, -7,
+   -1, 6, 0, -2, 9, 2, -1, 4, -1, 2, -3, -1, -1, -1, -2, -3,
+   -1, -4, 1, 1, -2, 0, 7, 3, 3, -1, 6, -1, -4, -2, 3, -4,
+   -5, -2, -5, -2, 6, -12, -1, -2, -12, -10, -3, -6, -7, 3, -11, 3,
+   -1, 6, -4, -5, -6, -10, -4, -6, 5, -6, -9, 1, 1, -2, -8, -3,
+   -4, 1, 5, -1, -2, -5, 3, 1, -4, 3, -5, -5, -11, -1, 6, 8,
+   -3, 5, -9, 3, 0, 4, -3, -5, 0, -4, -8, -3, -9, -4, -7, 1,
+   -2, -6, -2, 2, -2, -4, -3, -9, -10, -1, 3, -5, -4, 0, 6, -8,
+   6, -2, -9, -1, -1, -5, -3, -16, -8, -1, 5, -1, -2, 0, -2, 1,
+   -6, -2, 2, -11, -4, -6, -2, -4, -7, -3, -1, 0, 9, 1, -6, 9,
+   -2, 0, -10, -6, 1, -2, -7, 5, 6, 3, 5, 4, 3, 0, -14, -10,
+   3, 4, -4, -6, -2, 7, 3, 6, 2, 6, -13, -2, -3, -3, -5, 5,
+   9, -6, 2, -9, 0, -1, -2, -1, -10, -8, -7, -3, -3, -6, 1, 5,
+   -6, -6, -1, 5, 8, -5, 0, 5, -5, -4, -1, 0, -2, -7, -3, 4,
+   -3, 5, -7, 2, -9, -8, -6, -2, -2, 1, -3, -1, 1, -7, 9, -2,
+   -7, -7, -4, 4, 3, 2, -6, -3, -2, -11, -5, -1, 2, 3, -5, -1,
+   -4, -5, 1, -5, 2, 3, 9, 9, -10, -8, -3, 0, -6, -1, 11, 9,
+   19, -6, 6, 5, -6, -2, -6, -8, -9, -3, 8, 8, -5, -9, -11, -6,
+   4, 7, -8, 5, 0, 5, -3, 2, -2, 0, 0, -3, 5, -6, -4, 0,
+   -11, -10, 1, -2, -8, 3, 2, -9, -3, -1, 2, -2, -7, 0, 3, -6,
+   0, -2, -11, 3, 2, 4, 4, -3, 1, -4, -2, -2, 2, 2, 0, 1,
+   -3, -2, -4, -9, -14, -3, -2, -3, -12, -5, -4, 7, -5, 10, 1, 8,
+   4, 2, 2, -5, -4, -9, 0, -8, -4, -6, -8, -6, -6, 2, -8, -2,
+   4, -1, -12, -8, 3, 2, 6, 4, 6, -2, -1, 3, 1, 3, 3, -6,
+   -1, 12, -5, -6, 2, 0, 0, 1, -9, -5, -10, -8, -7, -1, -9, -1,
+   1, 3, -1, 4, -6, -2, 4, -3, 0, -7, -4, -5, -8, 1, -3, -8,
+   4, -1, 4, 3, 3, 0, -2, -9, -7, 2, 2, -1, 3, -5, 3, 0,
+   -1, -7, 2, 0, 1, 4, -1, 4, 3, -1, 3, 8, 3, -2, -2, 0,
+   3, 6, -4, 2, -6, -10, -7, -8, 0, 5, 4, 5, -1, 0, -4, -1,
+   -6, 1, 2, -5, 7, -1, 0, -14, -3, -8, -12, -4, -6, 0, -5, 12,
+   2, -2, 11, 8, 16, 1, 3, 8, 1, 2, -9, 0, -3, 2, 3, -10,
+   3, 3, -12, -6, -11, -7, -8, -3, -6, -8, -9, 3, -2, -6, -10, -6,
+   15, 5, -4, 9, 1, -2, 3, -1, 3, 0, 7, 5, -6, -7, -12, -15,
+   -20, -17, -6, -17, -15, -3, -8, -2, -3, 1, -8, -3, 8, 5, -2, 5,
+   6, -1, -2, 5, -4, 0, 2, 0, -6, -15, -10, -17, -15, -10, -6, -2,
+   0, -2, 5, -3, 0, -9, -8, -12, -6, -4, 0, 1, 14, 0, 0, -3,
+   0, -3, -12, 5, 1, -6, 6, -14, 10, -2, 3, 20, 12, 17, 16, 1,
+   3, 3, -6, -5, -4, 6, 3, 20, -7, 0, 0, 2, -4, 2, -12, -7,
+   -8, -3, -10, -13, 9, 4, 15, 11, 12, 9, 8, 5, -13, 4, 0, -4,
+   -9, 3, 8, 6, 0, 8, -1, -3, 5, -12, 6, -5, -1, -1, -9, -4,
+   1, 4, 18, 18, 25, 19, 8, -7, -12, -16, -6, -7, -4, -3, -5, 6,
+   -3, -6, 5, 0, 5, -4, -2, 3, -4, -10, -8, 3, 2, 14, 11, 21,
+   29, 22, 15, 11, -8, -16, -20, -9, -16, -6, 0, 8, 8, -3, 2, 10,
+   -3, -2, 7, 1, 1, -4, -7, -6, -18, 5, 1, 10, 10, 19, 25, -1,
+   -6, -19, -11, -17, -7, -1, -8, 6, -11, 3, 4, -1, 0, 7, 7, -4,
+   11, -2, 0, -10, -12, 0, -1, 5, 12, 27, 8, 8, -5, -12, -14, -19,
+   7, -6, -1, -9, 7, -3, 2, -1, -4, -5, 1, 1, 2, -1, -6, -7,
+   -14, -11, -13, -1, 10, 23, 8, -6, -2, -19, -25, -23, -4, -7, -3, 9,
+   -1, 3, 2, 3, 0, 6, 0, 14, -6, -5, 7, -5, -8, -8, -10, 11,
+   9, 21, 9, -5, -11, -20, -16, -4, 0, 8, -6, 0, 6, -4, -11, 3,
+   8, -4, -4, -2, -2, 2, 0, -7, -6, -7, 0, 7, 9, -2, 7, -7,
+   -14, -11, -17, -17, -5, 2, -4, 1, 5, 3, 6, 5, 1, 2, -2, 0,
+   3, -5, -7, -10, -12, -2, 4, 6, 15, 8, -1, -2, -17, -21, -20, -25,
+   -9, -4, 0, -7, 1, -1, 11, 4, 3, -5, 5, -7, 3, -7, -11, -5,
+   -3, -4, 7, 1, 8, 18, 22, -7, -14, -31, -26, -32, -17, -3, -2, 14,
+   8, -5, 0, -3, -2, 7, 11, -1, 4, 3, -4, 2, -17, -9, 8, -1,
+   11, 7, 16, 23, -15, -12, -31, -24, -14, -11, -6, 7, 2, 3, -6, 2,
+   -13, 0, 5, 0, -2, -4, 1, 1, -9, -11, -2, 9, 21, 21, 33, 15,
+   0, -20, -14, -26, -11, -3, -7, 6, 1, 9, -7, 8, -1, 4, 4, -1,
+   3, -1, -8, -4, 0, -3, 13, 6, 12, 14, 12, 18, -3, -4, -14, -34,
+   -2, -3, 4, 5, 5, 1, 4, -2, 4, 6, -1, 5, -1, 4, 3, 0,
+   -15, -3, 1, -3, 4, 17, 29, 14, 17, -2, -8, -30, -9, -4, -4, 1,
+   5, 1, 5, 12, -1, 2, 9, -1, 3, -6, 3, -6, -20, -9, -7, -14,
+   1, 14, 4, 20, 19, 6, -6, -15, -11, 0, 1, 6, 1, 0, -9, 5,
+   -5, -6, 14, 1, 8, 2, 7, -14, -8, -22, -15, -7, -1, 5, 1, 12,
+   11, 2, -2, -20, -12, 2, 1, 3, 1, -1, -5, -5, 4, -1, -5, 7,
+   -2, 1, 12, -4, -9, -11, -19, -12, -15, -1, 2, 15, 20, 4, -2, -11,
+   -4, -10, -1, 0, 0, 0, 1, -5, -7, 5, -9, 1, 7, 3, 5, -2,
+   -10, -8, -14, -10, -21, -4, -2, 13, 8, 3, 4, -3, -12, -13, 4, 4,
+   10, 7, -3, -2, 0, -4, 9, -5, 6, 5, 8, 6, 7, -7, -10, -12,
+   -15, 3, 10, 13, 8, 6, -9, 0, -7, 0, -2, -7, -2, 2, -1, 1,
+   4, 8, 0, 7, 5, 12, 4, 4, 1, -1, -3, 6, 2, 9, 16, 14,
+   4, -3, -6, -1, 0, 6, 0, 4, 1, 4, -7, 2, 7, -3, -9, 8,
+   4, 2, 13, 8, 12, 5, 12, 0, 15, 7, 6, 3, 8, 17, 3, -5,
+   7, -7, -7, 10, 2, -2, 9, 0, -2, -6, 4, 4, 7, -4, 12, 8,
+   7, 14, 1, 3, 10, 0, 3, -4, 5, 6, -5, -6, 6, -11, 2, 2,
+   -3, -6, -1, -3, -1, 1, 4, 14, 1, 5, 5, 0, 8, 6, 4, 16,
+   4, 1, -6, 12, 5, 3, -2, 0, -5, 0, -7, -1, 5, 2, -1, -3,
+   8, -10, 4, -1, 3, 0, -1, -16, -4, 3, 7, 1, -4, -2, -5, -8,
+   -6, -10, 2, -11, -18, -11, 4, 3, -3, -1, -2, 2, 12, -4, -2, -1,
+   3, 6, 1, -2, 10, 19, 5, 10, 2, 7, 27, 15, 25, 26, 15, 12,
+   -9, -9, -6, -9, 0, -3, 1, -8, 4, -13, -2, 8, -7, 7, 0, -6,
+   -3, 4, 17, 22, 28, 15, 30, 20, 34, 46, 29, 30, -1, 0, -8, 1,
+   2, -8, 3, -1, -2, 0, 12, 2, -2, 5, 1, -2, 2, 14, 15, 20,
+   38, 24, 14, 21, 27, 29, 24, 16, 0, -7, -4, 2, 2, -2, -3, -7,
+   -4, 9, 12, 1, 1, 3, 6, -12, 12, 21, 12, 15, 8, 0, 6, 7,
+   21, 8, 5, 8, -9, -12, -6, -11, -5, 0, 3, 5, 1, 4, 6, 1,
+   -1, 3, 2, 3, 22, 18, 10, 0, -28, -23, -18, -5, 2, 10, 0, -5,
+   -13, -9, -4, -3, -3, -6, 1, 0, -3, 6, 2, -3, -4, 11, 6, -5,
+   11, 1, -5, -9, -16, -17, -29, -14, 1, 11, 9, 2, 5, -6, 4, 8,
+   6, -11, 6, -4, -1, 7, -4, 7, -4, 9, -4, -15, -15, -12, -1, 7,
+   5, -10, -17, -20, -14, -4, 2, -6, -12, -14, -9, 7, -8, 6, 2, -9,
+   4, 0, 3, 2, -11, 2, -1, -10, -1, 13, 10, 24, 25, 14, 2, -25,
+   -11, -13, -21, -25, -29, -18, -6, -2, -4, -7, 6, 2, -1, 4, 4, 0,
+   -5, 11, -11, -19, 3, 12, 21, 31, 34, 15, 20, -3, -27, -17, -23, -28,
+   -46, -22, -14, -4, 5, 0, -2, 6, 0, -3, 0, 2, -6, 0, -21, -10,
+   7, 14, 40, 49, 39, 39, 22, 13, -8, -19, -11, -35, -50, -22, -2, 0,
+   -8, 10, -2, 2, -4, 11, 4, 3, -8, -5, -12, -9, -3, 13, 30, 59,
+   44, 52, 23, 20, 3, -14, -11, -36, -34, -27, -18, -12, -5, 1, -9, -6,
+   1, -5, 5, 0, -8, -16, -13, -11, -14, 12, 35, 51, 53, 52, 44, 17,
+   13, -4, -9, -6, -30, -22, -10, 0, -3, 0, 4, 4, -5, -1, 10, 7,
+   -5, -4, -12, -27, -6, -10, 19, 33, 44, 51, 40, 24, 25, 23, 12, -7,
+   -27, -18, -4, -8, -4, -7, -7, 2, 2, -7, 0, -2, -17, -3, -21, -45,
+   -17, -31, -16, -5, 10, 19, 34, 14, 13, 21, 21, 6, -18, -13, 4, 3,
+   9, 7, -2, 0, -2, 0, 0, -12, -15, 11, -21, -36, -56, -53, -55, -36,
+   -28, -29, -16, -13, 3, 22, 25, 19, -10, -1, 12, 1, 0, -1, -4, 4,
+   -1, 1, 2, -17, -14, -1, -23, -43, -49, -70, -73, -57, -70, -65, -37, -30,
+   -17, 14, 18, 15, 1, -11, 8, 24, -7, 1, -8, 2, -4, 9, 3, -10,
+   -20, -8, -33, -41, -35, -63, -73, -65, -77, -62, -47, -35, -22, -7, 7, 25,
+   9, 10, 8, 7, 7, -1, -7, 6, -1, 4, -2, -9, -21, -11, -22, -34,
+   -23, -15, -28, -34, -47, -42, -24, -17, -6, -4, 12, 17, 15, 11, 11, 20,
+   3, 0, 0, 3, -6, -4, 9, -11, -16, -8, -20, -21, -3, -4, -5, -3,
+   3, 1, -13, -3, -2, -11, 2, 10, 3, 0, 11, 9, 6, 7, -4, 3,
+   3, -2, 1, 7, -15, -8, -13, -15, 0, 21, 9, 24, 25, 21, 3, -4,
+   -15, -13, -5, -5, 5, -2, 14, 9, 6, -8, 2, 1, -8, 4, 10, -11,
+   -11, -4, -8, -9, 13, 17, 30, 48, 48, 30, 10, 6, -16, -7, -12, -1,
+   -11, 6, 12, 12, 3, -1, -4, 0, 1, -8, 4, -3, -4, -8, 3, 10,
+   -1, 10, 26, 47, 34, 5, -2, -25, -23, -26, 9, 2, -3, 5, -5, 4,
+   0, 2, 3, -3, -7, -13, 1, 11, -8, 3, 1, 5, -6, 6, 1, 19,
+   10, 4, -9, -17, -1, -6, 8, 4, 3, 6, 1, -1, -5, -6, 6, 12,
+   1, 6, 7, 13, 10, 9, 9, -6, 7, -2, -3, 3, 0, 2, -3, -4,
+   6, 18, -6, -5, -6, -7, -3, 0, -1, -5, -6, 5, -2, 6, 4, -1,
+   0, 11, 4, -9, -9, -5, -3, -2, 0, 0, 0, -5, 10, 2, -7, 0,
+   -15, 4, -13, 5, -9, 9, 0, -7, 2, 11, -4, 7, 0, 9, 8, 0,
+   -3, -7, -16, -9, 0, -1, 5, -10, -5, 3, -8, -14, -8, -2, -4, 3,
+   -1, 5, 3, -1, 1, -5, 1, 6, -4, 3, 3, -1, 5, -5, 3, 1,
+   -8, -14, -4, -2, 1, -18, -15, -20, -14, -13, -12, 0, -1, -4, 5, -11,
+   1, 3, 4, 1, -10, 4, 27, 74, 73, 48, 26, 10, 10, 32, 39, 50,
+   64, 64, 53, 75, 82, 33, 16, 10, 2, -1, 6, -4, 3, -3, 10, 3,
+   -9, 4, 19, 51, 34, 9, 7, -4, -4, -14, -23, 10, 32, 49, 47, 56,
+   68, 42, 23, 2, 1, 9, 4, 0, 7, 2, -5, 1, -18, -1, 7, 26,
+   -11, -17, -8, -8, -19, -32, -25, -2, 4, 51, 59, 47, 57, 44, 7, 6,
+   2, -7, -3, -5, 3, -1, -9, 0, -18, -18, -9, -11, -33, -17, -23, -21,
+   -34, -34, -7, -12, 9, 31, 33, 39, 55, 36, 17, 15, 13, 2, -7, 5,
+   2, -1, 4, -13, -26, -23, -41, -33, -27, -22, -28, -24, 3, -4, -11, 9,
+   23, 29, 13, 15, 25, 25, 14, 5, -1, -5, -4, -1, 7, 0, 2, 5,
+   -32, -28, -46, -32, -45, -36, -22, -13, 7, 5, 27, 24, 39, 18, 4, -1,
+   -7, 2, -6, 7, 0, 3, 1, -5, 5, 8, 10, 2, -24, -28, -51, -36,
+   -35, -37, -39, -13, 7, 48, 14, 15, 31, -14, -18, -15, -19, -20, -5, -6,
+   7, 8, 1, 3, 0, -7, 6, 2, -13, -31, -42, -20, -39, -41, -42, -2,
+   40, 61, 38, 2, -4, -41, -32, -46, -31, -37, -22, -14, -2, -1, -1, -4,
+   12, -3, 1, 8, -3, -14, -31, -24, -42, -54, -43, -25, 70, 101, 41, -5,
+   -53, -46, -56, -58, -51, -50, -24, -11, -13, 8, 7, -7, 8, 8, 4, 0,
+   -3, -3, -24, -4, -27, -21, -17, 10, 97, 127, 74, -31, -73, -80, -84, -88,
+   -73, -59, -36, -12, -8, -3, -4, 5, 7, 9, 4, 5, 2, 7, -7, 21,
+   -6, -2, 13, 3, 63, 84, 45, -24, -63, -93, -108, -92, -60, -50, -28, -8,
+   -1, 4, -4, 3, 6, 3, -5, 7, 5, 23, 32, 49, 42, 30, 33, 8,
+   33, 36, -6, -39, -53, -63, -75, -69, -50, -49, -30, -12, 5, 5, 1, 0,
+   -5, -6, 0, 7, 13, 38, 37, 63, 51, 46, 33, 7, 19, -12, -21, -28,
+   -42, -62, -51, -64, -45, -53, -22, -8, -2, -8, 5, 2, -8, 4, -6, 3,
+   21, 38, 53, 61, 38, 33, -2, -14, -31, -56, -48, -36, -30, -42, -76, -55,
+   -32, -30, -26, -9, 1, 6, -1, 11, 2, -1, 6, -4, 25, 43, 49, 47,
+   23, 15, -20, 7, -23, -45, -39, -44, -31, -44, -58, -41, -23, -22, -8, 1,
+   3, 2, -6, 5, -2, 5, 9, 5, 10, 44, 36, 38, 17, -2, -17, -16,
+   -51, -67, -62, -34, -46, -47, -45, -17, -4, -15, -1, 2, 12, -3, -9, -2,
+   2, -5, -2, -5, 14, 35, 36, 49, 36, 17, 14, 1, -15, -32, -54, -25,
+   -8, -22, -11, -13, 26, 16, 5, 5, 0, 10, 0, -6, 6, 10, 3, -5,
+   10, 15, 20, 32, 24, 19, 32, 24, 33, -13, -12, -32, 29, 6, 4, 33,
+   17, 13, 6, 10, 5, 9, -1, 10, -2, 0, 3, 0, 2, 3, 7, 21,
+   42, 30, 25, 42, 40, 17, 27, 7, 28, 15, -7, 18, 28, 20, 19, 0,
+   4, 0, -8, -7, -4, -1, 1, -4, -8, 2, 10, 29, 25, 9, 13, 34,
+   51, 75, 57, 57, 40, -2, -11, 28, 30, 31, 21, 11, 8, 2, -1, -4,
+   5, -3, 12, 4, -12, -3, -8, 18, -7, -26, -20, -22, -1, 40, 28, 32,
+   30, -16, -15, 18, 39, 40, 21, 13, 4, 5, 1, 4, 13, -3, -6, 5,
+   -12, -16, -8, 2, -30, -73, -33, -53, -21, -14, 1, 23, 18, -7, -4, 21,
+   28, 39, 23, 12, 7, -11, -4, 4, 7, -2, 1, 8, -25, -19, -11, -21,
+   -66, -75, -67, -62, -37, -47, -21, 12, 3, 0, 2, 36, 56, 39, 17, 17,
+   4, 4, -6, -2, 5, -1, 2, 0, -13, -17, -11, -26, -63, -66, -60, -39,
+   -44, -55, -27, 5, 17, 26, 29, 33, 46, 26, 3, 6, 4, 0, -9, -1,
+   0, 0, 0, 1, -19, -18, -13, -10, -33, -44, -47, -31, 12, -24, -5, -25,
+   0, 4, 4, 2, 19, -11, -12, 11, 1, -4, -5, -4, 4, 0, 1, 0,
+   -26, -18, -22, -4, -29, -19, -14, -13, -5, -37, -19, -22, -17, -22, -25, -28,
+   -16, -14, -8, -2, 2, 3, -1, 4, -4, -2, 9, -3, -12, -14, 2, 22,
+   -2, -10, -2, 23, 8, 6, 2, 16, -3, -21, -6, -11, -8, -14, -6, -3,
+   14, -7, 1, 2, 2, -1, 8, 2, 0, -2, 31, 59, 46, 34, 18, -3,
+   18, -1, 12, 16, 27, 19, 19, 10, 19, -19, -11, -2, -11, -1, 1, 10,
+   1, 7, 6, -4, 2, 1, 8, 0, -5, 1, -7, -4, -8, 0, -2, -9,
+   6, -9, -3, -5, 4, 2, -2, 4, -1, -5, -5, 4, -1, 6, 9, 6,
+   -9, -2, 0, -2, -4, -3, -3, -7, 0, 3, -11, -7, -4, -2, 10, -6,
+   -4, -1, -5, -5, 4, 0, -5, 2, -6, 7, -8, -8, 4, 2, 1, -6,
+   -6, -1, -2, -2, -14, -5, -7, -8, -9, -4, -12, -9, -5, -6, 9, 2,
+   2, -1, -1, 2, 7, -5, -7, -2, 5, -3, 3, -7, -1, -5, -10, 0,
+   -9, -6, -2, 0, -6, 1, -4, 10, -7, -11, -5, 0, -2, -3, -7, -7,
+   -1, 4, 4, 5, -9, -1, -2, 6, -4, 3, -3, -1, -11, -9, -4, -4,
+   -3, -3, 2, -2, 2, -13, -5, 6, -2, -2, -1, -5, 3, 2, 2, 0,
+   -8, 0, 3, -12, 0, -5, -7, -2, -4, -6, 8, -6, -6, -7, 3, -12,
+   4, -2, 1, -4, 11, -3, 4, 3, 3, 5, -5, -1, -1, 7, -7, -5,
+   -4, 0, -9, 1, -1, -7, 3, -3, -14, 3, -4, -9, -1, 0, -4, 1,
+   4, -2, -3, 4, 3, 1, 2, 8, -5, -5, 0, 6, -8, -11, 1, -10,
+   -4, -10, -1, 1, -7, -12, -7, 2, -8, -5, 0, 5, 4, 2, -6, 0,
+   4, -1, -5, -1, -1, 5, -6, -2, -5, -3, -5, -5, -6, -3, -4, -3,
+   -4, -6, -6, -4, -5, 0, -6, 0, -10, -11, -2, 8, -4, 3, 5, -4,
+   0, 3, -3, 1, -4, -8, -10, -7, -6, 0, -11, -1, -4, -2, 2, -9,
+   -13, -4, 2, 1, -3, -7, -5, 7, 8, -4, -1, -5, 2, -11, 1, -7,
+   -7, -13, -14, -12, -5, -9, -2, -13, 3, 3, 0, 4, 3, 4, -5, 5,
+   -9, 6, -8, 2, -4, 2, 4, 3, 8, -3, 4, -4, -15, -11, -16, 0,
+   -11, -3, -2, 0, -11, -7, -8, -5, -8, -2, -3, 7, -9, 5, 8, 2,
+   4, -6, -3, 1, -3, -3, -5, 1, 0, 1, -1, 0, -6, -4, -5, -5,
+   -6, -6, -11, -11, -4, -5, 1, 5, -2, 4, 2, -3, -3, 2, -4, 1,
+   3, -2, -8, -2, -13, 0, -10, -7, -6, -5, -15, -2, -12, -20, -7, -5,
+   2, -5, -1, 0, 12, 1, -3, -3, 1, 4, 7, 4, 0, -3, -9, -5,
+   2, -6, -5, -4, 3, -9, -7, 2, -5, -6, -7, -1, -4, -1, -3, 5,
+   5, -10, 1, 6, -3, -2, 0, 2, 0, 3, -1, -5, -1, 3, -6, -12,
+   -6, -5, 4, -4, -10, -16, -4, -13, -3, 3, 1, -1, 2, -8, 4, 0,
+   9, 1, -7, -3, -4, 1, -1, 1, -5, 1, -8, 8, 6, 3, 3, 1,
+   -11, -4, -3, -7, -12, 4, -11, 4, -4, 7, 2, 10, -7, 1, 3, 5,
+   3, -7, 2, -2, 1, 0, -16, 4, 3, 2, 7, -12, -3, -13, -15, -12,
+   -8, -13, -5, -2, 4, 2, 2, -3, -7, -2, 9, -4, 3, 5, -1, 2,
+   4, -4, -4, 3, -4, -11, 0, -7, 3, 8, -10, -13, -4, -7, -3, -2,
+   0, 0, -9, -5, -2, -1, -7, 2, 3, -6, -5, -1, -3, 4, -9, -1,
+   3, 1, -3, -7, -3, -2, -10, -13, -9, -4, 2, 8, 3, -5, 3, -6,
+   -3, -2, 2, 4, 0, 4, 0, -12, -12, -3, -5, -3, -7, -2, -3, -8,
+   -3, -6, -14, -7, -4, 2, 3, -13, -2, 3, -7, 7, -2, 7, 9, 0,
+   4, -5, -4, 1, -2, -10, -1, 1, 0, 2, -2, -7, -16, -10, -5, -2,
+   2, 7, -3, -5, 4, 2, -3, -4, 2, 3, -5, -3, 2, -7, -16, -4,
+   -6, -2, 2, -6, -14, -2, -1, -5, -7, -10, -3, -6, -3, -2, 8, 5,
+   -1, 5, 5, 6, 5, -2, 0, -3, 3, -12, -7, -2, 6, -1, -6, -3,
+   -2, -9, -5, 2, -8, 0, -14, -3, 4, 5, 6, -4, 6, -4, 0, -4,
+   1, -1, -1, 6, 1, -7, -10, -3, -6, -5, -3, -3, -3, 3, -9, -8,
+   -7, -5, -11, -5, -5, 0, -9, -5, 0, -6, 4, -6, -9, 6, 0, -4,
+   6, -5, -7, -1, 7, -5, -1, 0, -4, -5, -6, -12, -10, -12, -2, -3,
+   5, 5, -4, 1, -5, 2, -7, 8, 1, -1, 2, 0, 2, -7, 2, -2,
+   -3, 5, -2, 2, -3, 1, -11, -9, -6, -4, -3, -1, -7, -3, 6, 6,
+   4, 1, 0, 5, 6, 0, 5, 0, -7, 1, -6, -5, 3, -4, 4, -4,
+   -1, -6, -9, -13, -3, -8, -2, 4, -6, 6, 4, -1, -2, -3, 5, 0,
+   1, -9, -5, -1, -2, 3, -14, -7, -15, 4, 11, 3, 2, -17, -9, -21,
+   -19, -28, -32, -31, -41, -29, -3, -4, -2, 5, -3, -5, 4, -3, 1, 6,
+   7, -4, -7, -10, 13, 21, 21, 12, 1, 6, -17, -26, -21, -18, -16, -25,
+   -24, -18, -18, -17, -7, -12, 2, -7, 1, 6, 2, -3, -2, 15, 16, 18,
+   33, 40, 35, 33, 24, 21, 10, 14, 4, 0, -8, -5, -12, -4, -8, -6,
+   -4, 1, 2, -3, -8, 8, 3, -7, -2, 7, 17, 23, 38, 25, 24, 24,
+   7, 19, 6, -9, 20, 11, 7, 6, -9, 3, -5, -6, -4, -4, 4, -3,
+   0, -2, 2, -6, -2, 7, 2, 13, 26, 17, 22, 2, 7, 9, -10, -3,
+   14, 10, 2, 11, 8, 10, 15, -3, 0, -8, -2, 1, -9, -9, -5, -1,
+   7, -1, 15, 2, 20, 17, 8, -1, -9, -17, -19, -20, -5, 4, 8, 12,
+   12, 7, 10, -4, -7, 3, -1, 8, -1, 4, 2, 9, -11, -4, 7, -13,
+   4, 11, 22, -3, -9, -17, -23, -11, -7, 10, 0, 13, 24, 16, 11, 0,
+   -5, 1, 7, -4, 2, 5, -6, -9, -21, -4, -3, -7, -10, -2, 9, -19,
+   -35, -30, -14, 0, -1, 3, 10, 8, 9, 20, 10, 2, 3, 2, 6, 3,
+   3, 8, -3, -12, -13, -16, -15, -15, -3, 5, 3, -34, -50, -42, -25, -10,
+   9, 21, 12, 5, -1, 19, 4, 5, 5, 1, 1, -4, -3, 4, 1, -12,
+   -12, -12, -21, -29, -15, -5, -15, -32, -36, -15, -8, 12, 29, 32, 27, 21,
+   20, 16, 8, 10, -4, 3, -2, 1, -5, 3, -3, 0, -16, -25, -36, -37,
+   -26, -27, -29, -23, -6, 7, 14, 25, 31, 18, 33, 35, 8, 25, 15, 3,
+   4, -3, 2, 0, -7, 6, 1, -4, -13, -30, -43, -54, -44, -39, -28, -18,
+   15, 37, 22, 19, 23, 26, 25, 12, 11, 7, 14, 4, -4, 5, 1, -1,
+   6, 4, 3, -3, -17, -24, -35, -53, -47, -37, -41, -5, 26, 29, 47, 32,
+   31, 28, 30, 19, -12, 4, -2, -10, 10, -6, 0, 10, 2, 2, 0, -6,
+   -10, -23, -37, -44, -53, -37, -24, 12, 41, 47, 49, 40, 30, 17, 19, 15,
+   0, 7, -2, -5, -7, 2, 9, 3, -6, 6, -1, 3, -11, -13, -32, -28,
+   -16, -23, -8, 8, 19, 31, 33, 33, 39, 7, 12, 6, -5, -11, -7, -7,
+   -9, -4, -5, -8, -3, -3, -5, -10, -9, -9, -24, -27, -15, -26, -13, -19,
+   8, 33, 26, 15, 18, 10, 17, 4, -6, 0, 1, -1, 0, 8, -2, 3,
+   -6, -2, -1, -10, -15, -18, -12, -22, -22, -22, -29, -34, 1, 16, 25, 22,
+   21, 4, 4, 9, 1, 15, 13, -6, 0, 0, 9, -2, 1, -2, -2, 3,
+   -4, -15, -10, -10, -15, -19, -37, -26, -17, 15, 7, 4, 12, -2, 14, 23,
+   12, 14, 1, 0, 1, 1, 10, 10, -3, 2, 1, -7, -14, -15, 2, 3,
+   6, 8, -21, -31, -29, -24, -10, -15, -5, 3, 20, 18, 19, 8, 12, 3,
+   9, 4, 4, -1, 5, -5, 3, -4, -6, -5, 6, -9, 9, 6, 6, 2,
+   -21, -17, -22, -28, -24, -1, 7, 3, 10, 18, 11, 5, 8, 7, 2, 7,
+   -4, 0, -2, -5, -2, -10, -12, 4, 1, 12, 17, 12, 2, 3, -19, -11,
+   -16, 0, 4, 5, 0, 12, 2, -4, -7, 5, 10, 5, 6, -3, -6, -3,
+   -7, -13, 1, 6, 14, 10, 29, 16, 7, -10, -19, -23, -13, -2, -23, -16,
+   -12, -4, -15, -8, -8, -2, -1, 3, 1, 3, 5, -2, -5, 3, -6, 11,
+   13, 10, 25, 3, 5, -3, -6, -15, -16, -24, -24, -26, -18, -12, -17, -22,
+   0, -5, -5, -4, -9, -2, -2, -3, -7, 7, 3, 2, 10, 6, 8, 5,
+   2, -12, -11, -13, -14, -16, -24, -16, -24, -13, -26, -8, 5, 11, 9, 2,
+   -3, 0, -14, -5, -7, -14, -13, -8, 1, -3, 4, 13, 15, 16, -10, -7,
+   -10, -14, -6, -8, -19, -1, -8, -22, 1, 1, 4, -5, -3, -5, -4, -6,
+   -4, -11, -9, -7, -1, 3, -2, 0, 12, 14, -8, -13, -15, -14, -12, 0,
+   2, 6, -16, -17, 1, 5, -1, -2, -11, -6, 10, -2, -6, -10, -6, -21,
+   -7, -3, 2, 7, 9, 13, 6, -3, -10, -18, -23, -17, -16, -5, -14, -8,
+   -5, 8, -4, 2, 4, 0, 1, -9, -8, 0, -13, -21, -3, -15, -7, 3,
+   6, 2, -17, -13, -23, -21, -18, -11, -9, 0, -11, -11, -2, 2, -6, -10,
+   1, 5, -3, 3, -7, -18, -25, -43, -44, -38, -10, 2, 9, 3, 27, 28,
+   2, -10, -5, -5, 7, 15, 5, -2, 4, 3, -4, 0, -2, 6, 1, -4,
+   -3, -12, -17, -42, -51, -33, 3, 11, 38, 18, 31, 14, 11, -18, -23, -15,
+   -25, 6, -4, -1, -6, 12, 0, -3, -2, 0, 2, -4, -3, -26, -15, -46,
+   -37, -25, -3, 15, 22, 21, 29, 26, 7, -6, -21, -17, -18, -12, -20, -7,
+   -4, -4, -1, -9, -4, 1, 3, -4, -3, -12, -4, -11, -14, -6, -2, 14,
+   -8, 15, 40, 29, -4, -12, -28, -40, -29, -12, -21, -20, 0, -2, 1, 1,
+   -1, -8, 3, 1, -12, 11, 8, 21, 4, -2, 8, -14, -7, -10, 10, 16,
+   -3, -34, -19, -27, -42, -3, -20, -21, -7, 0, -5, 0, -5, 9, 5, 1,
+   -5, -3, 7, 18, 10, 20, 10, -21, -14, -13, -9, -14, -22, -44, -39, -25,
+   -32, -28, -25, -14, -6, -5, -4, 6, -6, -4, -1, 5, 2, 10, 6, 38,
+   45, 37, 23, -14, -5, -2, 3, -12, -25, -27, -25, -21, -33, -9, -22, -5,
+   -6, -6, 3, -6, -8, -2, -6, -5, -5, 6, 8, 17, 46, 47, 24, 12,
+   -1, -13, -6, -33, -24, -23, -22, -12, -10, 10, -9, -2, 2, -1, -11, -7,
+   -3, -1, 6, -3, -16, -7, -6, -5, 32, 21, 15, 29, 6, -5, -19, -36,
+   -25, -17, -20, -1, 15, 7, 12, 19, 5, 0, -1, -4, -9, -2, 8, -1,
+   -5, -7, -18, -15, -4, 5, 9, 12, -17, -11, -24, -18, -27, -18, -18, 12,
+   25, 31, 14, 9, -2, -1, 0, 9, -5, 11, -2, -8, -8, -10, -24, -31,
+   -17, -29, -13, -8, -24, -44, -25, -16, -15, 3, 3, 15, 39, 30, 19, 11,
+   5, 7, 8, -3, 9, 1, 3, 4, -18, -17, -26, -53, -43, -44, -34, -48,
+   -42, -41, -16, -14, -21, -16, 10, 17, 34, 37, 19, 8, -7, -1, 1, 1,
+   -2, 2, -1, -7, -14, -15, -24, -46, -57, -42, -58, -56, -52, -22, -17, -11,
+   -31, -3, 3, 11, 10, 9, 3, 11, -1, -2, 7, -3, -7, -9, -3, -5,
+   -6, -12, -24, -46, -53, -58, -53, -55, -51, -29, -21, -46, -26, -15, 7, -6,
+   -3, 14, 8, 17, 10, 4, 4, -4, -1, -6, 5, 8, -8, -12, -26, -37,
+   -45, -62, -44, -48, -20, -15, -34, -27, -12, -6, -10, -2, -5, -6, -7, 0,
+   8, 1, 2, 3, 10, -8, -5, -7, -3, -20, -21, -44, -42, -45, -38, -22,
+   7, -4, -15, -17, -10, -20, -25, -30, -34, -37, -17, 4, 5, 6, -1, -1,
+   1, -3, -7, -4, -12, -15, -18, -36, -32, -10, -6, -11, 26, 2, -1, -8,
+   -16, -36, -34, -41, -77, -47, -12, -7, 1, 11, 4, 1, 0, 5, 7, -3,
+   -2, -13, -15, -39, -16, 1, 6, 39, 43, 32, 31, 1, -39, -53, -35, -63,
+   -74, -54, -16, -15, 3, -3, 5, -5, 2, -5, 5, -9, -7, -3, -10, -15,
+   -13, 19, 43, 50, 41, 30, 19, -5, -47, -40, -56, -68, -77, -48, -11, -7,
+   -13, -2, 0, -1, 3, -5, -2, 5, -8, -10, -9, -11, -4, 14, 46, 41,
+   16, 26, 9, -4, -23, -19, -35, -49, -61, -46, -14, -15, -4, -4, 2, -5,
+   -3, -1, -3, 0, 1, 4, 13, 2, 11, 27, 48, 41, 39, 34, -3, 13,
+   10, -4, -7, -32, -48, -27, -9, -15, 5, -6, -1, -4, 4, -1, 5, -1,
+   16, 21, 26, 5, 26, 42, 42, 36, 34, 41, 37, 15, 32, 18, 11, -7,
+   -28, -30, 2, -12, 0, -3, 1, -5, -2, 0, 2, 7, 8, 19, 15, 13,
+   36, 41, 56, 39, 36, 40, 23, 42, 35, 37, 31, 15, -33, -29, -1, 2,
+   8, 5, -5, 9, 2, 1, 1, 4, 14, 23, -1, -1, 26, 15, 27, 6,
+   12, 28, 13, 29, 42, 31, 19, 19, -27, -28, 5, 1, 8, -9, 8, -4,
+   -2, -8, -1, 1, 19, 14, 5, 8, 2, 2, -7, -20, -6, 0, 19, 30,
+   48, 46, 46, 15, -6, -1, 20, 2, 8, 11, -7, 2, 5, 4, 3, 6,
+   18, 14, -2, 12, -1, 5, -5, -12, -7, 13, 35, 66, 74, 81, 69, 35,
+   9, 10, 24, 20, 2, 5, 5, -4, -7, 1, 4, 15, 12, 11, -14, -7,
+   1, 3, 7, 5, 6, 14, 28, 34, 42, 52, 45, 55, 10, 4, 26, 12,
+   -2, -5, 10, -1, -2, 6, 8, 2, 17, -7, -32, -40, -22, 7, -4, 8,
+   14, 4, 7, 18, 23, 31, 33, 6, -22, -15, 17, 18, 6, 1, 2, -6,
+   2, 1, -4, -3, -1, -2, -3, 4, -12, 6, 1, -8, -11, -4, -5, 1,
+   7, -3, -4, -5, -2, -10, 3, 0, 0, -7, -2, 3, -3, -5, 4, -13,
+   6, 4, -7, -11, -7, -10, 1, -3, 0, -11, -2, 6, -5, -6, -13, -1,
+   3, -5, 0, -7, 1, -1, -8, -2, 1, 3, -3, 7, -5, -2, 0, -4,
+   1, -1, 3, -7, -2, -2, 0, 2, -2, 0, 6, -2, 3, -17, -3, -1,
+   -3, -5, -4, 0, -7, 6, -1, -1, -7, -1, -7, 10, -5, 6, 8, 1,
+   -2, -2, 1, 4, 1, -5, 2, 1, -8, 1, 3, 1, -4, 8, -7, 0,
+   7, 5, -8, -3, 5, -8, -1, -4, 0, 11, -4, 2, 2, -7, -3, -3,
+   -3, -4, 0, -3, -5, -5, -6, -2, 3, -10, 1, 2, 5, -7, -4, 0,
+   -4, -3, -1, 2, 2, 3, -7, -6, -9, 1, 7, -4, 3, 6, -11, -6,
+   -4, 5, -10, -2, -4, 8, -15, -11, 2, 0, 3, 7, -1, -6, 0, 1,
+   -4, 2, -2, -3, -4, -6, 0, 4, -5, 3, -4, -10, -3, -7, 6, 5,
+   -7, -2, 4, 2, -3, 1, -8, -6, -3, 4, 5, 4, 5, -4, -3, -3,
+   -8, 1, -1, 3, -1, 0, -15, -8, 5, 4, 11, 6, 11, 5, 1, -2,
+   2, 2, -4, -4, 2, -1, -6, -1, -9, -13, -7, -4, -2, -2, 3, 4,
+   1, -2, -5, 3, 7, 8, 1, 2, -3, 0, -7, -6, 1, -12, 12, -1,
+   0, 6, 5, 9, -6, -9, -1, -9, -7, 2, 3, -2, -4, -1, 15, 6,
+   -2, 1, -1, 5, -5, -3, 5, -5, -4, 8, -4, -2, -8, 1, -3, -1,
+   4, -1, -9, -5, -3, -3, 0, -12, -1, -4, -4, 6, 3, -6, 5, 3,
+   3, 1, -3, -2, 5, -3, -8, 6, 4, -2, 4, -5, 1, -17, 3, 1,
+   -2, 0, -2, -4, 2, 0, 2, -4, -6, -4, 7, -3, 6, 0, 2, 4,
+   1, 7, 6, 12, -5, 4, -6, -12, 2, -6, 6, -11, -11, 3, 2, -2,
+   3, 3, 1, 1, -4, -1, 2, 3, 2, -2, -8, 7, -5, -1, 1, 0,
+   -2, -1, 2, -3, -7, -4, -15, -10, 0, -5, 1, 8, -4, 3, -3, 1,
+   -2, 1, -11, -2, 3, 12, 5, -2, -4, -4, 2, 7, 7, -13, -6, 8,
+   0, -2, -2, -3, 0, -3, -2, -10, -1, -5, 5, -2, -7, -6, -1, 2,
+   2, 2, -7, -1, 2, 4, -6, 3, -6, 4, -6, -3, 1, 3, 0, 2,
+   -1, 13, -2, -1, -7, 2, 3, -1, -6, -2, -5, -2, 4, 2, 0, 5,
+   -2, -5, 5, 2, 0, 0, -2, 4, 5, -2, -8, 3, 3, -2, 2, -2,
+   10, 9, -11, -2, -6, 6, -8, -4, 2, -8, 0, 1, -1, -4, 0, 0,
+   -8, -7, -2, 7, 2, 0, 0, -3, 8, -3, -2, 10, 7, -5, -8, -2,
+   3, -11, 6, 7, 5, -2, 3, 6, -6, -5, 5, -6, -2, 11, -4, -5,
+   3, -7, -5, 0, -8, -2, 9, -7, 4, 1, -4, 0, -3, 6, -9, -6,
+   -4, 0, -1, -3, 3, 0, -3, -6, 8, -2, -1, 2, -11, -6, -1, 0,
+   -3, 8, -4, 2, -6, 6, 6, -5, -1, -4, -2, -2, -8, -4, -6, 0,
+   -3, -1, -2, -7, 7, 8, -2, 9, -12, -10, 0, -4, -3, -12, 12, -1,
+   0, -7, -9, -6, 5, -5, -5, 2, -3, 2, 5, 4, 3, 2, 3, -2,
+   -3, -5, 7, -2, 1, 7, -5, 2, -3, 2, -3, 6, -4, -3, -7, -3,
+   -3, -11, -10, 6, -1, -4, 4, 6, -5, -1, 1, -2, 6, 0, 4, 1,
+   6, -6, 2, -10, -5, -6, 1, -6, 1, -3, -5, -4, -6, -1, -11, -7,
+   2, -3, 4, 0, -3, 4, -3, -1, 6, -4, -12, -2, 5, -4, -11, -3,
+   -8, -7, -3, 1, -5, 2, 4, 5, -1, 5, -4, 9, 8, -7, -8, -5,
+   -5, -4, -1, -3, 5, -6, 8, -1, 6, -1, -2, -3, -10, -3, -9, -6,
+   -7, -9, 0, 1, 5, -6, 1, -7, -3, -4, -13, -5, 1, 4, 5, 3,
+   -20, -9, -1, -3, -4, -4, -3, 4, -1, -6, -2, -3, -1, 1, 3, 6,
+   11, -4, 5, 5, 0, 1, -4, -2, 6, -1, 4, 12, -11, -3, -1, 3,
+   6, -3, -2, -3, -5, -1, -9, -4, -12, -6, -4, 0, -2, 1, 5, 2,
+   -2, -6, -3, 1, 0, -2, 2, 6, -10, -2, -3, 5, -2, -3, -6, -2,
+   2, 3, -5, -6, 6, 0, 1, 2, -1, 1, 0, -11, 7, 7, 3, 4,
+   3, -1, -10, -2, -13, -12, -27, -35, -36, -28, -18, -21, -10, 0, -14, -19,
+   -28, -36, -42, -36, -44, -3, -12, 2, -5, 0, 7, 7, 0, -5, 0, -3,
+   -16, -13, -33, -31, -37, -24, -10, -6, 7, 26, 14, 13, 4, -13, -23, -39,
+   -38, -13, -9, -1, -8, 5, -1, -3, -2, 5, -11, -1, -4, -16, -36, -37,
+   -30, -12, -5, 20, 20, 23, 28, 25, 15, 6, -4, -31, -31, -26, -11, -10,
+   -1, -1, 2, 6, 3, 12, -6, -8, -13, -19, -25, -32, -37, -26, 13, 21,
+   16, 14, 23, 28, 21, 4, -3, -31, -38, -13, -17, -19, 3, -3, 2, 6,
+   -3, -2, -4, -8, -19, -9, -38, -31, -43, -11, -1, 5, 0, 10, 22, 36,
+   15, 11, 2, -15, -26, -11, -9, -22, -9, -7, 0, 5, -3, -3, 0, -16,
+   -14, -29, -36, -34, -12, -7, 2, 0, 3, 15, 27, 12, 22, 8, 11, 3,
+   -15, -11, -16, -3, -8, 4, -1, 8, -7, 3, -9, -11, -23, -14, -33, -27,
+   -13, 10, 12, -6, 10, 20, 26, 29, 21, 6, 1, 18, -20, -9, -8, -4,
+   2, -14, -7, -2, 3, -1, 1, -11, -6, -17, -25, -27, -9, -6, -7, 3,
+   15, 15, 20, 24, 38, 9, -21, 3, -6, -10, -6, 2, 2, 5, -4, 1,
+   7, 6, 0, -3, -4, 5, -17, -15, 1, -11, 7, 19, -4, 5, 3, -4,
+   11, -6, -9, 7, -4, -10, 12, 1, -3, 5, 1, 5, 0, -2, -1, -8,
+   10, -10, -7, 3, 3, -13, 7, 16, -13, -9, -14, 3, -7, -9, -9, -15,
+   -5, -12, -2, 5, -6, 1, -2, -7, -1, 2, 1, 0, -2, 0, 1, 6,
+   13, 5, 6, -6, -26, -40, -24, -14, -23, -28, -15, -23, -5, -8, -4, 4,
+   -5, -8, 5, 0, -5, 6, -3, 0, 0, 12, 9, 6, 2, 5, 7, -5,
+   -33, -45, -27, -4, -12, 2, -17, -12, -20, -9, 4, 0, -2, -4, 6, -6,
+   4, -6, 2, 7, 4, 18, 25, 12, 5, 20, -5, -18, -43, -44, -31, -7,
+   -5, 0, -13, -16, -6, -14, -1, -5, -1, -6, -1, -1, 9, 0, -1, -2,
+   19, 32, 18, 19, 8, 13, 2, -21, -23, -34, -37, -1, -6, -4, -1, -5,
+   -21, -15, -8, 6, 5, -3, -2, -1, -5, 0, -4, 2, 18, 23, 12, 9,
+   -4, 10, 7, -15, -8, -36, -26, -8, -6, -16, 2, 4, 5, 3, -3, 1,
+   5, 6, -4, -11, 1, 7, 0, -5, 11, 15, 15, 9, 5, 0, -1, -18,
+   -33, -49, -52, -35, -26, -2, 13, 2, 3, -15, -4, -10, -8, -4, 0, -2,
+   -3, -10, 1, 0, 25, 14, 8, 14, 21, 9, 14, -15, -27, -74, -65, -38,
+   -25, -2, 8, -4, -2, -12, -10, -4, -3, -6, 1, 0, 8, 0, 3, -4,
+   16, 7, -1, 23, 36, -1, 11, -9, -34, -64, -69, -37, -23, -5, 0, -6,
+   -20, -5, -3, -3, 6, 12, -3, -6, 1, -1, 5, 1, 2, 9, 9, 19,
+   43, 14, 17, 0, -19, -43, -41, -33, -17, 3, 2, 0, -18, -2, -17, 0,
+   -1, 3, -10, -6, 2, 11, 4, -9, -3, 1, 0, 22, 47, 31, 27, 15,
+   -1, -5, -5, -10, 14, 5, 5, 0, -12, -2, 1, -2, -4, -5, -6, 6,
+   4, 4, 7, 1, 3, 14, 6, 2, 42, 36, 45, 42, 31, 35, 28, 19,
+   12, 6, 7, -11, -9, 3, -6, 6, 0, -1, 2, 7, 4, 4, -3, 2,
+   8, 11, 5, 9, 32, 31, 27, 33, 47, 46, 35, 20, 11, 6, 6, 14,
+   -3, 6, -13, -4, -7, -10, 2, -1, -1, 10, 2, 0, -6, 4, 2, 6,
+   18, 17, 26, 32, 54, 51, 42, 2, 12, 27, 15, 8, 0, -9, -9, -7,
+   1, 9, 5, 1, -13, -7, -2, -3, -5, -2, -31, -17, -4, 22, 25, 23,
+   45, 41, 18, 14, 18, 10, 16, 21, -12, -9, -6, 7, 2, 5, -6, 12,
+   2, -8, 6, -1, 1, -8, -23, -31, -10, 11, 34, 40, 53, 48, 26, 12,
+   5, 8, 20, 4, -33, -2, -19, 2, -7, 4, 3, -3, 1, -7, 5, 0,
+   -3, -12, -38, -34, -19, -7, 24, 24, 49, 43, 38, 15, 16, 21, 12, -14,
+   -33, -11, -9, 0, 6, -3, 0, 6, 0, 1, -1, 2, -12, -22, -32, -40,
+   -23, -10, -3, 20, 24, 13, 14, 18, 14, 1, -14, -33, -33, -26, -11, -12,
+   -4, 0, 0, -6, 4, 1, -1, -6, -6, -17, -44, -46, -45, -26, -16, -6,
+   7, 8, -9, -6, -3, -22, -33, -41, -42, -16, 3, 1, -5, -2, -2, -4,
+   -6, 0, 2, 7, -4, -5, -9, -21, -16, -6, 0, -14, -5, -12, -7, -11,
+   -6, -11, -16, -11, -27, -9, -5, -4, 8, 3, 7, -1, 11, 2, -4, -1,
+   -3, -14, -17, -33, -26, -18, -13, -2, -1, -3, -8, -11, -18, -5, -6, -15,
+   -15, -4, 3, -14, -1, -5, -4, 1, -5, -2, -8, -5, 10, -2, -6, -27,
+   -15, -21, -4, -8, 6, 1, 12, 5, -4, -17, -7, -3, -3, 2, -4, 2,
+   8, 14, 5, -3, 4, 5, 2, 6, 5, -2, -9, -18, -6, -5, 3, 8,
+   13, 17, 10, 3, -2, -9, -5, -3, -1, 9, 9, -2, 2, -1, 7, 2,
+   -5, 6, 7, 6, 5, 2, 1, -7, 9, 16, 15, 3, 2, 9, 15, 10,
+   -16, -13, 10, 4, -13, 8, 10, 4, 6, -7, 3, 1, -5, 1, -6, 3,
+   10, 1, 9, 15, 19, 20, 12, 20, 2, 6, 12, 1, 2, -3, 5, 16,
+   9, 9, 10, 0, 6, 7, -4, 5, 6, -1, 1, 8, 6, 3, 12, 9,
+   12, 15, 7, 8, -6, -7, 4, 7, -11, -14, -8, 2, 11, -1, 0, 1,
+   -2, 4, 8, -7, 3, 0, 7, 3, 11, 20, 13, 1, 5, 9, 11, 0,
+   3, 3, -32, -25, -14, -12, -4, -3, 2, 2, 11, 1, 13, -4, -6, -2,
+   6, 4, 3, -4, 13, 17, 8, 10, 0, 12, 18, 12, 15, -8, -14, -28,
+   -17, 1, -8, -9, -12, 3, 7, -6, 2, 1, 6, 1, 11, -10, 1, 5,
+   5, 29, 6, 23, 16, 23, 12, 6, -2, -22, -26, -35, 7, 6, 7, 0,
+   11, 15, 10, 3, -4, -9, 12, 2, 13, 2, -1, 1, 0, 25, 31, 41,
+   23, 29, 27, 16, -12, -32, -32, -39, -3, 10, 3, 18, 16, 18, 3, -2,
+   8, -5, 1, 3, 1, -6, -6, 13, 14, 22, 40, 52, 50, 44, 47, 11,
+   -4, -29, -32, -41, -1, 22, 13, 22, 34, 20, 2, -7, -5, 0, 3, 2,
+   -8, 6, 0, -7, 4, 27, 37, 31, 40, 51, 44, 20, 2, -13, -42, -30,
+   1, 14, 21, 16, 26, 26, 12, 1, 7, -2, -7, 8, 3, -8, 3, 7,
+   5, 16, 23, 38, 40, 27, 17, 26, -6, -34, -39, -16, 9, 14, 24, 32,
+   25, 23, 4, 4, 3, -4, 4, -3, 6, -3, 4, 7, 1, 4, 4, 7,
+   16, 34, 20, 9, -16, -25, -31, -10, 12, 24, 28, 24, 22, 27, 9, 2,
+   0, 7, -5, 0, -7, 0, -6, -1, -2, -9, -2, -11, 5, 13, 3, 5,
+   1, -9, -1, 22, 18, 35, 24, 16, 18, 20, 4, -7, -2, -2, 2, -4,
+   0, -2, -3, 1, 3, -7, -21, -24, -12, 1, -10, -2, -6, 6, 9, 30,
+   24, 22, 18, 11, 27, 8, -2, -7, 6, -5, 5, 14, -9, -4, -5, 3,
+   -1, -12, -29, -34, -25, -14, -30, -27, -7, 2, 14, 36, 35, 10, 7, -1,
+   13, 1, -1, -1, -8, 6, 6, -5, 0, 3, 9, -4, 11, -10, -24, -41,
+   -31, -35, -46, -30, -8, 13, 27, 45, 18, 9, -5, 3, -1, -5, -3, 0,
+   -1, 5, -1, -17, 5, 2, -3, 1, -12, -14, -18, -22, -30, -41, -44, -32,
+   -4, 6, 26, 39, 27, 4, -1, -9, -16, -12, -4, -14, -7, -6, -6, -3,
+   4, -4, -7, 8, -7, -6, -19, -15, -14, -27, -34, -25, -12, -16, 7, 23,
+   15, 7, -8, -18, -38, -7, 1, -10, 4, 2, -7, -11, -4, 1, 9, -2,
+   -5, -18, -14, -16, -23, -15, -22, -13, -13, -1, 5, 24, 22, -6, -23, -29,
+   -15, -9, -3, 1, 0, 7, 2, -3, 9, 1, 5, -7, -14, -9, -16, -14,
+   -8, -22, -23, -2, 6, 11, 31, 10, 5, -21, -18, -30, -20, -8, -2, -6,
+   -11, -4, -1, 1, -3, 1, 1, -10, -10, -11, -16, -20, -12, -5, -7, 2,
+   5, 15, 18, 15, 7, -8, -21, -30, -20, -10, -2, -16, 5, -6, 4, -6,
+   -2, -4, 2, -1, 0, -13, -17, -14, -24, -11, -16, 4, 8, 18, 26, 9,
+   -6, -14, -11, -25, -20, -11, 2, -8, 1, -2, -2, 1, 5, -1, 8, 12,
+   1, -2, -13, -30, -14, -15, -4, -9, 6, 13, 21, 10, -17, -8, -18, -35,
+   -25, -6, -6, 2, 1, 1, 3, 0, 7, 0, -2, -3, 4, 2, -9, -27,
+   -8, -22, -21, 3, -2, 7, 24, 3, -1, -3, -24, -34, -20, -1, -2, -1,
+   2, -2, 2, 0, -4, -8, 4, -3, 7, 4, -9, -22, -20, -13, -34, -11,
+   -12, 9, 7, 0, -6, -17, -23, -15, -12, -6, -2, 2, 8, -6, -1, -1,
+   -4, -3, -5, -8, -7, -5, -21, -14, -6, -14, -8, -4, -18, -2, -7, -7,
+   -14, -14, -13, -15, -30, -13, -2, -14, -2, -3, -1, 2, 2, 3, 1, 3,
+   -10, -10, -9, -15, -20, -5, 2, 9, 6, 5, 7, -2, -10, -21, -14, -11,
+   -10, -7, -6, -9, -6, 10, 1, 6, -2, -1, 0, 11, -7, 6, -7, -4,
+   -7, -7, 5, 0, -3, 20, 28, 8, 8, -11, -9, -18, -8, -6, 7, -7,
+   0, -7, -4, 0, 4, -2, 5, 0, 5, 1, 1, -1, 1, -6, -3, -5,
+   0, 10, 7, 1, 3, 0, -6, 2, -15, 13, -1, -8, -3, -12, -6, -3,
+   4, 1, 11, 9, 3, 11, 8, -2, 1, -5, -12, -3, -7, -17, 6, -12,
+   7, -4, 3, -5, -9, 3, 9, -4, 5, 0, 7, 3, 13, -2, 7, -3,
+   -4, 11, 7, -2, 4, 0, 2, -9, -5, -3, 0, -7, 5, 5, 6, 4,
+   5, 6, 0, -8, 3, 7, -1, 2, -1, 0, 5, 1, -1, 9, 14, 9,
+   11, 8, -6, 1, -18, -13, -11, -2, -1, 3, 1, 4, 13, 13, -3, 6,
+   1, 2, -5, 4, 0, -11, 1, 1, 10, 7, 5, 20, 11, -1, 10, -10,
+   -15, -9, 2, 0, 9, 6, 14, 16, 0, 14, 12, 3, 3, -8, 1, -3,
+   -1, 6, -4, 2, 11, 15, 11, 4, 16, 9, 23, -5, -3, -7, -11, -4,
+   12, 20, 12, 9, 11, 10, 12, 2, 3, 2, 2, 6, -6, 1, 7, 6,
+   5, 19, 18, 26, 34, 15, 21, -15, -20, -15, -17, -11, 10, 20, 8, 11,
+   12, 21, 19, 6, 13, -9, 2, 0, 2, -2, 0, -3, 2, 16, 12, 26,
+   19, 22, 15, -11, -31, -27, -24, -5, -1, 8, -3, 23, 22, 40, 12, 9,
+   2, 3, 3, 3, 1, 0, 8, 0, 1, 3, 15, 27, 25, 16, 25, -9,
+   -38, -46, -37, -25, 3, 20, 2, 27, 39, 46, 21, -1, 1, 1, 1, -8,
+   7, 11, 0, -2, 4, 10, 13, 14, 23, 8, 16, 8, -12, -33, -30, -15,
+   -4, 12, 16, 18, 37, 39, 24, 1, -4, 0, 10, -11, -1, 0, 1, -2,
+   -5, 2, 14, 10, 20, 14, 16, 16, -10, -17, -29, -7, 12, 22, 20, 21,
+   35, 41, 19, 13, -4, -3, 2, 1, -3, 4, 1, -2, 1, -12, -8, -6,
+   10, 14, 10, 25, 14, 0, -17, -1, 24, 31, 27, 33, 34, 14, 8, 3,
+   4, 1, -1, 2, -9, -9, 5, 2, 6, -20, -18, -8, -2, 4, 8, 11,
+   15, 11, 15, 25, 22, 22, 15, 21, 19, 17, 9, -7, -7, 2, -5, 5,
+   -9, 7, 0, -7, 0, -9, -18, -20, -15, -10, -2, 7, 20, 38, 27, 30,
+   13, 16, 8, -7, 3, -9, -10, -5, 2, -1, 4, 1, -2, 9, -2, -5,
+   1, -14, -31, -33, -31, -21, -24, -16, 14, 46, 48, 37, 21, 2, -7, -7,
+   -10, -17, 1, -6, -3, 3, -2, 2, -1, 3, 1, -2, -6, -7, -28, -36,
+   -45, -43, -41, -21, 19, 30, 53, 28, 6, 0, -7, -16, -27, -18, -14, -16,
+   -4, 5, -1, -2, -11, 6, 1, 1, -13, -5, -21, -28, -27, -28, -30, -7,
+   26, 14, 27, 18, 0, -8, -20, -18, -30, -21, -22, -22, -8, -3, -3, -5,
+   -4, -1, -3, -1, -7, -15, -26, -11, -28, -31, -13, 7, 12, 14, -6, -1,
+   -6, -13, -21, -27, -40, -20, -24, -25, -4, -8, 0, 2, -6, -5, -8, -5,
+   -6, -21, -35, -25, -24, -20, -3, 26, 25, 13, -2, -14, -7, -17, -16, -24,
+   -35, -20, -21, -13, -7, 0, -9, 0, 7, 5, 9, 5, -11, -15, -21, -24,
+   -11, -4, 8, 7, 30, 29, -5, -6, -17, -11, -15, -34, -36, -13, -10, -16,
+   -5, -6, 9, -1, 2, 1, 7, -1, -6, -10, -14, -11, 2, 9, 16, 17,
+   30, 18, -1, -8, -9, -14, -17, -27, -31, -20, -7, -16, -1, 2, 0, 2,
+   -2, 7, -4, 2, -8, -12, -10, -4, -18, 7, 6, 15, 19, 17, 10, -3,
+   -4, -11, -2, -18, -12, -14, -9, 0, 5, -6, 3, 4, 6, 0, 6, 6,
+   -4, -8, -15, -23, -12, -3, 7, 14, -3, -1, -10, 5, -4, -14, 7, -16,
+   -12, 0, -3, -10, 5, -5, -5, 4, 6, -7, 7, 7, -12, 6, -7, -20,
+   -9, -11, 2, 3, 5, -7, 0, 1, -11, -13, -6, -14, -1, 4, 6, -3,
+   -11, 0, 5, 0, -5, -3, 6, 4, 8, -3, 4, -4, -11, -10, -13, 0,
+   -7, 10, -5, -1, -17, -10, 3, 7, 7, 12, 10, -5, 2, 5, -5, 12,
+   -3, 1, -2, -7, -5, 1, -11, -6, -6, -8, -3, 2, -4, -16, -32, -21,
+   -23, -8, -11, -7, -10, -20, -6, -2, -3, 1, -4, -7, -3, 2, 8, 0,
+   -2, -14, 0, -12, -1, 2, 7, -7, -10, -16, -23, -20, -17, -17, -19, -15,
+   -14, -8, -8, -8, 1, 9, 6, -5, -3, 6, -1, -2, 0, -7, -2, -13,
+   15, 5, 0, 6, -11, -15, -15, -1, 0, -12, -6, -16, -18, -19, -4, -2,
+   -3, 2, 11, 2, 2, 10, 4, 7, 6, 2, -17, 8, 6, 12, -1, -1,
+   -5, 10, -5, -11, 8, 0, -33, -13, -18, -15, -12, -7, 2, -6, 1, -11,
+   -5, -6, -1, 2, -8, -4, -8, 8, 12, 17, 15, 16, 9, 11, 9, 6,
+   9, -6, -7, -18, -13, -6, -11, 5, 2, 2, -7, -6, -8, 7, 1, 4,
+   0, -2, 21, 15, 34, 33, 38, 29, 28, 3, 14, 7, 0, 4, -13, -5,
+   7, 11, -6, 2, 3, -1, -7, 2, 0, 0, -2, -5, 4, -2, 1, -6,
+   16, 32, 42, 34, 43, 34, 19, 11, 4, 6, -4, -2, 21, 21, 6, -6,
+   4, -3, -5, -7, 7, 8, -8, -2, 3, 12, -5, -6, 8, 16, 22, 32,
+   30, 25, 25, 17, 12, 0, 3, 0, 7, 7, 0, -1, 11, 2, -1, -3,
+   1, 3, -3, 0, -8, 5, -11, -13, 3, 7, 7, 4, -3, 4, 11, 7,
+   7, 4, 8, -1, 10, 2, 7, 6, 3, -5, -9, 3, 1, 3, -2, -10,
+   0, 2, -2, -15, -5, 5, -21, -34, -12, -29, -8, -14, -9, -4, -13, 8,
+   8, 6, -11, -1, 8, 10, 7, -5, -12, 3, 0, 0, -5, -4, -16, -21,
+   -13, -13, -34, -32, -16, -10, 0, 0, -3, -4, -23, 10, 16, 11, -1, 7,
+   -4, 4, -4, -4, 2, 0, 1, -1, -4, -15, -2, -9, -16, -32, -22, -25,
+   -19, 11, 17, 17, 4, -21, -19, -5, 4, 4, 4, 0, -5, -7, 3, -6,
+   -2, 0, 3, -10, -16, -13, -19, -12, -12, -22, -20, -16, -3, 7, 24, 25,
+   10, -10, 1, 15, 15, 12, -12, -6, -9, -2, 2, 7, 9, 7, -5, -4,
+   -13, -17, -5, -15, -2, -7, -5, -8, 5, 17, 27, 24, 14, 12, 6, 35,
+   19, 2, -9, -10, -1, 3, 2, 0, 6, 3, -6, -8, -20, -20, -13, -14,
+   -6, -5, 10, -12, 8, 13, 20, 18, 28, 14, 21, 34, 29, 15, -15, -8,
+   -1, -2, 6, -2, -1, 7, -7, -10, -32, -30, -32, -26, -38, -17, -9, 8,
+   7, 6, 12, 20, 14, 27, 34, 15, 25, 12, -3, -13, 2, 4, 0, 2,
+   3, -2, -1, -6, -26, -41, -45, -55, -50, -42, -34, -29, -7, 7, 22, 18,
+   20, 23, 29, 30, 15, 5, 5, 3, 3, -1, -1, -4, -9, -2, 1, -14,
+   -28, -46, -56, -81, -55, -53, -54, -55, -50, -4, 8, 14, 6, 21, 21, 45,
+   20, 14, 0, 11, 6, -1, 5, 5, 2, -9, -6, -12, -20, -43, -47, -64,
+   -57, -36, -47, -77, -73, -29, -14, 7, 13, -3, 5, 30, 22, 6, 10, 10,
+   20, 0, 4, 2, -5, 2, -7, -2, -14, -30, -34, -47, -72, -55, -62, -68,
+   -61, -29, -16, 14, 11, 17, 7, 10, -11, 5, 9, 23, 11, 6, -1, 12,
+   -1, 1, -2, 0, -15, -24, -27, -32, -51, -46, -49, -39, -29, -26, 4, 19,
+   13, 12, 10, 6, -13, -15, 3, 15, -1, 6, 6, -4, 5, 8, -9, -4,
+   -19, -8, -7, -23, -6, -6, 8, -5, 3, -4, 3, 30, 1, -6, 3, -9,
+   -24, -13, -7, 4, 14, 4, -3, 8, -3, -2, 3, 1, -7, -1, -2, 4,
+   16, 28, 29, 13, 2, 8, 13, 16, 6, 5, 2, -2, -19, -9, -10, 4,
+   1, 6, -6, 0, 4, -5, 1, -2, -2, -8, 35, 25, 28, 17, 25, 21,
+   8, 9, 6, 12, 6, 6, 3, -2, -27, -20, -15, -7, 3, 3, 3, -1,
+   -3, 4, -1, -2, -8, -3, 4, 22, 41, 8, 20, 14, 12, 9, 12, 15,
+   5, 4, 5, -8, -19, -9, -13, -13, -3, 0, -1, 0, -2, 2, -2, 2,
+   -4, -2, 1, 19, 22, 29, 26, 16, 24, 36, 23, 23, 9, 15, 0, -15,
+   -10, -11, -26, 2, -4, 9, 12, 0, 1, 0, -2, -3, -4, -9, -6, -2,
+   3, 23, 30, 14, 16, 12, 11, 11, -4, -13, -8, -26, -22, -24, -37, -10,
+   7, -3, 1, 5, -6, -2, 2, -5, -11, -1, -3, -10, -4, -3, -2, -2,
+   7, -8, 6, 0, -16, -34, -28, -27, -21, -23, -25, -1, -1, -8, -1, 6,
+   11, -1, 2, 1, -10, -7, -16, -21, -24, -11, -8, -5, 2, 20, 19, 13,
+   -10, -12, -17, -20, -27, -4, -6, -3, -6, 5, 2, 1, -3, -1, -2, 0,
+   -1, -2, -13, -25, -13, 0, -9, 1, 12, 5, 12, 7, -6, -14, -29, -25,
+   -34, 6, -5, -4, 0, 5, -2, -2, 1, -2, -1, -6, -4, -6, -18, -8,
+   -11, -13, -2, -1, 12, 23, 23, 14, 1, -21, -28, -30, -14, -10, -2, -7,
+   -5, -8, -10, 6, 1, -1, -2, 7, 0, 2, -9, 0, 2, -3, -9, 1,
+   3, 16, 25, 15, 2, -17, -12, -29, -12, -1, -14, -4, -14, 2, -1, 9,
+   -9, 3, 5, -9, -11, 6, -1, -9, -11, -12, -3, 4, 15, 29, 17, 4,
+   -1, 4, -8, -18, -8, 9, -8, -7, 8, 1, -5, -1, -4, -2, -6, -6,
+   -3, 1, 9, -2, -3, 2, 1, 11, 15, 23, 9, 6, -4, -10, -5, -3,
+   -8, 0, 0, 1, 3, 0, 1, -2, -7, 2, -5, 0, -4, 15, -3, -6,
+   0, -14, -1, 3, 5, 2, 15, 11, 5, -4, -11, 11, -1, 7, -9, -1,
+   5, 8, 6, 1, -6, -8, 2, 2, 1, 1, -6, -4, -6, -15, 1, 3,
+   -17, -5, 18, 28, 18, 13, 7, -2, -3, -6, -13, -1, -1, 1, -7, -2,
+   12, 5, 4, 0, -6, -1, -6, -4, 0, -16, 8, -32, -19, -4, 5, 23,
+   32, 36, 28, 13, 3, 18, 5, -12, 1, -4, 2, 6, -3, -3, 0, -1,
+   -5, -12, -9, -10, -12, 1, -2, -31, -29, -23, 15, 37, 39, 39, 15, 24,
+   15, 13, -11, -2, -9, -5, 1, -8, 5, 1, -2, 0, -10, -6, -9, -22,
+   -21, -12, -22, -23, -14, 0, 10, 36, 62, 45, 29, 31, 26, 15, -1, -1,
+   -2, -1, 1, 8, -3, -4, -6, -12, -4, -5, -27, -19, -17, -11, -18, -25,
+   -12, 8, 17, 35, 45, 44, 27, 11, 17, 8, -7, -1, -10, 2, -2, 12,
+   3, -10, 7, 3, 3, -14, -23, -17, -19, -5, -7, -4, -14, -18, 5, 8,
+   31, 35, 20, -8, 0, 20, -17, -5, -8, 6, 2, -9, 2, 0, -4, 7,
+   2, -10, -23, -9, 2, 15, -3, 4, -16, -14, -10, -4, 13, 1, 7, -9,
+   -10, -6, -8, 0, 3, 3, 5, 3, -2, 2, 5, 0, 8, 2, -14, -11,
+   20, 19, 5, -11, -12, -17, -21, -2, 3, -3, 8, -2, -10, 2, 4, -7,
+   -2, 1, -7, 7, 4, 4, 3, 1, -1, 3, 2, 12, 29, 27, 19, -7,
+   -20, -17, -14, 3, -1, -4, -7, -10, -4, -7, 8, -4, -9, -3, 9, 0,
+   2, -9, 1, -6, 4, -1, 11, 23, 19, 21, 15, 1, 0, 11, 10, 11,
+   8, 0, -7, -5, -3, -5, 0, -6, -1, 1, 3, -7, 0, -10, -1, -5,
+   7, 3, 14, 25, 22, 12, -1, 12, 20, 36, 24, 22, 15, 7, 1, -12,
+   -6, -1, 0, 1, -1, 1, 0, 3, -4, 4, -9, -1, 10, 16, 16, 23,
+   22, 15, -7, 0, 19, 22, 19, 18, 13, 12, -2, -24, -14, -1, -7, 3,
+   -3, 8, 1, -2, 0, 2, 5, -8, 8, 14, 17, 25, 22, 9, 5, -2,
+   -3, 15, 14, 26, 20, 9, 3, -23, -12, 2, 0, -12, 5, 0, 1, -6,
+   2, 10, -3, 2, 1, 10, 15, 10, 2, 3, 11, 0, 9, 23, 15, 21,
+   4, 15, -5, -21, 0, -2, -10, -5, 1, 10, 12, -8, 9, -8, 4, 1,
+   -4, -3, -7, -5, -8, -5, 3, -10, 10, 13, 16, -8, -4, -8, -6, -28,
+   -18, -6, -13, -12, -3, -1, -2, -11, 2, 3, -1, -1, -4, -2, -18, -30,
+   -22, -25, -22, -25, -13, -3, 2, 5, -2, 7, -20, -22, -17, -13, -12, -8,
+   -5, -1, -2, -4, -2, 5, 5, 3, 0, 2, -25, -30, -23, -13, -20, -15,
+   2, 14, 10, -6, -4, -10, -11, -25, -19, -17, -16, -3, 0, 10, -6, -5,
+   -4, 0, 4, 2, -12, -16, -14, -40, -25, -26, -19, -25, -5, 6, 2, -3,
+   1, -3, -7, -9, -11, -9, -21, -5, -13, 10, -4, -11, 11, 8, -1, -8,
+   -5, -10, -15, -25, -15, -22, -15, -14, -6, -6, 2, 4, 3, 5, 13, -13,
+   -10, -19, -14, -9, 1, 6, -3, 1, 4, -8, -1, -3, -6, -8, -12, -18,
+   -11, -17, -14, -14, 2, -1, 0, 11, 21, 15, 0, -6, -13, -10, -13, -7,
+   -2, -12, -3, 0, 1, -1, 5, -5, -8, 0, -12, -12, -15, -1, -4, -15,
+   4, 6, 18, 25, 12, 2, -8, -14, -8, -8, -19, -5, 2, -4, -5, -6,
+   -8, -10, 5, -2, 0, -7, 7, -1, 1, -13, -4, -4, -9, 3, 7, 0,
+   -1, 5, -4, 3, -4, 3, 8, 1, 3, 1, -2, -2, -1, 8, 0, 2,
+   -5, 1, -3, -3, -3, -2, -7, 2, -4, 2, 16, 14, 23, 4, 7, 1,
+   1, 6, 0, -4, -8, 3, -4, -2, -6, -5, 1, 2, -1, 7, -1, -8,
+   1, -11, -13, -4, 2, 1, 7, 16, 26, 21, 8, 3, -10, -4, 9, 1,
+   -4, -2, -5, -6, 3, 0, -1, 9, -5, -4, -2, -1, 0, -8, -8, -12,
+   -3, 1, 0, 10, 23, 13, 10, 6, 11, -1, 9, 3, 8, 4, -9, -5,
+   4, 6, -1, -4, -4, 2, 8, -9, -8, -7, -10, -1, 0, -7, -5, 0,
+   9, 11, 4, 8, 5, 12, 12, 3, -2, 13, -4, -7, 4, 4, 5, 1,
+   6, 10, -1, -17, -9, 0, 0, 5, 3, 0, -7, -3, 2, -2, 6, 6,
+   1, -1, 5, -1, 0, 0, 2, -6, 2, -10, -3, -4, -6, -7, 3, -22,
+   -15, -7, 0, 17, 6, -11, -17, -15, -3, 9, 21, 11, 3, 2, -4, 4,
+   3, -7, 9, -5, -1, -4, 1, 6, 2, -8, 4, -24, -11, -6, 7, 23,
+   8, -12, -26, -25, -10, 2, 1, 0, 4, 4, 3, 3, 7, -3, 1, 5,
+   -3, -6, -3, -3, -3, -4, -15, -9, -11, -7, 11, 21, 12, -10, -20, -21,
+   -10, -5, 14, 6, 9, 2, 8, 10, 3, 3, -1, -7, -3, -5, 1, 6,
+   1, -7, -9, -9, -10, 7, 18, 29, 11, -1, -24, -26, -16, -3, 17, 18,
+   16, -4, 9, 0, 1, -2, 10, 4, -3, 1, -8, -1, -2, -10, -19, -20,
+   -19, -2, 16, 24, 3, -9, -11, -31, -24, -15, 10, 12, 13, 8, -4, 1,
+   1, 5, -5, 7, 3, 5, -11, -2, -1, -9, -23, -18, -11, 5, 17, 26,
+   13, 4, -15, -16, -12, -1, 9, 11, 14, 2, 7, 15, 0, -5, -1, 2,
+   4, 6, 3, -4, 3, -4, -8, -17, -21, 8, 19, 25, 10, 6, -13, -19,
+   -14, -7, 10, 11, 15, -2, 9, 6, -3, 1, 6, -8, -4, -5, 5, 3,
+   7, -7, -26, -17, -16, 12, 22, 28, 17, 9, -15, -20, -22, -6, 10, 14,
+   15, -5, 7, 4, -6, 1, -7, 1, -1, 4, 4, 6, -4, -12, -15, -22,
+   -21, -6, 6, 21, 23, 19, -3, -18, -14, -10, 9, 17, 8, -2, 3, 6,
+   5, -3, 0, 6, 4, -1, 9, 11, -3, -17, -21, -20, -14, 2, 6, 13,
+   13, 11, -11, -17, -5, 3, 11, 15, -1, -9, 4, 2, 3, -1, 5, 7,
+   -1, 8, 3, -4, -7, -12, -24, -27, -22, 8, 7, 16, 9, -1, -7, -11,
+   -10, -7, 10, 6, 4, -4, -1, 7, 9, 8, -3, 2, -1, 1, 2, 4,
+   -4, -21, -22, -33, -24, -6, 2, 17, 19, 9, -7, -11, -10, 0, 12, 7,
+   -8, 8, 4, -3, -5, 3, -1, 7, 1, 1, -1, -1, -3, -9, -19, -28,
+   -28, -5, -4, 25, 21, 21, -8, -7, -9, -6, 14, 15, -5, -3, 3, 5,
+   2, -2, 4, 2, -3, 0, 12, -2, -5, -4, -16, -29, -25, -4, 2, 7,
+   17, 20, 3, -12, -4, -5, 0, -11, -6, 3, 2, 1, -3, 6, 3, -4,
+   -3, 4, 2, 11, -1, -10, -8, -21, -18, -10, 5, 8, 21, 9, -5, -4,
+   -1, 8, 5, 4, 2, -5, 12, -6, -2, 10, -8, 8, -6, 0, 7, 3,
+   -4, -4, -6, -21, -18, -5, 4, -1, 6, 5, 3, -8, 0, 6, 14, 0,
+   4, 1, 4, -3, -5, 7, -4, -2, 1, -1, 4, 6, -4, 4, 0, -14,
+   -20, -13, -8, 9, 3, -5, -8, -2, 8, 6, -3, 4, -9, 15, 3, 0,
+   4, -2, -3, 2, 5, -4, 4, 1, -4, 4, -3, -13, -15, -22, -11, -2,
+   -7, 1, -4, 7, 7, 3, 6, -6, 3, -7, -1, -6, -8, -10, -1, -1,
+   -2, 5, 5, -2, 4, 6, -4, 1, -5, -27, -23, -12, -5, 1, 5, 2,
+   -3, 5, 7, -3, 9, -4, 9, 6, 5, -3, 6, 5, 6, 3, 1, 1,
+   -6, 13, 6, 8, -14, -8, -11, -7, -1, 8, 4, 6, 5, 15, 10, 5,
+   6, 1, 5, 5, 0, 4, -5, -4, 4, 1, -10, 5, 1, 10, 15, -1,
+   -3, -10, -11, -12, -11, -3, -1, -2, 8, 5, 3, 7, 2, 5, 9, 0,
+   -11, -5, -5, 1, 0, 2, 9, 2, 7, 5, 11, -5, 7, -12, -10, 0,
+   -1, 0, 2, 12, 10, -1, 9, -8, -7, 3, 13, 10, 8, 7, -6, 1,
+   4, -6, -2, -1, -5, -1, -10, -5, -4, -7, -13, -1, 10, 4, 23, 17,
+   17, 25, -3, -14, -5, -3, -8, 3, 4, 4, -1, -2, 3, -8, -10, -3,
+   -1, -2, -17, -6, -16, -11, -5, -8, -3, 10, 25, 28, 15, 10, 4, -5,
+   -17, -7, -6, 8, 5, -9, 0, 1, -1, 0, 0, 5, 6, -11, -23, -15,
+   -13, -17, -11, -17, 8, 16, 25, 20, 16, 24, 5, -30, -15, -3, 6, 4,
+   -2, 0, 2, -1, -1, -3, 1, -3, -5, -15, -28, -20, -27, -37, -23, -18,
+   -5, 6, 9, 24, 21, 15, 14, -6, -15, 1, -8, -2, 0, 8, -8, 5,
+   -5, 0, 5, -1, -1, -27, -18, -25, -34, -33, -19, -12, -17, -11, 21, 31,
+   38, 22, 7, -1, -20, -12, -15, 2, -2, -9, -4, 2, 2, 5, -2, -8,
+   -8, -18, -33, -24, -35, -39, -33, -29, -22, -17, 8, 20, 36, 12, -8, -24,
+   -25, -11, -17, 6, -2, 7, 7, -3, -7, 2, 10, -5, -9, -19, -17, -12,
+   -36, -39, -33, -10, -23, -14, -7, 7, 15, -24, -32, -31, -27, -12, -9, -11,
+   0, -10, -3, -8, -1, -12, 6, -2, -7, -13, -9, -10, -10, -9, -7, -18,
+   -2, -10, -7, -16, -18, -30, -50, -41, -31, -17, -7, -7, 5, 6, -2, 1,
+   -6, -3, -1, -9, -4, -4, 14, -2, -3, -4, 2, 5, 2, 17, -1, -19,
+   -44, -44, -57, -52, -33, -17, -5, -2, -6, -8, -6, 4, -6, -2, 1, 1,
+   1, 7, 6, 6, -4, 3, 8, 30, 35, 20, -9, -13, -51, -38, -59, -48,
+   -23, -21, -19, -4, 9, -8, -6, 1, -5, 2, 14, 4, 2, 19, 14, 13,
+   10, 16, 36, 46, 38, 11, -24, -22, -48, -30, -36, -35, -28, -16, -9, -16,
+   2, -5, 1, 6, -5, -10, -1, -2, 7, 21, 24, 33, 23, 28, 36, 34,
+   25, 3, -24, -12, -24, -23, -32, -9, -5, -4, -9, -4, 5, 10, 7, 0,
+   5, 1, -1, -1, 12, 22, 35, 32, 31, 32, 34, 18, 13, -10, -10, -26,
+   -19, -12, -22, -3, 10, -9, -5, 1, 2, -5, 2, -6, -2, 8, -1, 3,
+   7, 22, 32, 41, 43, 37, 27, 24, 9, -6, -13, 0, -21, -6, -12, -7,
+   7, 15, 3, -5, -1, -1, 3, -1, -3, -1, -3, 2, 24, 20, 45, 41,
+   28, 40, 43, 22, 3, 3, -7, -2, -21, -8, -5, 12, 12, 24, -3, 2,
+   3, -1, -2, -6, -7, 0, -6, 5, 19, 28, 42, 33, 31, 41, 36, 23,
+   14, 0, 4, -7, -13, -14, -2, 16, 9, 6, 3, 0, 4, -5, -6, -11,
+   6, 5, 4, 10, 22, 27, 40, 31, 45, 35, 41, 28, 22, 19, 21, -7,
+   -13, -19, 11, 10, 8, 9, -2, 3, -1, -4, -11, 1, 1, 0, 0, 10,
+   16, 27, 34, 28, 34, 21, 29, 22, 32, 19, 23, 0, -4, -14, -5, -1,
+   4, 3, -2, 2, 2, -10, -7, -8, 6, -1, 6, 18, 17, 23, 18, 18,
+   28, 10, 26, 32, 35, 20, 1, -9, 10, -5, -7, 2, -1, -8, 3, 7,
+   -1, 2, -5, -2, -1, 6, -3, 8, 5, 12, 4, 1, 14, 8, 16, 22,
+   33, 21, -5, -19, 2, 2, -8, -8, 2, -4, 1, -2, 11, -8, 8, -5,
+   -10, -2, 4, 3, 0, 0, -8, -5, 8, 7, 4, 7, 25, 10, -1, -12,
+   5, -1, -15, -6, -3, -3, -6, 2, -3, -3, -2, 2, -4, -1, 4, 4,
+   7, -6, -10, -20, -6, -17, -4, 3, -2, 4, -9, -5, 10, -10, -6, 2,
+   -5, -5, -8, -4, 10, -1, -7, 0, 7, -5, 1, -2, -7, -6, -2, -34,
+   -31, -18, -15, -4, 2, 14, -4, -3, 8, -8, -7, -2, -9, 6, -1, -9,
+   8, 0, 0, 4, -1, -9, 3, 0, 0, -13, -9, -22, -32, -13, -17, -4,
+   8, -8, -2, -1, 12, 14, 5, -2, 8, -1, 9, 1, -2, -2, 0, -4,
+   5, 5, -2, 2, -1, -10, -18, -11, -15, 4, 7, -6, -12, -2, 0, -2,
+   0, 7, 4, 7, -6, 13, 2, -1, 3, -8, -7, 1, 9, -3, -7, 6,
+   -7, -7, -11, -11, -16, -16, 2, 2, -8, -18, -20, -10, 7, 6, 7, 11,
+   2, 14, 8, 11, 9, 3, 9, 7, 7, -7, 7, -6, -11, -3, -13, -7,
+   -7, 0, 8, -8, -8, 5, -8, -3, 5, 1, 9, 6, -1, 1, 5, 15,
+   9, 2, 3, 7, 8, 3, -3, 0, -2, -9, -6, -1, -12, -13, -9, 3,
+   4, -6, -9, 6, 5, 1, 0, -2, -2, 4, 8, 9, 1, -3, -3, -6,
+   1, 8, 3, 3, 0, -3, 3, 1, -4, -5, -5, 4, -2, 1, 2, 4,
+   3, -1, -1, -2, 11, 9, 0, -11, -8, 2, 0, -1, -5, -6, 9, -6,
+   1, 1, -12, 3, -10, -5, 2, -3, -7, -6, -1, 6, 6, 2, -7, 5,
+   -4, 1, 4, -8, -5, -2, 0, 1, 3, -3, 6, 12, -9, 6, 0, -11,
+   1, 0, -7, -1, -1, -7, -5, -11, -4, -3, 0, 2, -2, -7, -4, -4,
+   -1, -2, 7, 5, -3, 2, 0, -6, -1, -3, 3, 0, -5, -16, -1, 0,
+   3, 2, -4, -13, 0, 1, -5, 2, 1, -2, 2, 6, -1, 2, 0, 3,
+   13, -5, -3, 2, 0, 1, 5, -10, -1, -2, -3, -5, -2, -2, -3, -1,
+   -2, -1, -4, -6, -7, 0, -1, 3, 9, 9, -1, 2, -7, -3, 5, -2,
+   0, 8, 7, 6, 2, -1, 2, -7, -3, -4, -3, -3, 2, -3, -4, 6,
+   -1, -3, 8, -1, 5, 3, -6, -7, 1, -2, 0, -4, 2, -4, 0, -2,
+   0, 2, -1, -1, 1, -5, -2, 6, -9, -10, 3, -1, 3, 2, -2, 3,
+   -3, 6, -3, 0, 0, 3, -2, -3, 1, 7, 4, -5, -4, -6, -2, -4,
+   8, 2, -4, -9, 1, 2, -5, -16, 3, -10, 0, -6, 3, 6, -6, 0,
+   5, -2, 4, -2, 3, -8, 5, -13, -2, 1, -9, 2, -6, -4, -2, -8,
+   1, -5, 4, 1, -1, 4, 9, 3, -3, -4, -2, -6, 4, -2, -2, -1,
+   3, -2, -6, 0, -9, 9, 2, -8, 7, -6, -14, -3, 4, 2, 7, -10,
+   -3, -1, -2, 4, -2, -6, -3, -3, 11, 2, -6, -4, 0, -4, -4, 1,
+   7, 8, 2, -4, -4, -5, -7, -9, 0, 10, 2, -8, 4, -2, -6, 0,
+   4, 1, 3, 2, 4, -3, 0, 7, 0, -6, -2, 7, 1, -1, -5, -2,
+   6, 6, -2, -1, -1, 0, -5, -9, 1, -4, 4, -1, 9, 4, 1, -3,
+   -5, 1, 5, -14, 6, 7, -3, 5, 1, 0, 2, -5, -13, 4, -8, -6,
+   -9, 2, -4, -3, -6, -8, -2, 5, 4, -6, 4, 11, 4, 4, 6, 1,
+   -4, -3, 1, 4, 2, -3, 2, 3, 7, -8, -5, 1, 0, 1, 3, 2,
+   6, 2, -1, 1, -3, 2, 7, -1, 5, 0, -11, 0, 5, -5, 2, 1,
+   -2, -6, 1, -3, -5, -1, 1, -5, -2, 0, 0, -1, 3, 7, 3, 0,
+   -5, -6, 0, -5, 4, 7, -5, -2, 1, 2, -7, -7, -1, -7, -6, 5,
+   -2, -4, 4, -1, -3, -5, -1, -1, -4, 5, 1, -2, 2, 2, -8, -8,
+   -4, 2, 7, -3, 10, -1, 1, -6, 1, 1, -3, -10, 3, 4, -1, 0,
+   6, -1, -5, 4, 1, -4, 5, 9, 2, -4, 1, -4, -2, 4, 3, -5,
+   1, 3, -6, -7, 4, -6, -4, 2, -8, 0, 7, 4, -10, -7, 4, -1,
+   -8, 3, -4, 3, 6, 4, -9, 7, -6, 0, 0, -3, -12, -6, 1, -3,
+   -1, 0, 3, 0, 3, 4, -4, 5, 7, 7, -6, -2, -3, 2, 1, -10,
+   -7, -2, -10, 9, 3, -1, 1, -7, 9, -1, -11, -3, 0, -3, -4, 5,
+   5, -5, 1, -3, 7, -6, -3, -2, -2, 0, -4, 1, 2, -7, 1, -2,
+   -4, -15, -4, 1, 8, 0, -1, 3, 6, 7, 6, 5, -5, -12, -1, 7,
+   -2, -1, 16, 3, -8, -3, -1, 4, -2, -5, -6, 12, -3, 2, -1, 0,
+   4, 3, 6, 1, -9, 2, 0, -5, 7, -3, 9, -2, -2, -1, 6, -2,
+   -11, 1, 4, -3, -4, 0, -6, 4, 2, 5, -10, 1, -2, 6, 3, 4,
+   2, 2, -3, 6, -6, -4, 1, -8, 4, -8, -12, -4, -5, -1, 1, -3,
+   -7, 4, -5, -5, -3, -4, -4, -9, 1, 5, 5, 0, -7, -1, 3, 6,
+   -4, -6, -6, -3, -8, 0, -2, -11, 14, -4, -6, 7, 2, 5, 7, 5,
+   5, 2, 0, -4, -10, -1, 1, 0, -6, -4, -8, -4, 5, 0, 2, -4,
+   -7, -2, -1, -9, 2, 4, 0, 0, -5, 0, 7, 2, 3, 9, 0, 7,
+   5, -4, 1, -7, 9, -4, 0, -2, 4, -1, -1, 1, -6, -7, 5, -1,
+   -9, 0, -2, -3, -6, 3, 0, 6, -5, -6, 0, -2, 6, 0, 6, 0,
+   -4, 9, 9, -6, 1, 3, 4, 7, 2, -5, -3, 3, -4, -6, -6, 4,
+   1, 6, -9, 3, 3, -2, 5, 8, -3, 1, -3, 3, 4, -11, -5, -11,
+   1, -8, 0, -5, 1, 2, 6, -1, -4, -2, 2, -6, -11, 7, 2, 2,
+   3, 7, 2, -15, -12, -16, -44, -49, -41, -37, -25, -22, 1, -17, -14, -4,
+   -18, -19, -37, -39, -43, -31, -4, -6, 2, 10, 2, -2, -2, 2, -10, -6,
+   -24, -18, -32, -47, -25, -14, -15, -8, -2, 16, 1, -7, -11, -6, -20, -36,
+   -55, -29, -11, -12, 1, 7, 1, -8, -2, -13, 6, -12, -9, -20, -31, -42,
+   -20, -1, 4, 9, 23, 23, 25, -3, 2, 2, -29, -26, -42, -30, -9, -5,
+   4, -1, -1, -4, -2, -3, -2, -12, -10, -14, -35, -35, -11, -3, -9, 4,
+   21, 13, 22, 18, 2, 4, -8, -21, -37, -24, -4, -3, -7, 0, -1, 6,
+   2, 0, 6, -12, -12, -9, -25, -24, -30, -16, -17, 1, -5, 9, 10, 14,
+   14, 8, -6, -11, -22, -14, 6, -2, 3, 1, -3, -8, 7, -2, 6, -8,
+   -20, -14, -12, -22, -11, 2, -15, -13, -10, -6, -18, -22, 3, -4, -5, -19,
+   -27, -18, 4, 6, 7, -6, -6, 3, -7, -10, 4, -10, -14, -7, -7, -1,
+   9, 6, 7, 1, -13, -32, -26, -39, -14, 1, -13, -25, -23, -10, 0, -3,
+   5, 12, 2, 6, -10, 2, 3, -8, -9, 4, -2, 20, 29, 26, 20, -15,
+   -39, -42, -31, -35, -29, -6, -6, -19, -20, -3, 14, 3, 0, -3, 8, -8,
+   12, 3, -7, -17, -15, 2, 29, 35, 37, 22, -3, -4, -31, -44, -29, -33,
+   -13, 11, 3, 13, 2, 7, 5, -4, -7, -4, -2, 8, -9, 0, 0, 0,
+   -1, -4, 20, 22, 26, 26, 10, 6, -10, -4, -5, 6, 6, 23, 22, 22,
+   9, 19, 9, 2, 9, 1, -4, -4, -5, 10, -5, 1, -10, -3, 19, 13,
+   10, 16, 33, 19, 17, 19, 26, 36, 48, 28, 32, 35, 13, 13, 14, 1,
+   -4, -3, 9, -4, 9, -1, -4, 0, 1, -11, 1, -12, -5, 8, 15, 19,
+   26, 36, 35, 45, 55, 38, 43, 28, 8, 17, 7, 7, -1, -1, -1, 2,
+   -5, -5, 5, -4, -22, -23, -19, -16, -12, -3, 6, 22, 20, 34, 42, 45,
+   37, 24, 33, 29, -12, -2, 2, 3, -4, 0, 2, -5, 2, 1, 1, -4,
+   -11, -19, -28, -21, -7, -3, 25, 34, 39, 53, 57, 64, 34, 11, 13, 20,
+   1, -4, 3, -4, -7, -5, -12, 0, 13, -3, 2, 2, -13, -6, -18, -12,
+   3, 8, 24, 36, 47, 51, 52, 62, 46, 9, 12, 5, -12, -7, -5, 0,
+   -9, -2, -1, -4, 0, -5, -2, -2, -5, 5, -10, -3, 17, 5, 28, 21,
+   33, 33, 34, 46, 39, 15, 4, 1, -15, -14, 1, -8, -5, 3, 3, -1,
+   -1, 2, 2, -3, -11, 12, 7, 30, 28, 24, 21, 18, 31, 24, 26, 37,
+   32, 16, 7, 11, -18, -14, 6, -3, 0, -5, -3, 3, 5, 0, -4, 8,
+   -7, 19, 25, 28, 25, 6, 15, 6, -5, 0, 13, -5, 10, 15, 21, 12,
+   -1, -11, 6, -6, -6, 5, 5, -5, -4, -4, 4, -3, -8, 14, 23, 27,
+   11, -7, 1, -14, -42, -38, -30, -30, 1, 2, 9, 11, 20, 3, 4, -7,
+   -2, 8, 6, 8, 5, -2, 1, 7, 2, 14, 17, 4, 1, -4, -7, -24,
+   -45, -30, -41, -19, -6, -3, -3, 3, 1, 6, 2, -2, -2, -1, 2, 4,
+   -7, 4, 4, -9, 1, 16, 7, 1, -6, -9, 2, -15, -32, -33, -33, -19,
+   -3, 8, 7, -1, -6, 2, -2, -6, 3, 8, 0, 0, -1, 1, 3, -4,
+   1, 4, 7, -3, 1, 3, -15, -21, -18, -15, -15, -10, -5, 2, 0, -11,
+   0, 9, -9, -1, -3, 0, 2, -1, 0, 9, 4, -8, 4, 13, -8, -4,
+   8, -3, -4, -5, -14, 6, 6, -10, -9, -4, -1, -5, 4, 2, -7, -8,
+   -1, 0, -3, 4, -5, 0, -2, -5, -10, 11, 4, -14, 11, -8, 12, 2,
+   -2, 0, 2, 1, -6, 9, 5, 2, -5, -17, -16, -1, 0, 1, 6, 3,
+   -9, 2, -3, -6, -14, 0, -10, -20, -15, 0, 16, 24, 15, 16, 11, 11,
+   5, -6, -11, -1, -10, -29, -10, -8, -3, -5, 1, 1, 3, -3, -1, -5,
+   -8, -7, -9, -18, -9, 4, 0, 24, 21, 10, -9, -13, -18, -8, 3, 8,
+   -18, -27, -3, -7, -15, 2, -4, 3, 1, 0, 1, -6, -11, -11, -21, -28,
+   -23, -19, -11, 12, 7, 8, 2, -13, -19, -3, 3, -11, -28, -22, -3, 1,
+   -9, -6, 2, -9, -4, 0, -3, -11, -10, -17, -28, -26, -48, -23, -12, -8,
+   -9, -21, -19, -2, -17, -7, -15, -32, -23, -15, -1, 0, 3, -9, 4, -9,
+   -4, 0, 4, 5, 10, 9, 5, -10, -19, -15, -14, 4, -1, 7, -5, -7,
+   -18, -7, -26, -22, 11, 10, 12, 1, 13, 2, -3, 14, -5, 0, 13, -1,
+   -4, 8, -18, -25, -38, -46, -20, 8, 25, 35, 36, 22, 8, -10, -39, -51,
+   -25, -2, 1, 0, -1, -5, -2, 1, 3, 4, 12, -4, 2, -6, -21, -34,
+   -39, -42, -34, -25, -15, 9, 20, 24, 8, 6, -21, -67, -45, -10, 1, -8,
+   1, 5, -2, 9, 2, 6, -3, 6, 10, -1, -14, -40, -42, -50, -32, -29,
+   -19, -6, 7, 7, -1, -18, -32, -61, -37, -25, -13, -4, -4, 6, 6, 3,
+   -2, -2, 5, 3, 5, 2, -5, -11, -22, -32, -26, -23, -31, -4, 22, -3,
+   -12, -32, -32, -43, -42, -31, -25, -4, -9, -2, 2, 2, 4, 4, -2, 4,
+   6, 9, 13, -4, -7, -16, -25, -13, -28, -11, -22, -42, -49, -48, -51, -56,
+   -52, -38, -16, 0, 9, 4, 1, -2, -10, 0, 3, 0, 3, 5, 16, -2,
+   -12, -19, -4, 15, -18, -18, -51, -53, -74, -41, -50, -49, -43, -28, -14, -4,
+   2, -5, 8, -1, -2, -8, -3, -3, 3, 9, 13, 18, 8, 19, 31, 18,
+   14, 8, -39, -47, -42, -21, -30, -19, -15, -6, 5, -3, 8, -9, 0, 5,
+   -2, -5, 6, -2, 5, 9, 7, 1, 4, 16, 19, 26, 38, 9, -41, -43,
+   -41, -32, -20, -5, -7, 0, 3, -7, 7, 2, 1, 1, -1, -3, 3, -2,
+   0, 7, -8, 3, -9, -20, -9, 18, 20, 4, -22, -36, -29, -20, -17, -3,
+   7, 10, 11, 2, 0, 5, 0, 14, 8, -1, 4, 4, 8, -1, -6, -27,
+   -12, -22, -14, 8, 29, 5, 4, -17, -29, -14, -21, 4, 5, 17, -4, -14,
+   -9, 0, 0, -1, 1, 2, 3, 5, -2, 0, -5, -11, -14, -12, -22, 3,
+   7, 1, -13, -19, -15, -20, -16, 3, 16, 6, -1, 0, -4, -6, 2, -6,
+   10, -2, 11, 8, -1, 12, -1, -16, -8, -15, -9, 0, -14, -15, -34, -20,
+   -30, -19, -24, -15, 10, -13, -4, -5, 1, 1, -9, -2, 4, 5, 11, -12,
+   6, 6, -5, -14, -6, 4, -13, -12, -28, -44, -38, -21, -25, -5, -6, -9,
+   3, -9, 2, -7, -8, -1, 0, -8, 9, 3, 0, 0, 15, 8, 3, 2,
+   -6, 2, -17, -22, -55, -52, -58, -31, -37, -19, -37, -17, -10, -11, 8, -9,
+   -2, 0, 6, -3, 5, 7, 6, 0, 9, 11, 11, 10, 10, 2, -13, -13,
+   -40, -77, -79, -50, -51, -20, -18, -11, -26, -16, -4, -6, -6, -1, -1, -3,
+   3, -6, 3, 3, 10, 11, 27, 15, 4, 7, -3, -10, -41, -57, -59, -61,
+   -24, -15, -13, -16, -13, -2, 2, -1, -1, -4, -13, 4, 2, -10, 9, 11,
+   6, 22, 25, 32, 25, 32, 7, 17, -37, -59, -64, -66, -45, -20, -26, -23,
+   -6, -4, -5, 4, -1, 1, 6, 0, 6, -1, 14, 5, 11, 29, 16, 29,
+   37, 29, 29, 31, -9, -51, -55, -50, -36, -28, -35, -19, -10, -3, 10, -9,
+   6, 4, 1, -8, 3, -3, 2, 7, 14, 18, 30, 49, 42, 53, 65, 30,
+   17, -14, -8, -17, -17, 13, 6, -9, -5, -2, -2, -4, 9, -5, -3, 0,
+   -9, 1, 2, 13, 17, 27, 10, 44, 46, 72, 79, 45, 38, -4, 31, 29,
+   11, 29, 22, 15, 19, 7, 6, 0, 1, 4, -2, -2, -8, 0, 8, 13,
+   -1, 18, 21, 47, 53, 39, 63, 61, 32, 19, 27, 48, 39, 42, 33, 29,
+   23, 5, 3, -10, -1, 0, 0, -5, -1, -11, 4, 4, 9, 29, 47, 37,
+   44, 41, 29, 58, 31, 10, 39, 39, 55, 48, 43, 27, 16, 13, 2, -3,
+   4, -4, 3, 6, 1, -1, -2, 8, 18, 26, 23, 35, 46, 33, 16, 10,
+   5, -6, -8, 34, 38, 28, 52, 35, 26, 7, 14, -6, 2, 1, -10, 0,
+   2, 6, 3, 10, 0, 24, 25, 29, 29, 17, 31, -6, -30, -9, -2, 33,
+   58, 51, 63, 64, 23, 6, 10, -1, 1, -1, -2, -12, 2, 4, 10, 5,
+   8, 16, 27, 31, 25, 28, 26, 2, -30, -11, -5, 27, 59, 68, 72, 51,
+   33, 15, 8, -4, -14, -4, 4, 1, -5, -6, 12, 4, 15, 9, 13, 23,
+   37, 32, 16, 10, -13, -6, 7, 18, 64, 74, 56, 21, 30, 6, 1, -5,
+   -3, 1, -8, -5, -3, 3, 3, 5, -1, 11, 16, 17, 15, 22, 13, 26,
+   -11, 12, 19, 24, 31, 39, 26, 10, -1, -11, -8, -8, -2, -6, 0, -2,
+   -1, 3, 0, 4, -19, 3, 29, 52, 41, 18, 11, 5, 9, 23, 24, 35,
+   24, 10, 28, 52, 68, 29, 14, -4, -1, -9, 1, 6, 2, -5, 1, -2,
+   -7, 2, 17, 37, 29, 8, -7, -13, -10, 1, -6, 11, 4, -3, 18, 27,
+   39, 26, 12, -5, 1, -1, 5, -1, 7, -6, -6, 6, -12, -5, 15, 31,
+   6, -15, -15, -13, -29, -23, -25, -5, -4, -20, -2, 37, 49, 28, 16, 4,
+   5, 7, -6, 5, 1, 5, -2, -8, -7, -8, 11, 20, 0, -12, 3, -16,
+   -4, 3, -9, -13, -3, 1, 8, 25, 43, 17, 27, 7, -1, 3, 1, -2,
+   -6, -3, 3, 1, -5, 0, 0, 20, -15, -2, -14, -16, -13, 13, -1, 8,
+   11, 7, 9, 22, 51, 25, 21, 1, 1, 7, 4, 8, -2, 1, -5, 3,
+   -1, 8, -3, 2, -14, -2, -19, 2, -4, 4, 1, 13, 21, 27, 16, 20,
+   43, 28, 16, -1, -3, -2, -3, 8, -5, -3, 5, -1, -13, -13, 0, 6,
+   -10, -17, -20, 7, 11, 8, -4, -7, 17, 8, 21, -5, 31, 6, 15, 10,
+   0, 1, 1, -2, 6, 3, -7, -2, -12, -10, -16, 10, -7, -29, -18, 3,
+   15, 24, -3, -13, 5, -19, 8, 3, 32, 4, 18, 5, 7, -1, 6, -4,
+   -4, 2, -1, 2, -18, -6, -27, -14, -27, -9, -33, -13, 9, 7, 13, -14,
+   -13, -6, 0, 0, -5, -6, 23, 2, 5, 3, 2, 3, -3, -4, -8, -7,
+   -9, -2, -17, -15, -42, -22, -37, -7, -10, 17, 8, -26, -6, -28, 9, -14,
+   -2, -19, -3, 5, 4, 6, 6, 5, 4, -7, -8, -4, -5, -12, -24, -33,
+   -51, -46, -40, -28, -16, 23, 18, -20, -5, -25, -8, -25, 0, -8, 0, 5,
+   -4, -2, -4, -1, 6, -6, -5, 7, 10, 3, -30, -35, -55, -66, -40, -41,
+   -21, 10, 3, -20, -11, -17, -21, -33, -18, -18, 12, -5, -1, -11, -2, 3,
+   -2, 5, -6, 0, 7, -2, -14, -31, -55, -49, -36, -53, -44, -31, -23, -33,
+   -49, -27, -38, -53, -18, -27, 3, 12, 2, 6, -1, -2, 6, -2, 6, 3,
+   -8, 10, -3, 6, -32, -48, -30, -58, -70, -52, -51, -33, -30, -44, -47, -57,
+   -34, -22, -2, 6, 7, 1, -4, -4, -6, -6, 0, 2, 14, 8, 22, 28,
+   5, -25, -38, -36, -47, -36, -43, -52, -32, -30, -44, -54, -36, -33, -8, -5,
+   5, 2, 5, -1, 2, -7, -3, 9, 5, 20, 41, 46, 30, -14, -12, -10,
+   -25, -19, -6, -36, -14, -28, -47, -46, -15, -27, -4, -3, 8, -7, 4, 3,
+   -8, 3, -7, 6, 7, 22, 38, 55, 46, 13, 22, 33, 19, 13, 23, -4,
+   -10, -17, -58, -60, -36, -30, -13, -4, 0, 3, 10, -4, -4, 5, 1, 5,
+   17, 16, 30, 44, 44, 26, 61, 94, 95, 80, 63, 44, -5, -52, -68, -84,
+   -53, -36, -27, -17, 1, -5, -4, 2, 2, -3, 1, 10, 14, 23, 22, 31,
+   23, 27, 56, 72, 91, 97, 67, 35, -8, -62, -63, -73, -41, -44, -28, 4,
+   -2, -2, -2, 8, 9, 4, 2, 9, 7, 21, 19, 11, 6, 23, 23, 44,
+   60, 64, 43, 21, -13, -47, -61, -60, -39, -56, -36, -19, 5, 1, 4, 6,
+   -10, -2, 2, 6, 2, 26, 12, 7, -3, 2, 4, 11, 17, 31, 1, 10,
+   -22, -33, -35, -31, -16, -45, -27, -13, -7, -4, -6, 12, 1, -3, -2, 9,
+   -14, 5, -3, 4, -25, -11, -17, -25, -20, 9, -6, 13, -1, 2, -5, -14,
+   6, -36, -21, -18, 4, -4, 1, 10, 4, 3, 1, 5, 2, -8, -11, 0,
+   -35, -50, -31, -22, -24, -21, 3, 27, 34, 35, 19, -7, 1, -19, -14, -20,
+   1, 5, 3, 0, 1, 7, 2, 3, 2, -8, -17, 16, -15, -38, -30, -6,
+   3, -4, 22, 26, 30, 31, 8, 15, 17, -5, -1, -1, 4, 7, -6, -7,
+   7, 0, 0, 3, -5, -9, 1, 13, 1, -24, -46, -43, -33, -34, 1, 13,
+   17, 28, 27, 37, 53, 20, 4, 2, -7, 0, -1, -4, 1, 9, -10, 3,
+   -9, 7, 20, 40, 25, 13, -19, -39, -43, -45, -17, 2, 24, 37, 50, 56,
+   67, 23, 5, 13, 3, -3, 1, -5, -3, -7, 0, -7, -11, -1, 18, 48,
+   24, 8, -15, -34, -32, -40, -10, 12, 40, 50, 59, 61, 59, 18, 0, 8,
+   8, 10, 2, 1, -5, -4, -8, 1, -11, -7, 10, 54, 40, 36, 15, -4,
+   -11, -14, 6, 35, 45, 46, 49, 42, 69, 15, -8, -1, 4, -8, -7, -7,
+   -3, -6, -2, -1, -1, 18, 34, 26, 20, 2, 15, 15, 10, 10, 16, 9,
+   -1, 11, -2, -4, -1, -33, -20, -19, -4, 4, -2, -6, 6, -1, -7, 6,
+   5, 17, 12, 30, 22, 27, 9, 10, 11, 8, -13, -14, -14, -18, -14, -2,
+   -11, -30, -21, -4, 2, 5, -1, 6, 4, 4, 4, 6, 1, 30, 22, 27,
+   37, 32, 17, 17, 10, -4, 17, 1, -18, -28, -34, -22, 5, -1, -18, -10,
+   -5, -2, -5, 4, -6, -4, 5, 9, 2, 17, 25, 25, 47, 40, 44, 56,
+   51, 22, -5, 0, -3, -13, -15, -11, 0, 6, -7, 2, -7, 2, 1, 1,
+   2, 7, 6, 7, 2, 6, 15, 17, 38, 32, 26, 32, 31, 33, 17, 1,
+   3, -6, 0, 17, 26, 23, 8, 5, 2, -3, 6, -4, 14, -1, 3, 10,
+   -5, 6, 34, 22, 14, 1, -6, 16, 30, 26, 27, -11, -2, -5, 13, 38,
+   58, 39, 26, 4, -3, 6, 6, 2, 1, -6, -2, 5, 2, 12, 13, 17,
+   -6, -25, -18, -1, 4, 29, 22, 17, 25, 25, 28, 40, 71, 29, 28, 5,
+   -4, -8, 4, -2, -3, -1, 3, 3, -5, 12, 8, 22, -37, -33, -36, -14,
+   14, 57, 52, 72, 75, 63, 36, 40, 58, 31, 23, 6, -1, -4, 0, -3,
+   -5, 2, 5, 11, -8, 6, 3, -7, -29, -20, -18, -28, -4, 17, 63, 94,
+   93, 59, 55, 36, 41, 42, 20, 2, 6, 4, 1, 2, 8, 3, 8, 7,
+   -1, -7, 1, -33, -28, -31, -31, -39, -46, -6, 32, 73, 102, 73, 79, 50,
+   57, 32, 14, 7, 4, -4, 0, 3, 2, -1, 5, 4, -7, 2, -14, -27,
+   -31, -46, -23, -38, -59, -28, -9, 39, 74, 68, 56, 46, 52, 27, 19, 4,
+   4, 4, -6, 6, 2, 5, 3, -2, -11, -24, -26, -31, -43, -46, -27, -28,
+   -49, -42, -44, -12, -2, 21, 11, 18, 28, 32, 23, 11, 1, 6, 4, -7,
+   0, -3, 0, 3, -17, -24, -37, -34, -46, -46, -38, -59, -49, -34, -40, -26,
+   -8, -8, -19, -2, 26, 46, 31, 11, -8, -7, -7, -3, -3, 0, 5, 5,
+   -15, -35, -28, -21, -20, -39, -36, -52, -49, -60, -57, -30, -20, -19, -14, -35,
+   6, 21, 21, 11, -3, 5, 1, 4, -7, 1, 0, 2, -19, -38, -24, -4,
+   -6, -24, -21, -42, -37, -66, -39, -34, -34, -20, -25, -50, -7, 8, 18, 0,
+   0, 3, 8, -5, 0, 9, 9, 6, -29, -24, 2, 7, 4, -17, -34, -34,
+   -22, -14, -15, -30, -35, -25, -15, -37, -27, 18, 9, 1, 0, 0, -1, 4,
+   -2, -8, 0, 2, -23, -17, 1, 7, -2, -10, 1, -24, 11, 14, 37, 0,
+   -27, -35, -21, -36, -9, 8, 1, -8, -3, 1, 0, 3, 1, -5, 11, 5,
+   -29, -7, 0, 8, -2, -18, -7, 2, 31, 62, 65, 45, 2, -17, -12, -27,
+   -11, -13, 0, -7, -3, 6, -5, -6, 10, -4, 0, 8, -16, -17, 12, 3,
+   -37, -27, -36, 11, 39, 59, 60, 58, 22, -4, -14, -24, 4, -14, -11, -16,
+   5, 7, -4, 4, -10, 7, 0, 3, -6, -11, -5, -10, -24, -34, -46, -19,
+   12, 41, 49, 32, 17, -23, -1, -20, -5, -22, -21, -17, -3, 0, 11, 2,
+   -3, -4, -3, -10, -18, -8, -3, -5, -27, -50, -36, -18, -1, 4, 40, -3,
+   -16, -24, -29, -55, -17, -20, -23, -10, -4, -2, 1, 3, 2, 3, 4, 5,
+   -3, -6, -3, -17, -41, -36, -34, -17, -15, -22, -4, -23, -35, -13, -44, -43,
+   -13, -42, -30, -8, 3, 0, -8, 0, 5, -9, 0, 4, 1, -11, -17, -27,
+   -44, -54, -32, -17, -19, -19, -8, -27, -19, -27, -36, -31, -31, -31, -23, -15,
+   5, -7, 1, -1, -1, -3, 9, 3, 3, -6, -13, -32, -32, -38, -32, -4,
+   12, 9, -1, -11, -2, -7, -32, -29, -14, -17, -14, -8, 4, 1, -9, 2,
+   0, 4, 3, -2, 0, -2, -8, -1, -23, -27, -28, -17, -15, -4, 5, 3,
+   2, -15, -35, -21, -3, -4, -20, -3, 5, -4, -6, 0, -6, 8, 5, 7,
+   -7, 14, 15, 3, -10, -21, -18, -12, -14, -14, -13, -13, -30, -37, -29, -15,
+   -5, -7, -15, -2, -1, 6, -2, 4, 0, 2, 7, 3, -3, 9, 14, 1,
+   8, -6, 4, -14, -19, -10, 1, 21, 4, 15, 5, -9, 2, 3, -11, 4,
+   2, 8, -2, 4, 8, 8, 7, 8, -5, 6, 17, 12, 6, 6, 9, 6,
+   1, 10, 25, 28, 31, 11, 10, 14, 25, 21, -3, 3, -5, -8, 0, -3,
+   7, 6, 2, -6, -6, -3, -2, 5, -11, -1, 4, -4, -3, 8, -3, -2,
+   -5, -17, -2, 1, -1, 0, -5, -4, 2, 2, -3, 2, 10, 1, 12, 4,
+   -9, 2, -5, 1, 1, -7, 2, -4, -1, -1, -1, 3, 3, 3, 2, -4,
+   -8, -4, -5, -3, -6, -4, 2, 2, -1, -5, 7, 2, 2, 2, -5, -3,
+   1, 2, 0, 0, -1, 1, 3, 10, -1, 1, -2, -5, -5, -8, 0, -8,
+   -1, -7, -1, 4, 7, 2, 4, -4, -11, -2, -3, 0, 2, 0, -1, 2,
+   4, 5, 2, 6, -2, 0, 5, 15, -6, 0, -3, -5, -1, -4, -3, 3,
+   -3, -2, 3, -4, -4, 0, 9, -3, -4, -5, 0, -9, 4, -6, -4, -7,
+   -11, -1, 2, 8, 1, 8, -1, -8, 1, 12, -4, 4, -7, 3, 1, 5,
+   3, 7, -2, -8, -2, -4, -7, 3, 9, -8, -5, 3, -3, -2, -3, 0,
+   -7, 0, -3, -2, 0, -7, -1, 4, 3, 3, -5, 1, -14, -12, -6, -4,
+   0, -3, -1, -2, -1, -3, 3, -12, -6, -12, 0, -8, -2, 9, -8, 0,
+   6, -5, 6, -10, 5, 3, 1, -1, -8, 9, -2, -10, -4, 1, 0, -8,
+   4, -3, 2, 3, -4, 3, 0, 6, 1, -1, -1, 2, 4, -5, 3, 9,
+   -3, -3, -4, 10, 5, -2, 2, 2, 2, 7, -9, -7, -3, -2, -5, -5,
+   -3, -2, -5, 2, 1, -1, -5, -9, 1, 2, -7, 1, -8, 0, -2, -5,
+   1, 5, -2, 6, 0, -4, -1, -11, -3, 0, -1, -2, -1, -6, -4, -4,
+   4, 0, -2, -5, 2, -6, -2, -8, 6, -4, 2, 2, 2, 1, -7, -4,
+   -5, -4, -5, -9, -7, -10, -3, 0, -1, 2, 2, 4, -5, 0, 4, -5,
+   9, -7, -3, -6, -6, -11, 0, -15, -3, -4, -3, -3, -2, -2, -12, -3,
+   -1, 5, -3, -8, 0, -8, 0, -6, -6, -6, 1, 3, 3, 3, -2, -3,
+   -4, 6, 1, 0, -13, 0, 4, 3, 6, -7, 3, 0, -4, 4, -3, -3,
+   -3, 0, 1, 9, -5, 2, -5, 1, 5, -1, -4, -4, 0, -9, 1, 0,
+   0, 2, 1, -5, -1, 4, 3, -1, -5, 3, -7, -2, -2, -5, 2, 2,
+   0, -2, 4, 8, -6, 2, -2, 4, -6, 1, 7, -5, -6, 7, 4, 3,
+   -7, 2, 12, 2, -5, 1, 0, 2, 0, -4, -6, 0, -2, -2, 4, 1,
+   7, -14, -1, 2, 2, 2, -3, 3, -7, -11, -4, -9, 5, -3, 7, -4,
+   2, -3, -3, -1, 1, -3, 1, 3, 4, -3, 4, -4, -1, -3, 7, -7,
+   -4, 6, -2, 7, -1, 7, -13, -2, -7, 0, -1, 0, 0, -3, -8, 3,
+   -3, 1, -8, 0, -1, -2, 3, -4, 4, -3, 5, -1, 5, -6, 4, -3,
+   8, 3, -4, 1, -5, -11, 6, 0, -7, -10, 8, -4, -6, -10, -10, 9,
+   -3, -3, 6, 0, -4, -8, -2, 4, 9, -10, 1, 3, -4, -2, 2, 2,
+   0, -4, 0, 2, 1, -15, 0, 2, 3, -8, -4, -10, -2, 3, -4, -5,
+   4, 8, 0, -3, -8, 5, -5, -7, 0, 4, 2, 5, 4, -7, 4, 1,
+   -5, -7, 4, -5, 3, -3, 7, 0, 0, 9, 1, -4, -2, -7, 0, 2,
+   3, -5, 9, 4, 3, -13, 2, 3, 8, 8, 1, -6, 3, -3, -1, -7,
+   -6, 5, -13, -7, -11, 8, -5, -12, -1, 6, -1, 1, 6, 2, 0, 6,
+   -2, 2, -8, -6, 7, -1, 5, 1, -1, -6, -4, -2, 4, -2, 5, -3,
+   -2, 0, -10, 3, 3, -10, 9, 2, -8, 0, -7, 3, 2, -11, -3, -11,
+   1, 1, -7, -5, 3, -5, -8, -1, 2, 2, -2, 12, 1, 0, -1, -12,
+   -1, 1, 3, 4, -1, 3, -7, 0, 4, 8, 5, 2, -1, -16, -2, -8,
+   -5, 1, 2, -6, -2, -3, 1, 3, -2, -1, -4, 2, 0, 0, 3, -5,
+   8, -2, -8, 10, -7, -5, 3, 5, -14, 1, -1, -2, 3, 1, -3, -8,
+   -4, -4, 1, -1, 2, -6, -2, 10, 2, -6, -1, -3, -1, -4, -3, -2,
+   -4, -2, -1, -4, 0, -4, 0, -7, 7, -7, 1, -1, -9, -5, -1, -4,
+   -14, -5, -3, -5, 3, -4, 4, -8, 7, -1, -3, -8, 3, -3, 3, 2,
+   -1, 3, -5, -19, -1, -2, -5, -1, -1, 10, 3, -2, 5, 4, 1, 3,
+   2, -3, 5, -2, 1, 0, 0, 1, 7, -6, 2, 4, 2, 2, 3, 4,
+   6, -1, 0, 9, -4, 1, 5, -10, -11, 2, 1, -6, -1, -3, -2, -6,
+};
@@ -0,0 +1,31 @@
+#ifndef __digitModel_H__
+#define __digitModel_H__
+
+#include "os_port.h"
+#include "source/camera/digitPrep.h"
+
+/**
+ * weights of the fallback digit classifier, a two layer perceptron:
+ * 784 crop pixels -> DIGIT_MODEL_HIDDEN relu units -> 10 logits.
+ *
+ * digitModel.c is generated by tools/digitModel/digitTrain,
+ * see tools/digitModel/README.md for the quantization scheme.
+ */
+#define DIGIT_MODEL_HIDDEN 32
+#define DIGIT_MODEL_CLASSES 10
+
+// row major, one row of DIGIT_CROP_PIXELS weights per hidden unit
+extern const int8_t digitModelHiddenWeights[DIGIT_MODEL_HIDDEN * DIGIT_CROP_PIXELS];
+extern const int32_t digitModelHiddenBias[DIGIT_MODEL_HIDDEN];
+
+// hidden = clamp((acc * mult) >> shift, 0, 127), rounded
+extern const int32_t digitModelHiddenMult;
+extern const uint8_t digitModelHiddenShift;
+
+extern const int8_t digitModelOutputWeights[DIGIT_MODEL_CLASSES * DIGIT_MODEL_HIDDEN];
+extern const int32_t digitModelOutputBias[DIGIT_MODEL_CLASSES];
+
+// real logit = integer logit * digitModelLogitScale
+extern const float digitModelLogitScale;
+
+#endif
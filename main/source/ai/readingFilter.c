@@ -0,0 +1,194 @@
+#include <string.h>
+#include "readingFilter.h"
+#include "source/storage/storage.h"
+#include "source/appEnv.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#define LOG_TAG "readingFilter"
+
+// marks the digits of a meter without a committed value in meterCounter
+#define UNCOMMITTED '-'
+
+typedef struct _Vote Vote;
+typedef struct _VoteHistory VoteHistory;
+
+struct _Vote
+{
+   char_t digits[MAX_DIGIT_COUNT];
+   uint16_t confidence; // per mille
+};
+
+// the last raw reads of one meter (a ring buffer)
+struct _VoteHistory
+{
+   Vote votes[READING_FILTER_WINDOW];
+   uint8_t count;
+   uint8_t next;
+};
+
+// guarded by the writer lock of aiTask.c
+static VoteHistory histories[MAX_METER_COUNT];
+static bool_t counterDirty = FALSE;
+static int64_t lastSave = 0;
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void readingFilterReset();
+bool_t readingFilterApply(AiReading *reading);
+static bool_t filterMeterHelper(VoteHistory *history,
+   const AiMeterReading *meter, const char_t *raw, char_t *committed);
+static const Vote* electHelper(const VoteHistory *history,
+   uint_t digitCount, uint_t *count);
+static bool_t isForward(const char_t *next, const char_t *committed, uint_t digitCount);
+static void saveCounterHelper();
+
+// ********************************************************************************************
+
+void readingFilterReset()
+{
+   memset(histories, 0, sizeof(histories));
+}
+
+// ********************************************************************************************
+
+bool_t readingFilterApply(AiReading *reading)
+{
+   char_t *counter = appEnv.meterCounter;
+   uint_t digitCount = strlen(reading->raw);
+
+   // nothing committed for this layout yet
+   if (strlen(counter) != digitCount)
+   {
+      memset(counter, UNCOMMITTED, digitCount);
+      counter[digitCount] = '\0';
+   }
+
+   bool_t changed = FALSE;
+   for (uint_t m = 0; m < reading->meterCount; m++)
+   {
+      AiMeterReading *meter = &reading->meters[m];
+      const char_t *raw = reading->raw + meter->offset;
+      char_t *committed = counter + meter->offset;
+
+      if (filterMeterHelper(&histories[m], meter, raw, committed))
+         changed = TRUE;
+
+      meter->stable = committed[0] != UNCOMMITTED;
+      memcpy(reading->value + meter->offset,
+         meter->stable ? committed : raw, meter->digitCount);
+   }
+   reading->value[digitCount] = '\0';
+
+   if (changed)
+   {
+      ESP_LOGI(LOG_TAG, "committed '%s'", counter);
+      counterDirty = TRUE;
+   }
+   saveCounterHelper();
+
+   return changed;
+}
+
+// ********************************************************************************************
+
+/**
+ * adds the raw digits of a meter to its history and commits the
+ * winner of the vote if it is plausible. returns TRUE on a commit.
+ */
+static bool_t filterMeterHelper(VoteHistory *history,
+   const AiMeterReading *meter, const char_t *raw, char_t *committed)
+{
+   uint_t digitCount = meter->digitCount;
+
+   Vote *vote = &history->votes[history->next];
+   memcpy(vote->digits, raw, digitCount);
+   vote->confidence = meter->confidence;
+   history->next = (history->next + 1) % READING_FILTER_WINDOW;
+   if (history->count < READING_FILTER_WINDOW)
+      history->count++;
+
+   uint_t count;
+   const Vote *winner = electHelper(history, digitCount, &count);
+   if (count < READING_FILTER_QUORUM ||
+      !memcmp(winner->digits, committed, digitCount))
+      return FALSE;
+
+   bool_t hasCommitted = committed[0] != UNCOMMITTED;
+   if (hasCommitted && !isForward(winner->digits, committed, digitCount))
+   {
+      if (count < READING_FILTER_WINDOW)
+      {
+         ESP_LOGI(LOG_TAG, "%.*s is below the counter, rejected",
+            (int) digitCount, winner->digits);
+         return FALSE;
+      }
+      ESP_LOGI(LOG_TAG, "every vote is below the counter, resetting it");
+   }
+
+   memcpy(committed, winner->digits, digitCount);
+   return TRUE;
+}
+
+/**
+ * returns the digits with the largest summed confidence among the
+ * votes and in (count) how many votes they got
+ */
+static const Vote* electHelper(const VoteHistory *history,
+   uint_t digitCount, uint_t *count)
+{
+   const Vote *winner = NULL;
+   uint32_t winnerWeight = 0;
+   *count = 0;
+
+   for (uint_t i = 0; i < history->count; i++)
+   {
+      const Vote *vote = &history->votes[i];
+      uint32_t weight = 0;
+      uint_t votes = 0;
+
+      for (uint_t j = 0; j < history->count; j++)
+      {
+         if (!memcmp(history->votes[j].digits, vote->digits, digitCount)) {
+            weight += history->votes[j].confidence;
+            votes++;
+         }
+      }
+
+      if (winner == NULL || weight > winnerWeight) {
+         winner = vote;
+         winnerWeight = weight;
+         *count = votes;
+      }
+   }
+
+   return winner;
+}
+
+/**
+ * the counter may only count up, or roll over from 9... to 0...
+ * (both are fixed width strings of decimal digits)
+ */
+static bool_t isForward(const char_t *next, const char_t *committed, uint_t digitCount)
+{
+   if (memcmp(next, committed, digitCount) >= 0)
+      return TRUE;
+
+   return committed[0] == '9' && next[0] == '0';
+}
+
+// ********************************************************************************************
+
+// the counter changes with every unit, so the flash is written lazily
+static void saveCounterHelper()
+{
+   int64_t now = esp_timer_get_time();
+   if (!counterDirty || (lastSave != 0 &&
+      now - lastSave < READING_FILTER_SAVE_INTERVAL_MS * 1000LL))
+      return;
+
+   if (saveMeterCounter(appEnv.meterCounter))
+      counterDirty = FALSE;
+   lastSave = now;
+}
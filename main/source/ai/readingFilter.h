@@ -0,0 +1,38 @@
+#ifndef __readingFilter_H__
+#define __readingFilter_H__
+
+#include "os_port.h"
+#include "source/mqtt/aiTask.h"
+
+/**
+ * temporal filter between the classified digits and the published
+ * reading (see aiTask.c). a meter is a counter, so a single misread
+ * digit must not reach mqtt:
+ *
+ * 1. the last READING_FILTER_WINDOW raw reads of each meter vote,
+ *    weighted by their confidence. the winner is committed once it
+ *    was read READING_FILTER_QUORUM times.
+ * 2. a counter only moves forward: a winner below the committed value
+ *    is only taken if it rolled over (9... to 0...), or if every vote
+ *    agrees (the meter was replaced or the committed value was wrong).
+ *
+ * the committed digits are kept in appEnv.meterCounter (one meter
+ * after the other like AiReading.value, '-' for the meters that have
+ * none yet) and saved at most every READING_FILTER_SAVE_INTERVAL_MS.
+ */
+#define READING_FILTER_WINDOW 5
+#define READING_FILTER_QUORUM 3
+#define READING_FILTER_SAVE_INTERVAL_MS 600000
+
+// forgets the votes (the digit layout changed)
+void readingFilterReset();
+
+/**
+ * votes the raw digits of (reading) and fills reading->value with
+ * the committed value of each meter (the raw digits while a meter has
+ * none yet, see AiMeterReading.stable).
+ * returns TRUE if a committed value changed.
+ */
+bool_t readingFilterApply(AiReading *reading);
+
+#endif
@@ -0,0 +1,433 @@
+#include <stdlib.h>
+#include <string.h>
+#include "digitLocate.h"
+
+// radius of the local mean window as a fraction of the frame height
+#define LOCATE_RADIUS_DIVISOR 20
+
+// keeps the column sums of (2 * radius + 1) rows within 16 bits
+#define LOCATE_MAX_RADIUS 64
+
+// gray levels a pixel must stand out of its local mean
+#define LOCATE_OFFSET 12
+
+#define NO_LABEL 0xFFFF
+
+// ********************************************************************************************
+// forward declaration of functions
+
+bool_t digitLocate(const uint8_t *frame, uint_t width, uint_t height,
+   DigitLocateScratch *scratch, DigitLocation *location);
+uint_t digitLocateCandidates(const uint8_t *frame, uint_t width,
+   uint_t height, bool_t dark, DigitLocateScratch *scratch);
+static uint_t thresholdRow(const uint8_t *row, uint_t width, uint_t radius,
+   uint_t rows, bool_t dark, DigitLocateScratch *scratch, DigitRun *runs);
+static uint_t finishComponents(DigitLocateScratch *scratch,
+   const DigitRun *runs, uint_t count, uint_t y,
+   uint_t width, uint_t height, uint_t candidates);
+static uint16_t findLabel(uint16_t *parents, uint16_t label);
+static void mergeLabels(DigitLocateScratch *scratch, uint16_t a, uint16_t b);
+static bool_t isDigitShaped(const DigitComponent *c, uint_t width, uint_t height);
+static uint_t findDigitRow(const DigitComponent *candidates, uint_t count,
+   uint_t *chain);
+static void makeBoxes(const DigitComponent *candidates, const uint_t *chain,
+   uint_t count, uint_t width, uint_t height, DigitLocation *location);
+
+// ********************************************************************************************
+
+bool_t digitLocate(const uint8_t *frame, uint_t width, uint_t height,
+   DigitLocateScratch *scratch, DigitLocation *location)
+{
+   location->digitCount = 0;
+   if (width > DIGIT_LOCATE_MAX_WIDTH || width < 8 || height < 8)
+      return FALSE;
+
+   uint_t bestHeight = 0;
+   for (uint_t polarity = 0; polarity < 2; polarity++)
+   {
+      bool_t dark = polarity == 0;
+      uint_t count = digitLocateCandidates(frame, width, height, dark, scratch);
+
+      uint_t chain[DIGIT_LOCATE_MAX_DIGITS];
+      uint_t length = findDigitRow(scratch->candidates, count, chain);
+      if (length < 2) continue;
+
+      // the longer row wins, then the taller one
+      const DigitComponent *first = &scratch->candidates[chain[0]];
+      uint_t rowHeight = first->maxY - first->minY + 1;
+      if (length < location->digitCount ||
+         (length == location->digitCount && rowHeight <= bestHeight))
+         continue;
+
+      bestHeight = rowHeight;
+      location->invert = dark;
+      makeBoxes(scratch->candidates, chain, length, width, height, location);
+   }
+
+   return location->digitCount > 0;
+}
+
+// ********************************************************************************************
+
+/**
+ * the frame is thresholded one row at a time and the foreground runs
+ * of every row are linked to the overlapping runs of the row above.
+ * the bounding box and the area of a component are kept on its root
+ * label and merged when two labels turn out to be the same component.
+ * a component that doesn't reach the current row is complete: it is
+ * checked for a digit shape and its labels are recycled.
+ */
+uint_t digitLocateCandidates(const uint8_t *frame, uint_t width,
+   uint_t height, bool_t dark, DigitLocateScratch *scratch)
+{
+   uint_t radius = height / LOCATE_RADIUS_DIVISOR;
+   if (radius < 2) radius = 2;
+   if (radius > LOCATE_MAX_RADIUS) radius = LOCATE_MAX_RADIUS;
+
+   // column sums of the rows [y - radius, y + radius]
+   memset(scratch->columnSums, 0, width * sizeof(uint16_t));
+   for (uint_t y = 0; y <= radius && y < height; y++)
+      for (uint_t x = 0; x < width; x++)
+         scratch->columnSums[x] += frame[y * width + x];
+
+   // labels are handed out from the top of the stack
+   for (uint_t i = 0; i < DIGIT_LOCATE_MAX_LABELS; i++)
+      scratch->freeLabels[i] = DIGIT_LOCATE_MAX_LABELS - 1 - i;
+   scratch->freeCount = DIGIT_LOCATE_MAX_LABELS;
+   scratch->releasedCount = 0;
+
+   uint_t candidates = 0, previousCount = 0;
+   DigitRun *previous = scratch->runs[1];
+
+   for (uint_t y = 0; y < height; y++)
+   {
+      uint_t top = y > radius ? y - radius : 0;
+      uint_t bottom = y + radius < height ? y + radius : height - 1;
+
+      DigitRun *runs = scratch->runs[y & 1];
+      uint_t count = thresholdRow(frame + y * width, width, radius,
+         bottom - top + 1, dark, scratch, runs);
+
+      // runs are sorted, so the overlapping ones are found in one sweep
+      uint_t first = 0;
+      for (uint_t i = 0; i < count; i++)
+      {
+         DigitRun *run = &runs[i];
+         uint16_t label = NO_LABEL;
+
+         while (first < previousCount && previous[first].end + 1 < run->start)
+            first++;
+
+         for (uint_t k = first; k < previousCount &&
+            previous[k].start <= run->end + 1; k++)
+         {
+            if (previous[k].label == NO_LABEL) continue;
+            if (label == NO_LABEL) label = previous[k].label;
+            else mergeLabels(scratch, label, previous[k].label);
+         }
+
+         // without a free label the run is dropped
+         if (label == NO_LABEL && scratch->freeCount > 0)
+         {
+            label = scratch->freeLabels[--scratch->freeCount];
+            scratch->parents[label] = label;
+            DigitComponent *c = &scratch->components[label];
+            c->minX = run->start;
+            c->maxX = run->end;
+            c->minY = y;
+            c->area = 0;
+         }
+
+         run->label = label;
+         if (label == NO_LABEL) continue;
+
+         DigitComponent *c = &scratch->components[findLabel(scratch->parents, label)];
+         if (run->start < c->minX) c->minX = run->start;
+         if (run->end > c->maxX) c->maxX = run->end;
+         c->maxY = y;
+         c->area += run->end - run->start + 1;
+      }
+
+      candidates = finishComponents(scratch, previous, previousCount,
+         y, width, height, candidates);
+
+      // live runs only point to roots, the rest of the labels is free
+      for (uint_t i = 0; i < count; i++)
+      {
+         if (runs[i].label != NO_LABEL)
+            runs[i].label = findLabel(scratch->parents, runs[i].label);
+      }
+
+      memcpy(scratch->freeLabels + scratch->freeCount, scratch->releasedLabels,
+         scratch->releasedCount * sizeof(uint16_t));
+      scratch->freeCount += scratch->releasedCount;
+      scratch->releasedCount = 0;
+
+      previous = runs;
+      previousCount = count;
+
+      // slide the window down by one row
+      if (y + radius + 1 < height)
+         for (uint_t x = 0; x < width; x++)
+            scratch->columnSums[x] += frame[(y + radius + 1) * width + x];
+      if (y >= radius)
+         for (uint_t x = 0; x < width; x++)
+            scratch->columnSums[x] -= frame[(y - radius) * width + x];
+   }
+
+   return finishComponents(scratch, previous, previousCount,
+      height, width, height, candidates);
+}
+
+/**
+ * completes the components of the previous row's runs that didn't
+ * reach row (y): digit-shaped ones are added to the candidates and
+ * their labels are released. returns the new candidate count.
+ */
+static uint_t finishComponents(DigitLocateScratch *scratch,
+   const DigitRun *runs, uint_t count, uint_t y,
+   uint_t width, uint_t height, uint_t candidates)
+{
+   for (uint_t i = 0; i < count; i++)
+   {
+      if (runs[i].label == NO_LABEL) continue;
+
+      uint16_t root = findLabel(scratch->parents, runs[i].label);
+      DigitComponent *c = &scratch->components[root];
+
+      // an area of 0 marks a component that is already done
+      if (c->maxY >= y || c->area == 0) continue;
+
+      if (candidates < DIGIT_LOCATE_MAX_CANDIDATES && isDigitShaped(c, width, height))
+         scratch->candidates[candidates++] = *c;
+
+      c->area = 0;
+      scratch->releasedLabels[scratch->releasedCount++] = root;
+   }
+
+   return candidates;
+}
+
+/**
+ * compares every pixel of the row with the mean of the window around
+ * it (a horizontal running sum over the column sums) and collects the
+ * foreground runs. returns the number of runs.
+ */
+static uint_t thresholdRow(const uint8_t *row, uint_t width, uint_t radius,
+   uint_t rows, bool_t dark, DigitLocateScratch *scratch, DigitRun *runs)
+{
+   const uint16_t *columns = scratch->columnSums;
+   uint32_t sum = 0;
+   for (uint_t x = 0; x <= radius && x < width; x++)
+      sum += columns[x];
+
+   uint_t count = 0;
+   bool_t inRun = FALSE;
+
+   for (uint_t x = 0; x < width; x++)
+   {
+      uint_t left = x > radius ? x - radius : 0;
+      uint_t right = x + radius < width ? x + radius : width - 1;
+      uint32_t pixels = (right - left + 1) * rows;
+
+      // pixel * n against (sum -/+ offset * n), no division needed
+      uint32_t value = row[x] * pixels;
+      uint32_t margin = LOCATE_OFFSET * pixels;
+      bool_t foreground = dark ? value + margin < sum : value > sum + margin;
+
+      if (foreground && !inRun && count < DIGIT_LOCATE_MAX_RUNS)
+      {
+         runs[count].start = x;
+         inRun = TRUE;
+      }
+      else if (!foreground && inRun)
+      {
+         runs[count++].end = x - 1;
+         inRun = FALSE;
+      }
+
+      if (x + radius + 1 < width) sum += columns[x + radius + 1];
+      if (x >= radius) sum -= columns[x - radius];
+   }
+
+   if (inRun) runs[count++].end = width - 1;
+   return count;
+}
+
+// ********************************************************************************************
+
+static uint16_t findLabel(uint16_t *parents, uint16_t label)
+{
+   // path halving keeps the trees flat without recursion
+   while (parents[label] != label)
+   {
+      parents[label] = parents[parents[label]];
+      label = parents[label];
+   }
+   return label;
+}
+
+// the older (smaller) root survives and takes the other one's stats
+static void mergeLabels(DigitLocateScratch *scratch, uint16_t a, uint16_t b)
+{
+   a = findLabel(scratch->parents, a);
+   b = findLabel(scratch->parents, b);
+   if (a == b) return;
+
+   if (b < a)
+   {
+      uint16_t tmp = a;
+      a = b;
+      b = tmp;
+   }
+
+   DigitComponent *root = &scratch->components[a];
+   const DigitComponent *other = &scratch->components[b];
+   if (other->minX < root->minX) root->minX = other->minX;
+   if (other->minY < root->minY) root->minY = other->minY;
+   if (other->maxX > root->maxX) root->maxX = other->maxX;
+   if (other->maxY > root->maxY) root->maxY = other->maxY;
+   root->area += other->area;
+
+   scratch->parents[b] = a;
+   scratch->releasedLabels[scratch->releasedCount++] = b;
+}
+
+// ********************************************************************************************
+
+/**
+ * digits are taller than wide (a "1" may be very narrow), fill a part
+ * of their box and don't touch the frame border
+ */
+static bool_t isDigitShaped(const DigitComponent *c, uint_t width, uint_t height)
+{
+   uint_t w = c->maxX - c->minX + 1;
+   uint_t h = c->maxY - c->minY + 1;
+   uint32_t box = w * h;
+
+   return h >= height / 20 && h <= height * 2 / 3 &&
+      h * 5 >= w * 6 && h <= w * 8 &&
+      c->area * 100 >= box * 12 && c->area * 100 <= box * 85 &&
+      c->minX > 0 && c->minY > 0 && c->maxX < width - 1 && c->maxY < height - 1;
+}
+
+/**
+ * every candidate is tried as the seed of a row: the candidates of a
+ * similar height on the same line are walked from left to right and
+ * the longest run of them with less than a digit height between
+ * neighbours is kept. returns its length, (chain) gets the indices.
+ */
+static uint_t findDigitRow(const DigitComponent *candidates, uint_t count,
+   uint_t *chain)
+{
+   uint_t order[DIGIT_LOCATE_MAX_CANDIDATES];
+   for (uint_t i = 0; i < count; i++)
+   {
+      uint_t j = i;
+      for (; j > 0 && candidates[order[j - 1]].minX > candidates[i].minX; j--)
+         order[j] = order[j - 1];
+      order[j] = i;
+   }
+
+   uint_t best = 0;
+   for (uint_t s = 0; s < count; s++)
+   {
+      const DigitComponent *seed = &candidates[s];
+      int_t seedHeight = seed->maxY - seed->minY + 1;
+      int_t seedCenter = seed->minY + seed->maxY;
+
+      uint_t current[DIGIT_LOCATE_MAX_DIGITS];
+      uint_t length = 0;
+
+      for (uint_t k = 0; k < count; k++)
+      {
+         const DigitComponent *c = &candidates[order[k]];
+         int_t h = c->maxY - c->minY + 1;
+         int_t center = c->minY + c->maxY;
+
+         if (4 * abs(h - seedHeight) > seedHeight ||
+            2 * abs(center - seedCenter) > seedHeight)
+            continue;
+
+         if (length > 0)
+         {
+            const DigitComponent *last = &candidates[current[length - 1]];
+
+            // pieces of the previous digit
+            if (c->minX <= last->maxX) continue;
+
+            // too far away, a new row starts here
+            if ((int_t) (c->minX - last->maxX) > seedHeight)
+            {
+               if (length > best)
+               {
+                  best = length;
+                  memcpy(chain, current, length * sizeof(uint_t));
+               }
+               length = 0;
+            }
+         }
+
+         if (length < DIGIT_LOCATE_MAX_DIGITS)
+            current[length++] = order[k];
+      }
+
+      if (length > best)
+      {
+         best = length;
+         memcpy(chain, current, length * sizeof(uint_t));
+      }
+   }
+
+   return best;
+}
+
+// ********************************************************************************************
+
+/**
+ * the boxes share the top and bottom of the row and have the width of
+ * the widest digit (so a "1" gets a full box) plus a tenth of the row
+ * height on each side, but never more than the digit pitch
+ */
+static void makeBoxes(const DigitComponent *candidates, const uint_t *chain,
+   uint_t count, uint_t width, uint_t height, DigitLocation *location)
+{
+   uint_t top = height, bottom = 0, widest = 0, pitch = width;
+   for (uint_t i = 0; i < count; i++)
+   {
+      const DigitComponent *c = &candidates[chain[i]];
+      if (c->minY < top) top = c->minY;
+      if (c->maxY > bottom) bottom = c->maxY;
+      if (c->maxX - c->minX + 1u > widest) widest = c->maxX - c->minX + 1;
+
+      if (i > 0)
+      {
+         const DigitComponent *p = &candidates[chain[i - 1]];
+         uint_t distance = (c->minX + c->maxX - p->minX - p->maxX) / 2;
+         if (distance < pitch) pitch = distance;
+      }
+   }
+
+   uint_t pad = (bottom - top + 1) / 10;
+   top = top > pad ? top - pad : 0;
+   bottom = bottom + pad < height ? bottom + pad : height - 1;
+
+   uint_t boxWidth = widest + 2 * pad;
+   if (count > 1 && boxWidth > pitch) boxWidth = pitch;
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      const DigitComponent *c = &candidates[chain[i]];
+      int_t left = (c->minX + c->maxX + 1) / 2 - (int_t) boxWidth / 2;
+      if (left < 0) left = 0;
+      if (left + boxWidth > width) left = width - boxWidth;
+
+      DigitBox *box = &location->boxes[i];
+      box->x = left;
+      box->y = top;
+      box->width = boxWidth;
+      box->height = bottom - top + 1;
+   }
+
+   location->digitCount = count;
+}
@@ -0,0 +1,107 @@
+#ifndef __digitLocate_H__
+#define __digitLocate_H__
+
+#include "os_port.h"
+
+/**
+ * finds the digit row of a meter in a grayscale frame, used to
+ * propose an ImgConfig without drawing the rectangles by hand:
+ *
+ * 1. adaptive threshold against the local mean (box filter kept as
+ *    running column sums, so only a few rows of state are needed)
+ * 2. connected components in a single pass over the runs of each row
+ *    (union-find on run labels, 8-connected)
+ * 3. components with a digit-like size, aspect and fill are grouped
+ *    into rows of similar height, the longest evenly spaced row wins
+ *
+ * both polarities are tried, the result tells which one matched.
+ */
+#define DIGIT_LOCATE_MAX_DIGITS 8
+
+// most foreground runs of a row (every other pixel of a 320 pixel row)
+#define DIGIT_LOCATE_MAX_RUNS 160
+
+/**
+ * labels in use at a time. a label is recycled as soon as its
+ * component ends, so this only has to cover the components that
+ * touch the current and the previous row (and the merged ones)
+ */
+#define DIGIT_LOCATE_MAX_LABELS 512
+
+// components that passed the shape filter and take part in the grouping
+#define DIGIT_LOCATE_MAX_CANDIDATES 64
+
+#define DIGIT_LOCATE_MAX_WIDTH 640
+
+typedef struct _DigitBox DigitBox;
+typedef struct _DigitRun DigitRun;
+typedef struct _DigitComponent DigitComponent;
+typedef struct _DigitLocateScratch DigitLocateScratch;
+typedef struct _DigitLocation DigitLocation;
+
+struct _DigitBox
+{
+   uint16_t x;
+   uint16_t y;
+   uint16_t width;
+   uint16_t height;
+};
+
+// a horizontal run of foreground pixels [start, end]
+struct _DigitRun
+{
+   uint16_t start;
+   uint16_t end;
+   uint16_t label;
+};
+
+struct _DigitComponent
+{
+   uint16_t minX;
+   uint16_t minY;
+   uint16_t maxX;
+   uint16_t maxY;
+   uint32_t area;
+};
+
+/**
+ * working memory of the locator (about 12KB), too large for a task
+ * stack so callers allocate it
+ */
+struct _DigitLocateScratch
+{
+   uint16_t columnSums[DIGIT_LOCATE_MAX_WIDTH];
+   DigitRun runs[2][DIGIT_LOCATE_MAX_RUNS];
+   uint16_t parents[DIGIT_LOCATE_MAX_LABELS];
+   uint16_t freeLabels[DIGIT_LOCATE_MAX_LABELS];
+   uint16_t releasedLabels[DIGIT_LOCATE_MAX_LABELS];
+   uint_t freeCount;
+   uint_t releasedCount;
+   DigitComponent components[DIGIT_LOCATE_MAX_LABELS];
+   DigitComponent candidates[DIGIT_LOCATE_MAX_CANDIDATES];
+};
+
+struct _DigitLocation
+{
+   uint8_t digitCount;
+   bool_t invert; // digits are darker than the background
+   DigitBox boxes[DIGIT_LOCATE_MAX_DIGITS]; // left to right
+};
+
+// ********************************************************************************************
+
+/**
+ * proposes the digit rectangles of a (width x height) frame.
+ * returns FALSE if no row of at least two digits was found.
+ */
+bool_t digitLocate(const uint8_t *frame, uint_t width, uint_t height,
+   DigitLocateScratch *scratch, DigitLocation *location);
+
+/**
+ * labels the foreground of one polarity and keeps the digit-like
+ * components in scratch->candidates, returns their number
+ */
+uint_t digitLocateCandidates(const uint8_t *frame, uint_t width,
+   uint_t height, bool_t dark, DigitLocateScratch *scratch);
+
+#endif
@@ -0,0 +1,294 @@
+#include <string.h>
+#include "digitPrep.h"
+
+// fractional bits of the resampler coordinates
+#define RESIZE_FRAC_BITS 8
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void digitHistogram(const DigitWindow *window, DigitScratch *scratch);
+void digitStretchLut(DigitScratch *scratch, bool_t invert);
+void digitRemapHistogram(DigitScratch *scratch);
+uint8_t digitOtsuThreshold(const DigitScratch *scratch);
+void digitBinarize(DigitWindow *window, uint8_t threshold);
+void digitApplyLut(DigitWindow *window, const uint8_t *lut);
+void digitResizeArea(const DigitWindow *window,
+   DigitScratch *scratch, uint8_t *crop);
+void digitPrepare(DigitWindow *window, bool_t invert,
+   DigitScratch *scratch, uint8_t *crop);
+void digitPackCrop(const uint8_t *crop, uint8_t *packed);
+static uint32_t resizeEdge(uint_t index, uint_t size);
+static uint32_t resizeOverlap(uint32_t start, uint32_t end, uint_t pixel);
+
+// ********************************************************************************************
+
+/**
+ * a single histogram would serialize on the counter that the previous
+ * pixel just incremented, so each byte lane of a word gets its own one
+ * and they are merged at the end
+ */
+void digitHistogram(const DigitWindow *window, DigitScratch *scratch)
+{
+   memset(scratch->lanes, 0, sizeof(scratch->lanes));
+
+   for (uint_t y = 0; y < window->height; y++)
+   {
+      const uint8_t *row = window->pixels + y * window->stride;
+      uint_t x = 0;
+
+      for (; x + 4 <= window->width; x += 4)
+      {
+         uint32_t quad;
+         memcpy(&quad, row + x, sizeof(quad));
+         scratch->lanes[0][quad & 0xFF]++;
+         scratch->lanes[1][(quad >> 8) & 0xFF]++;
+         scratch->lanes[2][(quad >> 16) & 0xFF]++;
+         scratch->lanes[3][quad >> 24]++;
+      }
+
+      for (; x < window->width; x++)
+         scratch->lanes[0][row[x]]++;
+   }
+
+   for (uint_t v = 0; v < 256; v++)
+   {
+      scratch->histogram[v] = scratch->lanes[0][v] + scratch->lanes[1][v] +
+         scratch->lanes[2][v] + scratch->lanes[3][v];
+   }
+}
+
+// ********************************************************************************************
+
+void digitStretchLut(DigitScratch *scratch, bool_t invert)
+{
+   int_t low = 0, high = 255;
+   while (low < 255 && scratch->histogram[low] == 0) low++;
+   while (high > 0 && scratch->histogram[high] == 0) high--;
+
+   if (invert)
+   {
+      int_t tmp = low;
+      low = 255 - high;
+      high = 255 - tmp;
+   }
+
+   int_t range = high - low;
+   for (int_t v = 0; v < 256; v++)
+   {
+      int_t x = invert ? 255 - v : v;
+
+      // a flat (or empty) window is left as it is
+      if (range <= 0)
+         scratch->lut[v] = x;
+      else if (x <= low)
+         scratch->lut[v] = 0;
+      else if (x >= high)
+         scratch->lut[v] = 255;
+      else
+         scratch->lut[v] = ((x - low) * 255 + range / 2) / range;
+   }
+}
+
+void digitRemapHistogram(DigitScratch *scratch)
+{
+   uint32_t *remapped = scratch->lanes[0];
+   memset(remapped, 0, 256 * sizeof(uint32_t));
+
+   for (uint_t v = 0; v < 256; v++)
+      remapped[scratch->lut[v]] += scratch->histogram[v];
+
+   memcpy(scratch->histogram, remapped, 256 * sizeof(uint32_t));
+}
+
+// ********************************************************************************************
+
+/**
+ * picks the split that maximizes the between-class variance.
+ * 128 is returned when there is no split (a single gray level).
+ */
+uint8_t digitOtsuThreshold(const DigitScratch *scratch)
+{
+   const uint32_t *histogram = scratch->histogram;
+
+   uint64_t total = 0, sumAll = 0;
+   for (uint_t v = 0; v < 256; v++)
+   {
+      total += histogram[v];
+      sumAll += (uint64_t) v * histogram[v];
+   }
+
+   uint64_t w0 = 0, sum0 = 0;
+   double best = 0;
+   uint8_t threshold = 128;
+
+   for (uint_t t = 0; t < 255; t++)
+   {
+      w0 += histogram[t];
+      sum0 += (uint64_t) t * histogram[t];
+      if (w0 == 0) continue;
+
+      uint64_t w1 = total - w0;
+      if (w1 == 0) break;
+
+      double diff = (double) sum0 / w0 - (double) (sumAll - sum0) / w1;
+      double between = (double) w0 * w1 * diff * diff;
+      if (between > best)
+      {
+         best = between;
+         threshold = t + 1;
+      }
+   }
+
+   return threshold;
+}
+
+// ********************************************************************************************
+
+// branch free so that the compiler can vectorize it
+void digitBinarize(DigitWindow *window, uint8_t threshold)
+{
+   for (uint_t y = 0; y < window->height; y++)
+   {
+      uint8_t *row = window->pixels + y * window->stride;
+      for (uint_t x = 0; x < window->width; x++)
+         row[x] = (uint8_t) -(row[x] >= threshold);
+   }
+}
+
+void digitApplyLut(DigitWindow *window, const uint8_t *lut)
+{
+   for (uint_t y = 0; y < window->height; y++)
+   {
+      uint8_t *row = window->pixels + y * window->stride;
+      uint_t x = 0;
+
+      for (; x + 4 <= window->width; x += 4)
+      {
+         uint32_t quad;
+         memcpy(&quad, row + x, sizeof(quad));
+         quad = (uint32_t) lut[quad & 0xFF] |
+            (uint32_t) lut[(quad >> 8) & 0xFF] << 8 |
+            (uint32_t) lut[(quad >> 16) & 0xFF] << 16 |
+            (uint32_t) lut[quad >> 24] << 24;
+         memcpy(row + x, &quad, sizeof(quad));
+      }
+
+      for (; x < window->width; x++)
+         row[x] = lut[row[x]];
+   }
+}
+
+// ********************************************************************************************
+
+/**
+ * output pixel d covers [edge(d), edge(d+1)) of the padded square in
+ * 1/256 pixel units. every window row is first reduced to the output
+ * columns (weighted by the horizontal overlap) and then added to the
+ * output rows it overlaps. padding is black, so only window pixels
+ * contribute. sums stay below 255 * 2926^2 (a 320 pixel square).
+ */
+void digitResizeArea(const DigitWindow *window,
+   DigitScratch *scratch, uint8_t *crop)
+{
+   uint_t size = window->width > window->height ?
+      window->width : window->height;
+
+   if (window->width == 0 || window->height == 0)
+   {
+      memset(crop, 0, DIGIT_CROP_PIXELS);
+      return;
+   }
+
+   uint_t left = (size - window->width) / 2;
+   uint_t top = (size - window->height) / 2;
+   memset(scratch->sums, 0, sizeof(scratch->sums));
+
+   for (uint_t y = 0; y < window->height; y++)
+   {
+      const uint8_t *row = window->pixels + y * window->stride;
+
+      for (uint_t dx = 0; dx < DIGIT_CROP_SIZE; dx++)
+      {
+         uint32_t start = resizeEdge(dx, size);
+         uint32_t end = resizeEdge(dx + 1, size);
+         uint_t first = start >> RESIZE_FRAC_BITS;
+         uint_t last = (end - 1) >> RESIZE_FRAC_BITS;
+         if (first < left) first = left;
+         if (last >= left + window->width) last = left + window->width - 1;
+
+         uint32_t sum = 0;
+         for (uint_t x = first; x <= last; x++)
+            sum += row[x - left] * resizeOverlap(start, end, x);
+         scratch->rowSums[dx] = sum;
+      }
+
+      uint_t py = top + y;
+      for (uint_t dy = 0; dy < DIGIT_CROP_SIZE; dy++)
+      {
+         uint32_t weight = resizeOverlap(
+            resizeEdge(dy, size), resizeEdge(dy + 1, size), py);
+         if (weight == 0) continue;
+
+         uint32_t *sums = scratch->sums + dy * DIGIT_CROP_SIZE;
+         for (uint_t dx = 0; dx < DIGIT_CROP_SIZE; dx++)
+            sums[dx] += scratch->rowSums[dx] * weight;
+      }
+   }
+
+   for (uint_t dy = 0; dy < DIGIT_CROP_SIZE; dy++)
+   {
+      uint32_t spanY = resizeEdge(dy + 1, size) - resizeEdge(dy, size);
+      for (uint_t dx = 0; dx < DIGIT_CROP_SIZE; dx++)
+      {
+         uint32_t area = spanY * (resizeEdge(dx + 1, size) - resizeEdge(dx, size));
+         uint32_t sum = scratch->sums[dy * DIGIT_CROP_SIZE + dx];
+         crop[dy * DIGIT_CROP_SIZE + dx] = (sum + area / 2) / area;
+      }
+   }
+}
+
+static uint32_t resizeEdge(uint_t index, uint_t size)
+{
+   return ((uint32_t) index * size << RESIZE_FRAC_BITS) / DIGIT_CROP_SIZE;
+}
+
+// overlap of [start, end) with source pixel (pixel) in 1/256 units
+static uint32_t resizeOverlap(uint32_t start, uint32_t end, uint_t pixel)
+{
+   uint32_t low = (uint32_t) pixel << RESIZE_FRAC_BITS;
+   uint32_t high = low + (1 << RESIZE_FRAC_BITS);
+   if (start > low) low = start;
+   if (end < high) high = end;
+   return high > low ? high - low : 0;
+}
+
+// ********************************************************************************************
+
+void digitPrepare(DigitWindow *window, bool_t invert,
+   DigitScratch *scratch, uint8_t *crop)
+{
+   digitHistogram(window, scratch);
+   digitStretchLut(scratch, invert);
+   digitRemapHistogram(scratch);
+   uint8_t threshold = digitOtsuThreshold(scratch);
+
+   // stretch and threshold in a single pass over the window
+   for (uint_t v = 0; v < 256; v++)
+      scratch->lut[v] = scratch->lut[v] >= threshold ? 255 : 0;
+
+   digitApplyLut(window, scratch->lut);
+   digitResizeArea(window, scratch, crop);
+}
+
+// ********************************************************************************************
+
+void digitPackCrop(const uint8_t *crop, uint8_t *packed)
+{
+   memset(packed, 0, DIGIT_CROP_PACKED_SIZE);
+   for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+   {
+      if (crop[i] >= 128)
+         packed[i >> 3] |= 0x80 >> (i & 7);
+   }
+}
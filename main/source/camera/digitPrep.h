@@ -0,0 +1,88 @@
+#ifndef __digitPrep_H__
+#define __digitPrep_H__
+
+#include "os_port.h"
+
+/**
+ * digit preprocessing, the C counterpart of getSubImg() in
+ * k210/microPython.py (reference: tools/digitBench/digitPrepRef.py):
+ *
+ * 1. (invert) and contrast stretch to the full 0..255 range
+ * 2. otsu threshold on the stretched histogram and binarize
+ * 3. pad to a centered black square and area-resample to 28x28
+ *
+ * steps 1 and 2 are folded into a single lookup table that is applied
+ * in place on the window, the window may live inside a larger frame.
+ */
+#define DIGIT_CROP_SIZE 28
+#define DIGIT_CROP_PIXELS (DIGIT_CROP_SIZE * DIGIT_CROP_SIZE)
+
+// crops are shipped as one bit per pixel (rows MSB first, no row padding)
+#define DIGIT_CROP_PACKED_SIZE ((DIGIT_CROP_PIXELS + 7) / 8)
+
+typedef struct _DigitWindow DigitWindow;
+typedef struct _DigitScratch DigitScratch;
+
+// grayscale region of a frame (stride is the frame width)
+struct _DigitWindow
+{
+   uint8_t *pixels;
+   uint_t width;
+   uint_t height;
+   uint_t stride;
+};
+
+/**
+ * working memory of the kernels, too large for the http task
+ * stack so callers allocate it once and reuse it for every digit
+ */
+struct _DigitScratch
+{
+   uint32_t histogram[256];
+   uint32_t lanes[4][256];
+   uint8_t lut[256];
+   uint32_t sums[DIGIT_CROP_SIZE * DIGIT_CROP_SIZE];
+   uint32_t rowSums[DIGIT_CROP_SIZE];
+};
+
+// ********************************************************************************************
+
+// histogram of the window, four pixels per load (one sub-histogram per lane)
+void digitHistogram(const DigitWindow *window, DigitScratch *scratch);
+
+/**
+ * fills scratch->lut with the (inverting) stretch that maps the darkest
+ * pixel of the histogram to 0 and the brightest one to 255
+ */
+void digitStretchLut(DigitScratch *scratch, bool_t invert);
+
+// moves the histogram counts through scratch->lut
+void digitRemapHistogram(DigitScratch *scratch);
+
+/**
+ * otsu's threshold of scratch->histogram: pixels at or above
+ * the returned value belong to the digit
+ */
+uint8_t digitOtsuThreshold(const DigitScratch *scratch);
+
+// binarizes the window in place (>= threshold: 255, otherwise 0)
+void digitBinarize(DigitWindow *window, uint8_t threshold);
+
+void digitApplyLut(DigitWindow *window, const uint8_t *lut);
+
+/**
+ * area-resamples the window, centered on a black square of
+ * max(width, height) pixels, to DIGIT_CROP_SIZE squared pixels
+ * (8 fractional bits, exact integer arithmetic)
+ */
+void digitResizeArea(const DigitWindow *window,
+   DigitScratch *scratch, uint8_t *crop);
+
+// the whole pipeline, the window is binarized in place
+void digitPrepare(DigitWindow *window, bool_t invert,
+   DigitScratch *scratch, uint8_t *crop);
+
+// one bit per pixel (crop >= 128), see DIGIT_CROP_PACKED_SIZE
+void digitPackCrop(const uint8_t *crop, uint8_t *packed);
+
+#endif
@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <string.h>
+#include "digitWindows.h"
+#include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/appEnv.h"
+#include "cpu_endian.h"
+#include "esp_log.h"
+
+#define LOG_TAG "digitWindows"
+
+// ********************************************************************************************
+// forward declaration of functions
+
+bool_t digitWindowsCapture(uint8_t flags, CameraImage *image);
+uint8_t* digitWindowsRead(size_t *length);
+int_t digitWindowsPrepare(uint8_t *windows, size_t length,
+   DigitScratch *scratch, uint8_t *crops);
+uint8_t* digitWindowsReadCrops(uint_t *count);
+
+// ********************************************************************************************
+
+bool_t digitWindowsCapture(uint8_t flags, CameraImage *image)
+{
+   // payload: packed size (4)
+   uint8_t info[4];
+
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_CAM_ROI,
+      &flags, sizeof(flags), info, sizeof(info));
+   request.waitTimeMS = 1000;
+
+   if (!uartBrokerExecute(&request))
+   {
+      ESP_LOGE(LOG_TAG, "handshaking failed!");
+      appEnv.errorLog.k210_not_responding = true;
+      return FALSE;
+   }
+   size_t length = request.responseLength;
+
+   image->width = 0;
+   image->height = 0;
+   image->size = LOAD32LE(info);
+   image->codec = K210_CODEC_RAW;
+
+   // worst case: every window covers the whole frame
+   size_t maxSize = 6 + MAX_DIGIT_COUNT * (8 + CAMERA_FRAME_SIZE +
+      K210_ROI_CROP_SIZE * K210_ROI_CROP_SIZE);
+
+   if (length != sizeof(info) || image->size < 6 || image->size > maxSize)
+   {
+      ESP_LOGE(LOG_TAG, "k210 reported an unexpected roi frame");
+      return FALSE;
+   }
+
+   appEnv.errorLog.k210_not_responding = false;
+   ESP_LOGI(LOG_TAG, "packed digit windows: %d bytes", image->size);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+uint8_t* digitWindowsRead(size_t *length)
+{
+   if (!frameCacheBeginCapture(CAMERA_CACHE_ATTACH_MS))
+      return NULL;
+
+   CameraImage image;
+   uint8_t *windows = NULL;
+   bool_t res = digitWindowsCapture(0, &image) &&
+      image.size <= DIGIT_WINDOWS_MAX_BYTES &&
+      (windows = (uint8_t*) malloc(image.size)) != NULL &&
+      frameCacheFetch(&image, windows);
+
+   frameCacheEndCapture();
+
+   if (!res)
+   {
+      free(windows);
+      return NULL;
+   }
+
+   *length = image.size;
+   return windows;
+}
+
+// ********************************************************************************************
+
+int_t digitWindowsPrepare(uint8_t *windows, size_t length,
+   DigitScratch *scratch, uint8_t *crops)
+{
+   if (length < 6 || windows[0] > MAX_DIGIT_COUNT)
+      return -1;
+
+   uint_t count = windows[0];
+   size_t offset = 6 + count * 8;
+   if (offset > length)
+      return -1;
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      const uint8_t *rect = windows + 6 + i * 8;
+      DigitWindow window;
+      window.width = LOAD16LE(rect + 4);
+      window.height = LOAD16LE(rect + 6);
+      window.stride = window.width;
+      window.pixels = windows + offset;
+
+      offset += window.width * window.height;
+      if (offset > length)
+         return -1;
+
+      digitPrepare(&window, appEnv.imgConfig.invert,
+         scratch, crops + i * DIGIT_CROP_PIXELS);
+   }
+
+   return count;
+}
+
+// ********************************************************************************************
+
+uint8_t* digitWindowsReadCrops(uint_t *count)
+{
+   size_t length = 0;
+   uint8_t *windows = digitWindowsRead(&length);
+   if (windows == NULL)
+      return NULL;
+
+   // too large for the task stacks
+   DigitScratch *scratch = (DigitScratch*) malloc(sizeof(DigitScratch));
+   uint8_t *crops = (uint8_t*) malloc(MAX_DIGIT_COUNT * DIGIT_CROP_PIXELS);
+
+   int_t prepared = -1;
+   if (scratch != NULL && crops != NULL)
+      prepared = digitWindowsPrepare(windows, length, scratch, crops);
+   free(scratch);
+   free(windows);
+
+   if (prepared < 0)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't prepare the digit crops!");
+      free(crops);
+      return NULL;
+   }
+
+   *count = prepared;
+   return crops;
+}
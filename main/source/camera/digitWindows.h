@@ -0,0 +1,46 @@
+#ifndef __digitWindows_H__
+#define __digitWindows_H__
+
+#include "os_port.h"
+#include "frameCache.h"
+#include "digitPrep.h"
+
+/**
+ * digit windows packed by k210 (K210_CMD_CAM_ROI):
+ * 
+ * | digitCount (1) | flags (1) | frame width (2) | frame height (2) |
+ * | x (2) | y (2) | w (2) | h (2) per digit | w*h bytes per window |
+ * 
+ * shared by the /roi and /digits handlers and by the esp32
+ * fallback classifier of aiTask.c
+ */
+
+// largest set of windows that is fetched into memory
+#define DIGIT_WINDOWS_MAX_BYTES 65536
+
+// asks k210 to take a new snapshot and pack the digit windows
+bool_t digitWindowsCapture(uint8_t flags, CameraImage *image);
+
+/**
+ * captures the windows (without crops) and fetches them into a new
+ * buffer that the caller frees. the frame cache capture lock is held
+ * while the k210 buffer is in use. returns NULL on failure.
+ */
+uint8_t* digitWindowsRead(size_t *length);
+
+/**
+ * runs digitPrepare on every window (they are binarized in place) and
+ * writes DIGIT_CROP_PIXELS per digit to (crops), which must hold
+ * MAX_DIGIT_COUNT crops. returns the digit count or -1 if malformed.
+ */
+int_t digitWindowsPrepare(uint8_t *windows, size_t length,
+   DigitScratch *scratch, uint8_t *crops);
+
+/**
+ * reads the windows and prepares them (see above) into a new buffer
+ * of MAX_DIGIT_COUNT crops that the caller frees, (count) is set to
+ * the digits in it. returns NULL on failure.
+ */
+uint8_t* digitWindowsReadCrops(uint_t *count);
+
+#endif
@@ -0,0 +1,362 @@
+#include <stdlib.h>
+#include <string.h>
+#include "frameCache.h"
+#include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/appEnv.h"
+#include "cpu_endian.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#define LOG_TAG "frameCache"
+
+// time to wait for a chunk to arrive from k210
+#define CHUNK_WAIT_MS 500
+#define CHUNK_RETRIES 3
+
+// time k210 needs to take a snapshot (jpeg is encoded in hardware)
+#define CAPTURE_WAIT_MS 1000
+
+/**
+ * rle and gray4 are encoded in pure micropython, one pixel at a time.
+ * a full rle frame takes 53 ms in cpython on a pc (see codecBench.py),
+ * micropython on the k210 may well be 100 times slower, so the wait
+ * grows with the encoded pixels (6.4 s for a full frame)
+ */
+#define CAPTURE_ENCODE_US_PER_PIXEL 70
+
+// protects cachedFrame and the reference counts
+static SemaphoreHandle_t cacheLock;
+
+// held during a capture (k210 capture + transfer)
+static SemaphoreHandle_t captureLock;
+
+static CameraFrame *cachedFrame = NULL;
+
+// drops the cached frame once it is CAMERA_CACHE_KEEP_MS old
+static esp_timer_handle_t expiryTimer;
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void frameCacheInit();
+CameraFrame* frameCacheGet(uint8_t codec, uint8_t quality, uint_t maxAgeMS);
+bool_t frameCacheBeginCapture(uint_t waitTimeMS);
+void frameCacheEndCapture();
+CameraFrame* frameCacheAlloc(const CameraImage *image, uint8_t quality);
+void frameCachePublish(CameraFrame *frame);
+void frameCacheRelease(CameraFrame *frame);
+bool_t frameCacheCapture(uint8_t codec, uint8_t quality,
+   uint8_t scale, CameraImage *image);
+bool_t frameCacheFetch(const CameraImage *image, uint8_t *data);
+void frameCacheSubmitChunk(CameraChunk *chunk, size_t offset, size_t size);
+bool_t frameCacheWaitChunk(CameraChunk *chunk);
+bool_t frameCacheFetchChunk(CameraChunk *chunk, size_t offset, size_t size);
+CameraFrame* frameCacheGetRaw(uint_t maxAgeMS);
+static void expireHelper(int64_t maxAge);
+static void expiryTimerCallback(void *arg);
+
+// ********************************************************************************************
+
+void frameCacheInit()
+{
+   cacheLock = xSemaphoreCreateMutex();
+   captureLock = xSemaphoreCreateMutex();
+
+   esp_timer_create_args_t timerArgs = {
+      .callback = expiryTimerCallback,
+      .name = "frameCache"
+   };
+   esp_timer_create(&timerArgs, &expiryTimer);
+}
+
+// ********************************************************************************************
+
+CameraFrame* frameCacheGet(uint8_t codec, uint8_t quality, uint_t maxAgeMS)
+{
+   CameraFrame *frame = NULL;
+   int64_t maxAge = (int64_t) maxAgeMS * 1000;
+
+   // a stale frame is only replaced by the next capture, don't keep it until then
+   expireHelper(maxAge);
+
+   xSemaphoreTake(cacheLock, portMAX_DELAY);
+   if (cachedFrame != NULL && cachedFrame->image.codec == codec &&
+      (codec != K210_CODEC_JPEG || cachedFrame->quality == quality))
+   {
+      frame = cachedFrame;
+      frame->refCount++;
+   }
+   xSemaphoreGive(cacheLock);
+
+   return frame;
+}
+
+// ********************************************************************************************
+
+bool_t frameCacheBeginCapture(uint_t waitTimeMS)
+{
+   TickType_t waitTicks = waitTimeMS / portTICK_PERIOD_MS;
+   return xSemaphoreTake(captureLock, waitTicks) == pdTRUE;
+}
+
+void frameCacheEndCapture() { xSemaphoreGive(captureLock); }
+
+// ********************************************************************************************
+
+CameraFrame* frameCacheAlloc(const CameraImage *image, uint8_t quality)
+{
+   CameraFrame *frame = (CameraFrame*) malloc(sizeof(CameraFrame) + image->size);
+   if (frame == NULL)
+   {
+      ESP_LOGE(LOG_TAG, "not enough memory, frame won't be cached");
+      return NULL;
+   }
+
+   frame->image = *image;
+   frame->quality = quality;
+   frame->refCount = 1;
+   return frame;
+}
+
+// ********************************************************************************************
+
+/**
+ * the cache keeps its own reference to the published frame,
+ * the old frame is freed once its last viewer releases it
+ */
+void frameCachePublish(CameraFrame *frame)
+{
+   frame->capturedAt = esp_timer_get_time();
+
+   xSemaphoreTake(cacheLock, portMAX_DELAY);
+   CameraFrame *old = cachedFrame;
+   cachedFrame = frame;
+   frame->refCount++;
+
+   // restarted under the lock, so concurrent publishers can't lose it
+   esp_timer_stop(expiryTimer);
+   esp_timer_start_once(expiryTimer, CAMERA_CACHE_KEEP_MS * 1000LL);
+   xSemaphoreGive(cacheLock);
+
+   if (old != NULL)
+      frameCacheRelease(old);
+}
+
+// ********************************************************************************************
+
+/**
+ * drops the cache reference to the frame if it is older than
+ * (maxAge) microseconds, viewers still holding it keep it alive
+ */
+static void expireHelper(int64_t maxAge)
+{
+   int64_t now = esp_timer_get_time();
+   CameraFrame *old = NULL;
+
+   xSemaphoreTake(cacheLock, portMAX_DELAY);
+   if (cachedFrame != NULL && now - cachedFrame->capturedAt > maxAge)
+   {
+      old = cachedFrame;
+      cachedFrame = NULL;
+   }
+   xSemaphoreGive(cacheLock);
+
+   if (old != NULL)
+      frameCacheRelease(old);
+}
+
+// runs in the esp_timer task
+static void expiryTimerCallback(void *arg)
+{
+   expireHelper(CAMERA_CACHE_KEEP_MS * 1000LL - 1000);
+}
+
+// ********************************************************************************************
+
+void frameCacheRelease(CameraFrame *frame)
+{
+   xSemaphoreTake(cacheLock, portMAX_DELAY);
+   bool_t last = --frame->refCount == 0;
+   xSemaphoreGive(cacheLock);
+
+   if (last) free(frame);
+}
+
+// ********************************************************************************************
+
+bool_t frameCacheCapture(uint8_t codec, uint8_t quality,
+   uint8_t scale, CameraImage *image)
+{
+   // args: codec (1), jpeg quality (1), scale (1, only sent if not 1)
+   uint8_t args[3] = {codec, quality, scale};
+
+   // payload: width (2), height (2), encoded size (4), codec (1)
+   uint8_t info[9];
+
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_CAM_CAPTURE,
+      args, scale > 1 ? 3 : 2, info, sizeof(info));
+   request.waitTimeMS = CAPTURE_WAIT_MS;
+   if (codec == K210_CODEC_RLE || codec == K210_CODEC_GRAY4)
+   {
+      uint32_t pixels = CAMERA_FRAME_SIZE / (scale * scale);
+      request.waitTimeMS += pixels * CAPTURE_ENCODE_US_PER_PIXEL / 1000;
+   }
+
+   if (!uartBrokerExecute(&request))
+   {
+      ESP_LOGI(LOG_TAG, "K210 seems to be off! exiting the task ...");
+      appEnv.errorLog.k210_not_responding = true;
+      return FALSE;
+   }
+   size_t length = request.responseLength;
+
+   image->width = LOAD16LE(info);
+   image->height = LOAD16LE(info + 2);
+   image->size = LOAD32LE(info + 4);
+   image->codec = info[8];
+
+   size_t pixels = (size_t) image->width * image->height;
+   bool_t valid = length == sizeof(info) && image->codec == codec &&
+      image->width == CAMERA_FRAME_WIDTH / scale &&
+      image->height == CAMERA_FRAME_HEIGHT / scale;
+
+   // compressed images can't be bigger than the worst case of the codecs
+   if (codec == K210_CODEC_RAW)
+      valid = valid && image->size == pixels;
+   else if (codec == K210_CODEC_GRAY4)
+      valid = valid && image->size == K210_GRAY4_HEADER_SIZE +
+         (image->width + 1) / 2 * image->height;
+   else
+      valid = valid && 0 < image->size && image->size <= 2*pixels;
+
+   if (!valid)
+   {
+      ESP_LOGE(LOG_TAG, "k210 reported an unexpected image format");
+      return FALSE;
+   }
+
+   ESP_LOGI(LOG_TAG, "captured %dx%d image, codec %d, %d bytes",
+      image->width, image->height, image->codec, image->size);
+
+   appEnv.errorLog.k210_not_responding = false;
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+bool_t frameCacheFetch(const CameraImage *image, uint8_t *data)
+{
+   CameraChunk chunk;
+   memset(&chunk, 0, sizeof(chunk));
+   chunk.buffer = (uint8_t*) malloc(CAMERA_CHUNK_BUFFER_SIZE);
+   if (chunk.buffer == NULL)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't allocate chunk buffer!");
+      return FALSE;
+   }
+
+   size_t offset = 0;
+   while (offset < image->size)
+   {
+      size_t size = image->size - offset;
+      if (size > K210_CAM_CHUNK_SIZE) size = K210_CAM_CHUNK_SIZE;
+
+      if (!frameCacheFetchChunk(&chunk, offset, size))
+      {
+         ESP_LOGE(LOG_TAG, "couldn't fetch the image at %d", offset);
+         appEnv.errorLog.k210_not_responding = true;
+         break;
+      }
+
+      memcpy(data + offset, chunk.buffer + 4, size);
+      offset += size;
+   }
+
+   free(chunk.buffer);
+   return offset == image->size;
+}
+
+// ********************************************************************************************
+
+void frameCacheSubmitChunk(CameraChunk *chunk, size_t offset, size_t size)
+{
+   // args: offset (4), size (2)
+   STORE32LE(offset, chunk->args);
+   STORE16LE(size, chunk->args + 4);
+   chunk->offset = offset;
+   chunk->size = size;
+
+   uartRequestInit(&chunk->request, K210_CMD_CAM_CHUNK,
+      chunk->args, sizeof(chunk->args), chunk->buffer, CAMERA_CHUNK_BUFFER_SIZE);
+   chunk->request.waitTimeMS = CHUNK_WAIT_MS;
+   chunk->request.retries = 0;
+
+   uartBrokerSubmit(&chunk->request);
+}
+
+bool_t frameCacheWaitChunk(CameraChunk *chunk)
+{
+   if (!uartBrokerWait(&chunk->request))
+      return FALSE;
+
+   // payload: offset (4), image data
+   if (chunk->request.responseLength == chunk->size + 4 &&
+      LOAD32LE(chunk->buffer) == chunk->offset)
+      return TRUE;
+
+   ESP_LOGE(LOG_TAG, "k210 sent the wrong chunk");
+   return FALSE;
+}
+
+bool_t frameCacheFetchChunk(CameraChunk *chunk, size_t offset, size_t size)
+{
+   for (uint_t attempt = 0; attempt <= CHUNK_RETRIES; attempt++)
+   {
+      frameCacheSubmitChunk(chunk, offset, size);
+      if (frameCacheWaitChunk(chunk))
+         return TRUE;
+   }
+
+   return FALSE;
+}
+
+// ********************************************************************************************
+
+CameraFrame* frameCacheGetRaw(uint_t maxAgeMS)
+{
+   CameraFrame *frame = frameCacheGet(K210_CODEC_RAW, 0, maxAgeMS);
+   if (frame != NULL)
+      return frame;
+
+   if (!frameCacheBeginCapture(CAMERA_CACHE_ATTACH_MS))
+      return NULL;
+
+   // the capture we waited for may have filled the cache
+   frame = frameCacheGet(K210_CODEC_RAW, 0, maxAgeMS);
+   if (frame == NULL)
+   {
+      CameraImage image;
+      if (frameCacheCapture(K210_CODEC_RAW, 0, 1, &image))
+         frame = frameCacheAlloc(&image, 0);
+
+      if (frame != NULL)
+      {
+         if (frameCacheFetch(&image, frame->data))
+            frameCachePublish(frame);
+         else
+         {
+            frameCacheRelease(frame);
+            frame = NULL;
+         }
+      }
+   }
+
+   frameCacheEndCapture();
+   return frame;
+}
+
+// ********************************************************************************************
@@ -0,0 +1,125 @@
+#ifndef __frameCache_H__
+#define __frameCache_H__
+
+#include "os_port.h"
+#include "source/serial/uartBroker.h"
+
+// frames younger than this are served from memory
+#define CAMERA_CACHE_MAX_AGE_MS 2000
+
+/**
+ * the cached frame is freed once it is this old (76.8KB is a lot of
+ * heap without psram), so a larger "maxAge" finds nothing to reuse
+ */
+#define CAMERA_CACHE_KEEP_MS 10000
+
+// how long a viewer waits for a capture that is in flight
+#define CAMERA_CACHE_ATTACH_MS 10000
+
+// bytes in an uncompressed (320x240 grayscale) frame
+#define CAMERA_FRAME_WIDTH 320
+#define CAMERA_FRAME_HEIGHT 240
+#define CAMERA_FRAME_SIZE (CAMERA_FRAME_WIDTH * CAMERA_FRAME_HEIGHT)
+
+// k210 can downscale the frame by 2 or 4 before encoding it
+#define CAMERA_MAX_SCALE 4
+
+typedef struct _CameraImage CameraImage;
+typedef struct _CameraFrame CameraFrame;
+typedef struct _CameraChunk CameraChunk;
+
+// image captured by k210 (as reported in the capture response)
+struct _CameraImage
+{
+   uint16_t width;
+   uint16_t height;
+   uint32_t size;  // encoded size in bytes
+   uint8_t codec;  // one of K210_CODEC_*
+};
+
+/**
+ * a captured frame kept in memory. frames are reference counted
+ * and must be released with frameCacheRelease when done.
+ */
+struct _CameraFrame
+{
+   CameraImage image;
+   uint8_t quality;
+   int64_t capturedAt; // esp_timer time in microseconds
+   uint_t refCount;
+   uint8_t data[];
+};
+
+// bytes of a chunk response: offset (4) + image data
+#define CAMERA_CHUNK_BUFFER_SIZE (4 + K210_CAM_CHUNK_SIZE)
+
+// a chunk of a staged image being fetched through the uart broker
+struct _CameraChunk
+{
+   UartRequest request;
+   uint8_t args[6];
+   size_t offset;
+   size_t size;
+   uint8_t *buffer; // CAMERA_CHUNK_BUFFER_SIZE bytes, set by the caller
+};
+
+// ********************************************************************************************
+
+// this function should be called only once at startup
+void frameCacheInit();
+
+/**
+ * returns the cached frame if it has the requested encoding and
+ * is not older than (maxAgeMS), NULL otherwise. a frame older than
+ * (maxAgeMS) is dropped from the cache, a new capture follows anyway.
+ * only full size frames are cached (downscaled previews are not).
+ */
+CameraFrame* frameCacheGet(uint8_t codec, uint8_t quality, uint_t maxAgeMS);
+
+/**
+ * only one capture is in flight at a time. viewers that find the
+ * cache stale take the capture lock (waiting for the running
+ * capture if there is one) and check the cache again before
+ * talking to k210.
+ */
+bool_t frameCacheBeginCapture(uint_t waitTimeMS);
+void frameCacheEndCapture();
+
+// allocates a frame to be filled by the capturer (may return NULL)
+CameraFrame* frameCacheAlloc(const CameraImage *image, uint8_t quality);
+
+// replaces the cached frame with a completely filled one
+void frameCachePublish(CameraFrame *frame);
+
+void frameCacheRelease(CameraFrame *frame);
+
+/**
+ * asks k210 to take a new snapshot (downscaled by (scale), encoded
+ * with the given codec) and checks the reported image format against
+ * what we expect. the image stays staged on k210 until the next capture.
+ */
+bool_t frameCacheCapture(uint8_t codec, uint8_t quality,
+   uint8_t scale, CameraImage *image);
+
+// fetches a whole staged image into (data), one chunk at a time
+bool_t frameCacheFetch(const CameraImage *image, uint8_t *data);
+
+/**
+ * the chunk requests behind frameCacheFetch, for callers that
+ * stream the image as it arrives (see camera.c).
+ * submit queues the request for a chunk without waiting for it,
+ * wait checks that it carries the expected part of the image and
+ * fetch requests a single chunk and waits for it (with retries).
+ */
+void frameCacheSubmitChunk(CameraChunk *chunk, size_t offset, size_t size);
+bool_t frameCacheWaitChunk(CameraChunk *chunk);
+bool_t frameCacheFetchChunk(CameraChunk *chunk, size_t offset, size_t size);
+
+/**
+ * returns a raw frame not older than (maxAgeMS), taking a new one if
+ * needed. this is for users on the esp32 itself (not streamed to a
+ * client). release the frame with frameCacheRelease.
+ */
+CameraFrame* frameCacheGetRaw(uint_t maxAgeMS);
+
+#endif
@@ -5,7 +5,12 @@
 #include "source/mqtt/mqttHelper.h"
 #include "os_port.h"
 
-#define MAX_DIGIT_COUNT 8
+// digits of all the meters framed by the camera
+#define MAX_DIGIT_COUNT 24
+
+// meters read from one camera frame
+#define MAX_METER_COUNT 4
+#define METER_NAME_LENGTH 15
 
 // ! supports maximum 10 users !
 #define USER_COUNT 2
@@ -15,6 +20,7 @@
 
 typedef struct _ErrorLog ErrorLog;
 typedef struct _Position Position;
+typedef struct _MeterConfig MeterConfig;
 typedef struct _ImgConfig ImgConfig;
 typedef struct _User User;
 typedef struct _Environment Environment;
@@ -32,12 +38,27 @@ struct _Position
    uint16_t height;
 };
 
+// a meter owns (digitCount) consecutive entries of ImgConfig.positions
+struct _MeterConfig
+{
+   char_t name[METER_NAME_LENGTH+1];
+   uint8_t digitCount;
+};
+
+/**
+ * digitCount is the total over all the meters and the positions are
+ * grouped by meter, left to right within each. the meters come after
+ * the positions so a single-meter blob of older firmware still loads
+ * (meterCount is 0 then, see retrieveImgConfig)
+ */
 struct _ImgConfig
 {
    uint8_t isConfigured;
    uint8_t digitCount;
    uint8_t invert;
    Position positions[MAX_DIGIT_COUNT];
+   uint8_t meterCount;
+   MeterConfig meters[MAX_METER_COUNT];
 };
 
 struct _User
@@ -55,6 +76,8 @@ struct _Environment
    User users[USER_COUNT];
    ImgConfig imgConfig;
    char_t meterCounter[MAX_DIGIT_COUNT+1];
+   uint32_t aiSampleInterval;
+   uint32_t linkBaudRate;
    MqttConfig mqttConfig;
    ErrorLog errorLog;
 };
@@ -1,39 +1,540 @@
-// initialize AI Event Task
-// BaseType_t ret = xTaskCreatePinnedToCore(
-//    aiTask, "aiTask", 2048, NULL, 12, NULL, 1
-// );
-// if(ret != pdPASS) { // error check
-//    ESP_LOGE("aiTask","failed to create task!");
-// }
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "aiTask.h"
+#include "mqttHelper.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/camera/digitWindows.h"
+#include "source/ai/digitClassifier.h"
+#include "source/ai/readingFilter.h"
+#include "source/utils/cJSON.h"
+#include "cpu_endian.h"
+#include "source/appEnv.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#define LOG_TAG "aiTask"
+
+// how long a reading may wait for other uart users
+#define UART_DEADLINE_MS 1000
+
+/**
+ * the latest reading is published through a sequence lock:
+ * the writer makes the version odd while it updates the snapshot,
+ * readers copy the snapshot and retry if the version was odd or
+ * changed in the meantime. readers never block the sampler.
+ */
+static AiReading snapshot;
+static atomic_uint snapshotVersion;
+
+// serializes the writers (sampler task and fresh reads)
+static SemaphoreHandle_t writerLock;
+
+static TaskHandle_t samplerTask = NULL;
+static uint32_t readingSeq = 0;
+
+// k210 frame of the last reading (guarded by the writer lock)
+static uint32_t lastFrame = 0;
+
+// esp32 fallback state (guarded by the writer lock)
+static DigitClassifierArena fallbackArena;
+static int64_t lastFallback = 0;
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void aiTaskInit();
+void aiSamplerTask(void *pvParameters);
+void aiGetReading(AiReading *reading);
+bool_t aiReadNow(AiReading *reading);
+void aiInvalidateReading();
+void aiSetSampleInterval(uint32_t intervalMS);
+void aiGetMeterValue(const AiReading *reading, uint_t meter, char_t *value);
+static bool_t aiSample(AiReading *reading, UartPriority priority, bool_t fresh);
+static void aiStoreReading(const AiReading *reading);
+static char_t* aiMqttMessage(const AiReading *reading);
+static void splitMetersHelper(AiReading *reading);
+static void confidenceHelper(AiReading *reading);
+bool_t getAiHelper(AiReading *reading, UartPriority priority, bool_t fresh);
+static bool_t getAiResultHelper(AiReading *reading, UartPriority priority);
+static void rereadHelper(AiReading *reading, UartPriority priority);
+static bool_t getFallbackHelper(AiReading *reading, bool_t fresh);
+bool_t checkAiResponseHelper(const uint8_t *data, size_t length, AiReading *reading);
+
+// ********************************************************************************************
+
+void aiTaskInit()
+{
+   writerLock = xSemaphoreCreateMutex();
+
+   BaseType_t ret = xTaskCreatePinnedToCore(
+      aiSamplerTask, "aiTask", 3072, NULL, 5, &samplerTask, 1
+   );
+   if(ret != pdPASS)
+      ESP_LOGE(LOG_TAG, "failed to create task!");
+}
 
 // ********************************************************************************************
 
 // ai task always running to keep the AI reading updated
-// void aiTask(void *pvParameters)
-// {
-//    while(1) {
-//       vTaskDelay(5000 / portTICK_PERIOD_MS);
-//       if (!myEnv.k210config.isConfigured) {
-//          ESP_LOGI("aiTask", "waiting for configuration");
-//          continue;
-//       }
-
-//       if (!readingValid) {
-//          free(aiReading);
-//          aiReading = (char_t*) malloc(myEnv.k210config.digitCount);
-//       }
-
-//       readingValid = getAiHelper(aiReading);
-//       if (readingValid) {
-//          ESP_LOGI("aiTask", "got current AI-reading successfully!");
-//          bool_t result;
-//          result = nvsSaveString(NVS_aiReading_VAR, aiReading);
-//          if (!result) {
-//             ESP_LOGI("aiTask", "couldn't save AI-reading");
-//          }
-//       }
-//       else ESP_LOGI("aiTask", "couldn't get AI-reading");
-//    }
-// }
+void aiSamplerTask(void *pvParameters)
+{
+   AiReading reading;
+
+   while(1)
+   {
+      uint32_t interval = appEnv.aiSampleInterval;
+      TickType_t waitTicks = interval == 0 ? portMAX_DELAY :
+         pdMS_TO_TICKS(interval);
+
+      // a notification means the interval changed
+      if (ulTaskNotifyTake(pdTRUE, waitTicks) > 0)
+         continue;
+
+      if (!appEnv.imgConfig.isConfigured) {
+         ESP_LOGI(LOG_TAG, "waiting for configuration");
+         continue;
+      }
+
+      if (!aiSample(&reading, UART_PRIORITY_LOW, FALSE))
+         ESP_LOGI(LOG_TAG, "couldn't get AI-reading");
+   }
+}
+
+// ********************************************************************************************
+
+void aiGetReading(AiReading *reading)
+{
+   uint_t start, end;
+   do
+   {
+      start = atomic_load_explicit(&snapshotVersion, memory_order_acquire);
+      if (start & 1) continue;
+
+      memcpy(reading, &snapshot, sizeof(AiReading));
+      atomic_thread_fence(memory_order_acquire);
+      end = atomic_load_explicit(&snapshotVersion, memory_order_relaxed);
+   }
+   while ((start & 1) || start != end);
+}
+
+// ********************************************************************************************
+
+bool_t aiReadNow(AiReading *reading)
+{
+   if (!appEnv.imgConfig.isConfigured)
+      return FALSE;
+
+   return aiSample(reading, UART_PRIORITY_HIGH, TRUE);
+}
+
+// ********************************************************************************************
+
+void aiInvalidateReading()
+{
+   AiReading reading = {0};
+   xSemaphoreTake(writerLock, portMAX_DELAY);
+   readingFilterReset();
+   aiStoreReading(&reading);
+   xSemaphoreGive(writerLock);
+}
+
+// ********************************************************************************************
+
+void aiSetSampleInterval(uint32_t intervalMS)
+{
+   appEnv.aiSampleInterval = intervalMS;
+   if (samplerTask != NULL)
+      xTaskNotifyGive(samplerTask);
+}
+
+// ********************************************************************************************
+
+void aiGetMeterValue(const AiReading *reading, uint_t meter, char_t *value)
+{
+   value[0] = '\0';
+   if (meter >= reading->meterCount) return;
+
+   const AiMeterReading *meterReading = &reading->meters[meter];
+   memcpy(value, reading->value + meterReading->offset, meterReading->digitCount);
+   value[meterReading->digitCount] = '\0';
+}
+
+// ********************************************************************************************
+
+/**
+ * reads the meter from k210 and publishes the result.
+ * the digits go through the reading filter, newly committed values
+ * are also pushed to the mqtt message queue.
+ */
+static bool_t aiSample(AiReading *reading, UartPriority priority, bool_t fresh)
+{
+   xSemaphoreTake(writerLock, portMAX_DELAY);
+
+   if (getAiHelper(reading, priority, fresh))
+      rereadHelper(reading, priority);
+   else if (!getFallbackHelper(reading, fresh)) {
+      xSemaphoreGive(writerLock);
+      return FALSE;
+   }
+
+   bool_t changed = readingFilterApply(reading);
+
+   reading->seq = ++readingSeq;
+   aiStoreReading(reading);
+   xSemaphoreGive(writerLock);
+
+   if (changed && appEnv.mqttConfig.isConfigured && appEnv.mqttConfig.mqttEnable)
+   {
+      char_t *message = aiMqttMessage(reading);
+      if (message == NULL)
+         ESP_LOGE(LOG_TAG, "couldn't build the mqtt message!");
+      else if (!mqttMessageQueuePush(message))
+         ESP_LOGE(LOG_TAG, "mqtt message queue is full!");
+      if (message != reading->value) cJSON_free(message);
+   }
+
+   return TRUE;
+}
+
+/**
+ * a single meter is published as its bare digits, several meters as
+ * one json object of their committed readings ({"name": "digits", ...})
+ * so the values of the same capture always arrive together
+ */
+static char_t* aiMqttMessage(const AiReading *reading)
+{
+   if (reading->meterCount <= 1)
+      return (char_t*) reading->value;
+
+   cJSON *root = cJSON_CreateObject();
+   char_t value[MAX_DIGIT_COUNT+1];
+
+   for (uint_t i = 0; i < reading->meterCount; i++)
+   {
+      // meters still being voted on have nothing to publish
+      if (!reading->meters[i].stable) continue;
+
+      aiGetMeterValue(reading, i, value);
+      cJSON_AddStringToObject(root, appEnv.imgConfig.meters[i].name, value);
+   }
+
+   char_t *message = cJSON_PrintUnformatted(root);
+   cJSON_Delete(root);
+   return message;
+}
+
+// ********************************************************************************************
+
+// must be called with the writer lock held
+static void aiStoreReading(const AiReading *reading)
+{
+   uint_t version = atomic_load_explicit(&snapshotVersion, memory_order_relaxed);
+
+   atomic_store_explicit(&snapshotVersion, version + 1, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+
+   memcpy(&snapshot, reading, sizeof(AiReading));
+
+   atomic_store_explicit(&snapshotVersion, version + 2, memory_order_release);
+}
+
+// ********************************************************************************************
+
+/**
+ * requests and recieves the AI reading through the uart broker.
+ * high priority requests are started between camera chunks.
+ * 
+ * the k210 infers continuously, so its latest result is a single
+ * exchange away. an explicit inference (two exchanges) is only
+ * requested for fresh readings, or when the result didn't move on
+ * (the k210 script runs without the continuous loop).
+ */
+bool_t getAiHelper(AiReading *reading, UartPriority priority, bool_t fresh)
+{
+   if (!fresh)
+   {
+      if (!getAiResultHelper(reading, priority))
+         return FALSE;
+
+      if (reading->valid && reading->frame != lastFrame)
+      {
+         lastFrame = reading->frame;
+         return TRUE;
+      }
+      ESP_LOGI(LOG_TAG, "no new inference, requesting one");
+   }
+
+   UartRequest request;
+
+   // k210 answers once the inference is done
+   uartRequestInit(&request, K210_CMD_AI_READ, NULL, 0, NULL, 0);
+   request.priority = priority;
+   request.deadlineMS = UART_DEADLINE_MS;
+   request.waitTimeMS = 400;
+   if (!uartBrokerExecute(&request))
+   {
+      ESP_LOGE(LOG_TAG, "handshaking failed!");
+      return FALSE;
+   }
+
+   if (!getAiResultHelper(reading, priority) || !reading->valid)
+      return FALSE;
+
+   lastFrame = reading->frame;
+   return TRUE;
+}
+
+/**
+ * fetches the latest k210 result (K210_CMD_AI_SEND).
+ * returns FALSE if the k210 didn't answer, reading->valid
+ * tells whether the answer holds a usable reading.
+ */
+static bool_t getAiResultHelper(AiReading *reading, UartPriority priority)
+{
+   uint8_t data[K210_AI_RESULT_HEADER_SIZE + 2 * MAX_DIGIT_COUNT];
+
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_AI_SEND, NULL, 0, data, sizeof(data));
+   request.priority = priority;
+   request.deadlineMS = UART_DEADLINE_MS;
+   request.waitTimeMS = 300;
+   request.retries = 2;
+   if (!uartBrokerExecute(&request)) {
+      ESP_LOGI(LOG_TAG, "K210 seems to be off!");
+      return FALSE;
+   }
+
+   reading->valid = FALSE;
+   if (request.responseLength < K210_AI_RESULT_HEADER_SIZE)
+   {
+      ESP_LOGE(LOG_TAG, "k210 sent a short response for ai request");
+      return TRUE;
+   }
+
+   reading->source = AI_SOURCE_K210;
+   reading->reread = 0;
+   reading->frame = LOAD32LE(data);
+   reading->confidence = LOAD16LE(data + 4);
+   reading->timestamp = esp_timer_get_time() - LOAD16LE(data + 6) * 1000LL;
+   reading->inferred = LOAD32LE(data + 8);
+   reading->skipped = LOAD32LE(data + 12);
+
+   // nothing infered yet
+   if (reading->frame == 0)
+      return TRUE;
+
+   bool_t invalid = checkAiResponseHelper(
+      data + K210_AI_RESULT_HEADER_SIZE,
+      request.responseLength - K210_AI_RESULT_HEADER_SIZE, reading);
+
+   if (invalid) {
+      ESP_LOGE(LOG_TAG, "k210 sent invalid response for ai request");
+      return TRUE;
+   }
+
+   reading->valid = TRUE;
+   ESP_LOGI(LOG_TAG, "recieved '%s' (frame %u, confidence %u)",
+      reading->raw, reading->frame, reading->confidence);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+/**
+ * asks k210 to infer the digits below AI_REREAD_PROBABILITY again on
+ * a new snapshot (K210_CMD_AI_REREAD). a digit is only replaced by a
+ * more probable one, so a failed re-read leaves the reading as it was.
+ */
+static void rereadHelper(AiReading *reading, UartPriority priority)
+{
+   uint8_t indexes[MAX_DIGIT_COUNT];
+   uint_t count = 0;
+   uint_t digitCount = strlen(reading->raw);
+
+   for (uint_t i = 0; i < digitCount; i++)
+   {
+      if (reading->probabilities[i] < AI_REREAD_PROBABILITY)
+         indexes[count++] = i;
+   }
+   if (count == 0) return;
+
+   uint8_t data[MAX_DIGIT_COUNT * K210_AI_REREAD_ENTRY_SIZE];
+
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_AI_REREAD, indexes, count, data, sizeof(data));
+   request.priority = priority;
+   request.deadlineMS = UART_DEADLINE_MS;
+   request.waitTimeMS = 400;
+   if (!uartBrokerExecute(&request) ||
+      request.responseLength != count * K210_AI_REREAD_ENTRY_SIZE)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't re-read %u digits", count);
+      return;
+   }
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      char_t digit = data[i * K210_AI_REREAD_ENTRY_SIZE];
+      uint8_t probability = data[i * K210_AI_REREAD_ENTRY_SIZE + 1];
+
+      if ('0' <= digit && digit <= '9' &&
+         probability > reading->probabilities[indexes[i]]) {
+         reading->raw[indexes[i]] = digit;
+         reading->probabilities[indexes[i]] = probability;
+      }
+   }
+
+   reading->reread = count;
+   confidenceHelper(reading);
+   ESP_LOGI(LOG_TAG, "re-read %u digits: '%s'", count, reading->raw);
+}
+
+// ********************************************************************************************
+
+/**
+ * reads the meter on the esp32 when k210 can't: only the digit windows
+ * are fetched from k210 and the int8 classifier runs here. this keeps
+ * readings coming while the k210 model or its inference loop fails,
+ * but it needs the k210 camera path (the esp32 has no camera).
+ * the sampler tries it every AI_FALLBACK_INTERVAL_MS at most.
+ */
+static bool_t getFallbackHelper(AiReading *reading, bool_t fresh)
+{
+   int64_t now = esp_timer_get_time();
+   if (!fresh && lastFallback != 0 &&
+      now - lastFallback < AI_FALLBACK_INTERVAL_MS * 1000LL)
+      return FALSE;
+   lastFallback = now;
+
+   uint_t count = 0;
+   uint8_t *crops = digitWindowsReadCrops(&count);
+   if (crops == NULL || count == 0 || count != appEnv.imgConfig.digitCount)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't prepare the digits for the fallback");
+      free(crops);
+      return FALSE;
+   }
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      DigitPrediction prediction;
+      digitClassify(crops + i * DIGIT_CROP_PIXELS, &fallbackArena, &prediction);
+
+      reading->raw[i] = '0' + prediction.digit;
+      reading->probabilities[i] = (prediction.confidence * 255 + 500) / 1000;
+   }
+   free(crops);
+
+   reading->raw[count] = '\0';
+   reading->valid = TRUE;
+   reading->source = AI_SOURCE_ESP32;
+   reading->reread = 0;
+   splitMetersHelper(reading);
+   confidenceHelper(reading);
+   reading->timestamp = esp_timer_get_time();
+   reading->frame = 0;
+   reading->inferred = 0;
+   reading->skipped = 0;
+
+   ESP_LOGI(LOG_TAG, "esp32 fallback read '%s' (confidence %u)",
+      reading->raw, reading->confidence);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+/**
+ * validates the k210 response for ai result request: digitCount
+ * decimal digits, optionally followed by the probability of each digit
+ * (one byte, 255 = 1). copies the digits into reading->raw as a
+ * null-terminated string and splits them by meter.
+ */
+bool_t checkAiResponseHelper(const uint8_t *data, size_t length, AiReading *reading)
+{
+   uint_t digitCount = appEnv.imgConfig.digitCount;
+   if ((length != digitCount && length != 2 * digitCount) ||
+      digitCount > MAX_DIGIT_COUNT)
+      return TRUE;
+
+   char_t *res = reading->raw;
+   memcpy(res, data, digitCount);
+   res[digitCount] = '\0';
+
+   for (uint_t i = 0; i < digitCount; i++)
+   {
+      if (res[i] < '0' || '9' < res[i])
+         return TRUE;
+   }
+
+   splitMetersHelper(reading);
+
+   // older k210 scripts only send the digits, nothing gets re-read then
+   if (length == digitCount) {
+      memset(reading->probabilities, 255, digitCount);
+      return FALSE;
+   }
+
+   memcpy(reading->probabilities, data + digitCount, digitCount);
+   confidenceHelper(reading);
+   return FALSE;
+}
+
+// ********************************************************************************************
+
+/**
+ * lays the meters of the current ImgConfig over reading->value,
+ * each one starts with the confidence of the whole reading
+ */
+static void splitMetersHelper(AiReading *reading)
+{
+   ImgConfig *imgConfig = &appEnv.imgConfig;
+   uint_t offset = 0;
+
+   reading->meterCount = imgConfig->meterCount;
+   for (uint_t i = 0; i < imgConfig->meterCount; i++)
+   {
+      AiMeterReading *meter = &reading->meters[i];
+      meter->offset = offset;
+      meter->digitCount = imgConfig->meters[i].digitCount;
+      meter->confidence = reading->confidence;
+      offset += meter->digitCount;
+   }
+}
+
+/**
+ * derives the confidence of the reading and of each meter from the
+ * digit probabilities: on k210 it is the product of the digits (like
+ * the k210 itself computes it), the esp32 classifier is only as sure
+ * as its least sure digit
+ */
+static void confidenceHelper(AiReading *reading)
+{
+   bool_t product = reading->source == AI_SOURCE_K210;
+   float total = 1;
+
+   for (uint_t m = 0; m < reading->meterCount; m++)
+   {
+      AiMeterReading *meter = &reading->meters[m];
+      float confidence = 1;
+
+      for (uint_t i = 0; i < meter->digitCount; i++)
+      {
+         float probability = reading->probabilities[meter->offset + i] / 255.0f;
+         if (product) confidence *= probability;
+         else if (probability < confidence) confidence = probability;
+      }
+
+      meter->confidence = confidence * 1000 + 0.5f;
+      if (product) total *= confidence;
+      else if (confidence < total) total = confidence;
+   }
+
+   reading->confidence = total * 1000 + 0.5f;
+}
 
 // ********************************************************************************************
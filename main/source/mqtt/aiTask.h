@@ -0,0 +1,87 @@
+#ifndef __AI_TASK_H__
+#define __AI_TASK_H__
+
+#include "os_port.h"
+#include "source/envTypes.h"
+
+// default time between two readings (0 disables sampling)
+#define AI_DEFAULT_SAMPLE_INTERVAL_MS 5000
+#define AI_MIN_SAMPLE_INTERVAL_MS 1000
+
+/**
+ * when k210 can't infer, the sampler classifies the digit windows on
+ * the esp32 instead (see digitClassifier.h), at most this often
+ */
+#define AI_FALLBACK_INTERVAL_MS 30000
+
+// where the digits of a reading were classified
+#define AI_SOURCE_K210 0
+#define AI_SOURCE_ESP32 1
+
+/**
+ * k210 digits below this probability (255 = 1) are infered again on
+ * a new snapshot before the reading goes through the filter
+ */
+#define AI_REREAD_PROBABILITY 153
+
+typedef struct _AiMeterReading AiMeterReading;
+typedef struct _AiReading AiReading;
+
+// the digits of one meter (see MeterConfig) within AiReading.value
+struct _AiMeterReading
+{
+   uint8_t offset;
+   uint8_t digitCount;
+   uint16_t confidence; // per mille
+   bool_t stable; // value was committed by the filter (see readingFilter.h)
+};
+
+/**
+ * last meter reading taken by the sampler. all the meters are read
+ * from the same capture: value holds their digits one meter after
+ * the other, meters tells where each one starts. raw holds the
+ * digits as classified, value what the filter made of them.
+ */
+struct _AiReading
+{
+   bool_t valid;
+   uint32_t seq;       // increases with every successful reading
+   int64_t timestamp;  // esp_timer time of the inference in microseconds
+   uint32_t frame;     // k210 inference counter
+   uint16_t confidence; // per mille
+   uint32_t inferred;  // digits run through the model since the k210 booted
+   uint32_t skipped;   // digits served from the change detector cache
+   uint8_t source;     // AI_SOURCE_*
+   uint8_t reread;     // digits infered again for a low probability
+   char_t raw[MAX_DIGIT_COUNT+1];
+   uint8_t probabilities[MAX_DIGIT_COUNT]; // per raw digit, 255 = 1
+   char_t value[MAX_DIGIT_COUNT+1];
+   uint8_t meterCount;
+   AiMeterReading meters[MAX_METER_COUNT];
+};
+
+// starts the sampler task (should be called once appEnv is loaded)
+void aiTaskInit();
+
+// copies the latest reading without blocking
+void aiGetReading(AiReading *reading);
+
+/**
+ * takes a new reading from a frame captured after the call
+ * (used for "?fresh=1"). the result is stored just like a sampled one.
+ */
+bool_t aiReadNow(AiReading *reading);
+
+// drops the stored reading (e.g. after the digits are reconfigured)
+void aiInvalidateReading();
+
+/**
+ * copies the digits of the (meter)th meter into (value) as a
+ * null-terminated string, (value) must hold MAX_DIGIT_COUNT+1 chars
+ */
+void aiGetMeterValue(const AiReading *reading, uint_t meter, char_t *value);
+
+// changes the sampling interval and wakes the sampler up
+void aiSetSampleInterval(uint32_t intervalMS);
+
+#endif
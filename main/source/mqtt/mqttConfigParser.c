@@ -11,8 +11,7 @@
 bool_t parseMqttConfig(MqttConfig *mqttConfig, char_t *data);
 bool_t mqttParseHelper(MqttConfig *mqttConfig, cJSON *root);
 
-char_t* mqttConfigToJson(MqttConfig *mqttConfig);
-bool_t mqttConfigToJsonHelper(MqttConfig *mqttConfig, cJSON *root);
+void mqttConfigWriteJson(JsonWriter *writer, MqttConfig *mqttConfig);
 
 // ********************************************************************************************
 
@@ -95,50 +94,17 @@ bool_t mqttParseHelper(MqttConfig *mqttConfig, cJSON *root)
 
 // ********************************************************************************************
 
-char_t* mqttConfigToJson(MqttConfig *mqttConfig)
+void mqttConfigWriteJson(JsonWriter *writer, MqttConfig *mqttConfig)
 {
-   if (mqttConfig == NULL)
-      return NULL;
-
-   char_t *jsonStr = NULL;
-   cJSON *root = cJSON_CreateObject();
-   bool_t result = mqttConfigToJsonHelper(mqttConfig, root);
-   if (result) jsonStr = cJSON_Print(root);
-   cJSON_Delete(root);
-   return jsonStr;
-}
-
-// ********************************************************************************************
-
-bool_t mqttConfigToJsonHelper(MqttConfig *mqttConfig, cJSON *root)
-{
-   cJSON *child;
-
-   child = cJSON_AddNumberToObject(root,
-      "mqttEnable", mqttConfig->mqttEnable);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "serverIP", ipv4AddrToString(mqttConfig->serverIP, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddNumberToObject(root,
-      "serverPort", mqttConfig->serverPort);
-   if (!child) return FALSE;
-
-   child = cJSON_AddNumberToObject(root,
-      "timeout", mqttConfig->timeout);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "statusTopic", mqttConfig->statusTopic);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "messageTopic", mqttConfig->messageTopic);
-   if (!child) return FALSE;
-
-   return TRUE;
+   jsonBeginObject(writer, NULL);
+   jsonAddNumber(writer, "mqttEnable", mqttConfig->mqttEnable);
+   jsonAddString(writer, "serverIP",
+      ipv4AddrToString(mqttConfig->serverIP, NULL));
+   jsonAddNumber(writer, "serverPort", mqttConfig->serverPort);
+   jsonAddNumber(writer, "timeout", mqttConfig->timeout);
+   jsonAddString(writer, "statusTopic", mqttConfig->statusTopic);
+   jsonAddString(writer, "messageTopic", mqttConfig->messageTopic);
+   jsonEndObject(writer);
 }
 
 // ********************************************************************************************
@@ -3,8 +3,9 @@
 
 #include "os_port.h"
 #include "mqttHelper.h"
+#include "source/server/jsonWriter.h"
 
 bool_t parseMqttConfig(MqttConfig *mqttConfig, char_t *data);
-char_t* mqttConfigToJson(MqttConfig *mqttConfig);
+void mqttConfigWriteJson(JsonWriter *writer, MqttConfig *mqttConfig);
 
 #endif
\ No newline at end of file
@@ -11,20 +11,17 @@
 bool_t parseLanConfig(LanConfig *config, char_t *data);
 bool_t parseLanConfigHelper(LanConfig *config, cJSON *root);
 
-char_t* lanConfigToJson(LanConfig *config);
-bool_t lanConfigToJsonHelper(LanConfig *config, cJSON *root);
+void lanConfigWriteJson(JsonWriter *writer, LanConfig *config);
 
 bool_t parseStaWifiConfig(StaWifiConfig *config, char_t *data);
 bool_t parseStaWifiConfigHelper(StaWifiConfig *config, cJSON *root);
 
-char_t* staWifiConfigToJson(StaWifiConfig *config);
-bool_t staWifiConfigToJsonHelper(StaWifiConfig *config, cJSON *root);
+void staWifiConfigWriteJson(JsonWriter *writer, StaWifiConfig *config);
 
 bool_t parseApWifiConfig(ApWifiConfig *config, char_t *data);
 bool_t parseApWifiConfigHelper(ApWifiConfig *config, cJSON *root);
 
-char_t* apWifiConfigToJson(ApWifiConfig *config);
-bool_t apWifiConfigToJsonHelper(ApWifiConfig *config, cJSON *root);
+void apWifiConfigWriteJson(JsonWriter *writer, ApWifiConfig *config);
 
 // ********************************************************************************************
 
@@ -126,58 +123,23 @@ bool_t parseLanConfigHelper(LanConfig *config, cJSON *root)
 
 // ********************************************************************************************
 
-char_t* lanConfigToJson(LanConfig *config)
+void lanConfigWriteJson(JsonWriter *writer, LanConfig *config)
 {
-   if (config == NULL)
-      return NULL;
-
-   char_t *jsonStr = NULL;
-   cJSON *root = cJSON_CreateObject();
-   bool_t result = lanConfigToJsonHelper(config, root);
-   if (result) jsonStr = cJSON_Print(root);
-   cJSON_Delete(root);
-   return jsonStr;
-}
-
-// ********************************************************************************************
-
-bool_t lanConfigToJsonHelper(LanConfig *config, cJSON *root)
-{
-   cJSON *child;
-
-   child = cJSON_AddStringToObject(root,
-      "hostName", config->hostName);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "macAddress",
+   jsonBeginObject(writer, NULL);
+   jsonAddString(writer, "hostName", config->hostName);
+   jsonAddString(writer, "macAddress",
       macAddrToString(&config->macAddress, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddNumberToObject(root,
-      "enableDhcp", config->enableDhcp);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "hostAddr",
-      ipv4AddrToString(config->hostAddr, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "subnetMask",
+   jsonAddNumber(writer, "enableDhcp", config->enableDhcp);
+   jsonAddString(writer, "hostAddr", ipv4AddrToString(config->hostAddr, NULL));
+   jsonAddString(writer, "subnetMask",
       ipv4AddrToString(config->subnetMask, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "defaultGateway",
+   jsonAddString(writer, "defaultGateway",
       ipv4AddrToString(config->defaultGateway, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "primaryDns",
+   jsonAddString(writer, "primaryDns",
       ipv4AddrToString(config->primaryDns, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "secondaryDns",
+   jsonAddString(writer, "secondaryDns",
       ipv4AddrToString(config->secondaryDns, NULL));
-   if (!child) return FALSE;
-
-   return TRUE;
+   jsonEndObject(writer);
 }
 
 // ********************************************************************************************
@@ -302,70 +264,26 @@ bool_t parseStaWifiConfigHelper(StaWifiConfig *config, cJSON *root)
 
 // ********************************************************************************************
 
-char_t* staWifiConfigToJson(StaWifiConfig *config)
-{
-   if (config == NULL)
-      return NULL;
-
-   char_t *jsonStr = NULL;
-   cJSON *root = cJSON_CreateObject();
-   bool_t result = staWifiConfigToJsonHelper(config, root);
-   if (result) jsonStr = cJSON_Print(root);
-   cJSON_Delete(root);
-   return jsonStr;
-}
-
-// ********************************************************************************************
-
-bool_t staWifiConfigToJsonHelper(StaWifiConfig *config, cJSON *root)
+void staWifiConfigWriteJson(JsonWriter *writer, StaWifiConfig *config)
 {
-   cJSON *child;
-
-   child = cJSON_AddNumberToObject(root,
-      "enableInterface", config->enableInterface);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "hostName", config->hostName);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "macAddress",
+   jsonBeginObject(writer, NULL);
+   jsonAddNumber(writer, "enableInterface", config->enableInterface);
+   jsonAddString(writer, "hostName", config->hostName);
+   jsonAddString(writer, "macAddress",
       macAddrToString(&config->macAddress, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddNumberToObject(root,
-      "useDhcpClient", config->useDhcpClient);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "hostAddr",
-      ipv4AddrToString(config->hostAddr, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "subnetMask",
+   jsonAddNumber(writer, "useDhcpClient", config->useDhcpClient);
+   jsonAddString(writer, "hostAddr", ipv4AddrToString(config->hostAddr, NULL));
+   jsonAddString(writer, "subnetMask",
       ipv4AddrToString(config->subnetMask, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "defaultGateway",
+   jsonAddString(writer, "defaultGateway",
       ipv4AddrToString(config->defaultGateway, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "primaryDns",
+   jsonAddString(writer, "primaryDns",
       ipv4AddrToString(config->primaryDns, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "secondaryDns",
+   jsonAddString(writer, "secondaryDns",
       ipv4AddrToString(config->secondaryDns, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "ssid", config->ssid);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "password", config->password);
-   if (!child) return FALSE;
-
-   return TRUE;
+   jsonAddString(writer, "ssid", config->ssid);
+   jsonAddString(writer, "password", config->password);
+   jsonEndObject(writer);
 }
 
 // ********************************************************************************************
@@ -506,78 +424,30 @@ bool_t parseApWifiConfigHelper(ApWifiConfig *config, cJSON *root)
 
 // ********************************************************************************************
 
-char_t* apWifiConfigToJson(ApWifiConfig *config)
-{
-   if (config == NULL)
-      return NULL;
-
-   char_t *jsonStr = NULL;
-   cJSON *root = cJSON_CreateObject();
-   bool_t result = apWifiConfigToJsonHelper(config, root);
-   if (result) jsonStr = cJSON_Print(root);
-   cJSON_Delete(root);
-   return jsonStr;
-}
-
-// ********************************************************************************************
-
-bool_t apWifiConfigToJsonHelper(ApWifiConfig *config, cJSON *root)
+void apWifiConfigWriteJson(JsonWriter *writer, ApWifiConfig *config)
 {
-   cJSON *child;
-
-   child = cJSON_AddNumberToObject(root,
-      "enableInterface", config->enableInterface);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "hostName", config->hostName);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "macAddress",
+   jsonBeginObject(writer, NULL);
+   jsonAddNumber(writer, "enableInterface", config->enableInterface);
+   jsonAddString(writer, "hostName", config->hostName);
+   jsonAddString(writer, "macAddress",
       macAddrToString(&config->macAddress, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddNumberToObject(root,
-      "useDhcpServer", config->useDhcpServer);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "hostAddr",
-      ipv4AddrToString(config->hostAddr, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "subnetMask",
+   jsonAddNumber(writer, "useDhcpServer", config->useDhcpServer);
+   jsonAddString(writer, "hostAddr", ipv4AddrToString(config->hostAddr, NULL));
+   jsonAddString(writer, "subnetMask",
       ipv4AddrToString(config->subnetMask, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "defaultGateway",
+   jsonAddString(writer, "defaultGateway",
       ipv4AddrToString(config->defaultGateway, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "primaryDns",
+   jsonAddString(writer, "primaryDns",
       ipv4AddrToString(config->primaryDns, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "secondaryDns",
+   jsonAddString(writer, "secondaryDns",
       ipv4AddrToString(config->secondaryDns, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "minAddrRange",
+   jsonAddString(writer, "minAddrRange",
       ipv4AddrToString(config->minAddrRange, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root, "maxAddrRange",
+   jsonAddString(writer, "maxAddrRange",
       ipv4AddrToString(config->maxAddrRange, NULL));
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "ssid", config->ssid);
-   if (!child) return FALSE;
-
-   child = cJSON_AddStringToObject(root,
-      "password", config->password);
-   if (!child) return FALSE;
-
-   return TRUE;
+   jsonAddString(writer, "ssid", config->ssid);
+   jsonAddString(writer, "password", config->password);
+   jsonEndObject(writer);
 }
 
 // ********************************************************************************************
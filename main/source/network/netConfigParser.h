@@ -2,14 +2,15 @@
 #define __NET_CONFIG_PARSER__
 
 #include "source/network/network.h"
+#include "source/server/jsonWriter.h"
 
 bool_t parseLanConfig(LanConfig *config, char_t *data);
-char_t* lanConfigToJson(LanConfig *config);
+void lanConfigWriteJson(JsonWriter *writer, LanConfig *config);
 
 bool_t parseStaWifiConfig(StaWifiConfig *config, char_t *data);
-char_t* staWifiConfigToJson(StaWifiConfig *config);
+void staWifiConfigWriteJson(JsonWriter *writer, StaWifiConfig *config);
 
 bool_t parseApWifiConfig(ApWifiConfig *config, char_t *data);
-char_t* apWifiConfigToJson(ApWifiConfig *config);
+void apWifiConfigWriteJson(JsonWriter *writer, ApWifiConfig *config);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,367 @@
+#include <stdlib.h>
+#include <string.h>
+#include "linkSpeed.h"
+#include "uartHelper.h"
+#include "uartBroker.h"
+#include "cpu_endian.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "source/storage/storage.h"
+#include "source/appEnv.h"
+#include "esp_log.h"
+
+#define LOG_TAG "linkSpeed"
+
+// echo rounds at a new rate and the errors they may show
+#define LINK_TEST_ROUNDS 8
+#define LINK_TEST_SIZE 1024
+#define LINK_MAX_TEST_ERRORS 1
+
+// consecutive failed transactions that drop the link to the base rate
+#define LINK_ERROR_BURST 3
+
+// the k210 switches a few milliseconds after its response is out
+#define LINK_SWITCH_DELAY_MS 20
+#define LINK_COMMAND_WAIT_MS 200
+
+// the k210 reverts an uncommitted rate after this long (see microPython.py)
+#define LINK_CONFIRM_MS 1000
+
+// the k210 may still be booting when the esp32 starts
+#define LINK_BOOT_PINGS 30
+#define LINK_BOOT_PING_INTERVAL_MS 500
+
+static const uint32_t linkRates[LINK_RATE_COUNT] = {
+   UART_BASE_BAUD_RATE, 1500000, 2000000, LINK_MAX_BAUD_RATE
+};
+
+/**
+ * the state below is only changed on the broker task
+ * (inside operations and the monitor), readers just copy it
+ */
+static LinkRateStats rateStats[LINK_RATE_COUNT];
+static uint_t currentRate = 0;
+static uint_t failureBurst = 0;
+
+// rate to step back up to once the k210 answers again (0 = none)
+static uint_t resumeRate = 0;
+
+// set when a rate fails its test pattern (see linkResumeHelper)
+static bool_t rateTestFailed = FALSE;
+
+// test pattern and its echo (too large for the broker stack)
+static uint8_t testPattern[LINK_TEST_SIZE];
+static uint8_t testEcho[LINK_TEST_SIZE];
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void linkSpeedInit();
+void linkSpeedTask(void *pvParameters);
+uint32_t linkNegotiate(uint32_t maxBaudRate);
+uint32_t linkGetBaudRate();
+void linkGetStats(LinkRateStats *stats);
+static bool_t linkNegotiateOperation(UartRequest *request);
+static void linkNegotiateHelper(uint32_t maxBaudRate);
+static bool_t linkSwitchRate(uint_t index);
+static bool_t linkTestRate(uint_t index);
+static bool_t linkResync(uint_t index);
+static void linkReportResult(UartResult result);
+static bool_t isLinkError(UartResult result);
+static void linkResumeHelper(uint_t rate);
+static bool_t linkPing(uint_t retries);
+
+// ********************************************************************************************
+
+void linkSpeedInit()
+{
+   for (uint_t i = 0; i < LINK_RATE_COUNT; i++)
+      rateStats[i].baudRate = linkRates[i];
+
+   uartBrokerSetMonitor(linkReportResult);
+
+   BaseType_t ret = xTaskCreatePinnedToCore(
+      linkSpeedTask, "linkSpeed", 3072, NULL, 4, NULL, 1
+   );
+   if(ret != pdPASS)
+      ESP_LOGE(LOG_TAG, "failed to create task!");
+}
+
+// ********************************************************************************************
+
+// waits for the k210 to come up, negotiates once and exits
+void linkSpeedTask(void *pvParameters)
+{
+   bool_t alive = FALSE;
+   for (uint_t i = 0; i < LINK_BOOT_PINGS && !alive; i++)
+   {
+      UartRequest request;
+      uartRequestInit(&request, K210_CMD_PING, NULL, 0, NULL, 0);
+      request.priority = UART_PRIORITY_LOW;
+      request.waitTimeMS = 100;
+
+      alive = uartBrokerExecute(&request);
+      if (!alive) vTaskDelay(pdMS_TO_TICKS(LINK_BOOT_PING_INTERVAL_MS));
+   }
+
+   if (alive && appEnv.linkBaudRate > UART_BASE_BAUD_RATE)
+      linkNegotiate(appEnv.linkBaudRate);
+   else if (!alive)
+      ESP_LOGE(LOG_TAG, "k210 didn't answer, staying at %d baud",
+         UART_BASE_BAUD_RATE);
+
+   vTaskDelete(NULL);
+}
+
+// ********************************************************************************************
+
+uint32_t linkNegotiate(uint32_t maxBaudRate)
+{
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_LINK_SPEED, NULL, 0, NULL, 0);
+   request.operation = linkNegotiateOperation;
+   request.param = &maxBaudRate;
+   request.priority = UART_PRIORITY_HIGH;
+   request.deadlineMS = 10000;
+
+   uartBrokerExecute(&request);
+
+   uint32_t baudRate = linkGetBaudRate();
+   ESP_LOGI(LOG_TAG, "link is running at %d baud", baudRate);
+
+   appEnv.linkBaudRate = baudRate;
+   saveLinkBaudRate(baudRate);
+   return baudRate;
+}
+
+uint32_t linkGetBaudRate()
+{
+   return linkRates[currentRate];
+}
+
+void linkGetStats(LinkRateStats *stats)
+{
+   memcpy(stats, rateStats, sizeof(rateStats));
+}
+
+// ********************************************************************************************
+
+static bool_t linkNegotiateOperation(UartRequest *request)
+{
+   resumeRate = 0;
+   linkNegotiateHelper(*(uint32_t*) request->param);
+   return TRUE;
+}
+
+/**
+ * moves down to the fastest allowed rate if the link is above it,
+ * then steps up one rate at a time until a step fails
+ */
+static void linkNegotiateHelper(uint32_t maxBaudRate)
+{
+   uint_t target = 0;
+   while (target + 1 < LINK_RATE_COUNT && linkRates[target + 1] <= maxBaudRate)
+      target++;
+
+   if (currentRate > target && !linkSwitchRate(target))
+      return;
+
+   while (currentRate < target)
+   {
+      if (!linkSwitchRate(currentRate + 1))
+         break;
+   }
+}
+
+// ********************************************************************************************
+
+/**
+ * switches both ends to linkRates[index] and keeps the rate
+ * only if the test pattern gets through. returns FALSE if the
+ * link is back at the previous (or the base) rate.
+ */
+static bool_t linkSwitchRate(uint_t index)
+{
+   uint_t previous = currentRate;
+   uint32_t baudRate = linkRates[index];
+   ESP_LOGI(LOG_TAG, "switching to %d baud", baudRate);
+
+   uint8_t args[4];
+   STORE32LE(baudRate, args);
+
+   // no retries, the k210 may have switched already
+   UartFrame frame;
+   if (!uartTransaction(K210_CMD_LINK_SPEED, args, sizeof(args),
+      &frame, LINK_COMMAND_WAIT_MS, 0, NULL))
+   {
+      rateStats[previous].errors++;
+      linkResync(previous);
+      return FALSE;
+   }
+   uartFrameRelease(&frame);
+
+   uartSetBaudRate(baudRate);
+   currentRate = index;
+   failureBurst = 0;
+   vTaskDelay(pdMS_TO_TICKS(LINK_SWITCH_DELAY_MS));
+
+   // commit can be repeated safely
+   bool_t tested = linkTestRate(index);
+   if (tested && uartTransaction(K210_CMD_LINK_COMMIT,
+      NULL, 0, &frame, LINK_COMMAND_WAIT_MS, 2, NULL))
+   {
+      uartFrameRelease(&frame);
+      return TRUE;
+   }
+
+   if (!tested) rateTestFailed = TRUE;
+   ESP_LOGE(LOG_TAG, "%d baud failed the %s", baudRate,
+      tested ? "commit" : "test");
+   linkResync(previous);
+   return FALSE;
+}
+
+// ********************************************************************************************
+
+// echoes a pseudo random pattern, the frame crc catches the corruption
+static bool_t linkTestRate(uint_t index)
+{
+   uint32_t state = 0x9E3779B9 ^ linkRates[index];
+   uint_t errors = 0;
+
+   for (uint_t round = 0; round < LINK_TEST_ROUNDS; round++)
+   {
+      for (uint_t i = 0; i < LINK_TEST_SIZE; i++)
+      {
+         // xorshift32
+         state ^= state << 13;
+         state ^= state >> 17;
+         state ^= state << 5;
+         testPattern[i] = (uint8_t) state;
+      }
+
+      UartFrame frame;
+      bool_t success = uartTransaction(K210_CMD_PING, testPattern,
+         LINK_TEST_SIZE, &frame, LINK_COMMAND_WAIT_MS, 0, NULL);
+
+      if (success)
+      {
+         size_t length = uartFrameRead(&frame, 0, testEcho, LINK_TEST_SIZE);
+         success = length == LINK_TEST_SIZE &&
+            !memcmp(testPattern, testEcho, LINK_TEST_SIZE);
+         uartFrameRelease(&frame);
+      }
+
+      rateStats[index].transactions++;
+      if (!success)
+      {
+         rateStats[index].errors++;
+         if (++errors > LINK_MAX_TEST_ERRORS)
+            return FALSE;
+      }
+   }
+
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+/**
+ * goes back to linkRates[index] and waits for the k210 to drop the
+ * uncommitted rate. if the k210 still doesn't answer, both ends
+ * are taken down to the base rate (the k210 follows after a burst
+ * of garbage, see microPython.py).
+ */
+static bool_t linkResync(uint_t index)
+{
+   uartSetBaudRate(linkRates[index]);
+   currentRate = index;
+   failureBurst = 0;
+   vTaskDelay(pdMS_TO_TICKS(LINK_CONFIRM_MS + LINK_SWITCH_DELAY_MS));
+
+   if (linkPing(2))
+      return TRUE;
+
+   if (index == 0)
+      return FALSE;
+
+   rateStats[index].fallbacks++;
+   uartSetBaudRate(UART_BASE_BAUD_RATE);
+   currentRate = 0;
+   return linkPing(8);
+}
+
+static bool_t linkPing(uint_t retries)
+{
+   UartFrame frame;
+   if (!uartTransaction(K210_CMD_PING, NULL, 0, &frame, 100, retries, NULL))
+      return FALSE;
+
+   uartFrameRelease(&frame);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+/**
+ * broker monitor: counts the outcome against the current rate and
+ * falls back to the base rate after a burst of link errors. the
+ * persisted limit is only lowered if the failing rate also fails a
+ * fresh test, a k210 that was down for a while doesn't cost it.
+ */
+static void linkReportResult(UartResult result)
+{
+   rateStats[currentRate].transactions++;
+   if (!isLinkError(result))
+   {
+      failureBurst = 0;
+      if (result == UART_RESULT_OK && resumeRate != 0)
+         linkResumeHelper(resumeRate);
+      return;
+   }
+
+   rateStats[currentRate].errors++;
+   if (++failureBurst < LINK_ERROR_BURST || currentRate == 0)
+      return;
+
+   uint_t failed = currentRate;
+   ESP_LOGE(LOG_TAG, "too many errors at %d baud, falling back",
+      linkRates[failed]);
+
+   rateStats[failed].fallbacks++;
+   uartSetBaudRate(UART_BASE_BAUD_RATE);
+   currentRate = 0;
+   failureBurst = 0;
+
+   // the k210 is down (or still booting), resume once it answers
+   resumeRate = failed;
+   if (linkPing(8))
+      linkResumeHelper(failed);
+}
+
+/**
+ * nacks and stray responses come from a k210 that got the command
+ * intact. a missing response is only blamed on the link if the k210
+ * doesn't answer a ping either (a slow capture or inference isn't)
+ */
+static bool_t isLinkError(UartResult result)
+{
+   if (result == UART_RESULT_CORRUPT)
+      return TRUE;
+
+   return result == UART_RESULT_TIMEOUT && !linkPing(0);
+}
+
+// steps back up to linkRates[rate] after a fallback
+static void linkResumeHelper(uint_t rate)
+{
+   resumeRate = 0;
+   rateTestFailed = FALSE;
+   linkNegotiateHelper(linkRates[rate]);
+
+   if (currentRate < rate && rateTestFailed)
+   {
+      appEnv.linkBaudRate = linkRates[currentRate];
+      saveLinkBaudRate(appEnv.linkBaudRate);
+   }
+}
@@ -0,0 +1,55 @@
+#ifndef __linkSpeed_H__
+#define __linkSpeed_H__
+
+#include "os_port.h"
+
+/**
+ * the k210 link starts at UART_BASE_BAUD_RATE after a reset of
+ * either side. faster rates are negotiated step by step:
+ *
+ * 1. K210_CMD_LINK_SPEED (baud u32) is answered at the old rate,
+ *    then both ends switch to the new rate.
+ * 2. a crc'd test pattern is echoed back (K210_CMD_PING) a few times.
+ * 3. K210_CMD_LINK_COMMIT makes the new rate stick on the k210,
+ *    without it the k210 goes back to the old rate on its own.
+ *
+ * once running, a burst of link errors (corrupted frames, or missing
+ * responses while the k210 doesn't answer a ping either) drops both
+ * ends back to the base rate, which is always the common ground.
+ * nacks and slow commands don't count. the link steps back up when
+ * the k210 answers again and only a failed test lowers the limit.
+ */
+#define LINK_RATE_COUNT 4
+#define LINK_MAX_BAUD_RATE 3000000
+
+typedef struct _LinkRateStats LinkRateStats;
+
+// observed link quality at one of the candidate rates
+struct _LinkRateStats
+{
+   uint32_t baudRate;
+   uint32_t transactions; // including the test rounds
+   uint32_t errors;
+   uint32_t fallbacks;    // times the rate was dropped after an error burst
+};
+
+/**
+ * starts a background task that waits for the k210 and then
+ * negotiates up to the persisted rate (appEnv.linkBaudRate).
+ * should be called once after uartBrokerInit and retrieveEnvironment.
+ */
+void linkSpeedInit();
+
+/**
+ * steps the link up (or down) to the fastest candidate rate that is
+ * not above (maxBaudRate) and passes the test. the reached rate is
+ * persisted and returned.
+ */
+uint32_t linkNegotiate(uint32_t maxBaudRate);
+
+uint32_t linkGetBaudRate();
+
+// copies the counters of all candidate rates (LINK_RATE_COUNT entries)
+void linkGetStats(LinkRateStats *stats);
+
+#endif
@@ -0,0 +1,234 @@
+#include <stdlib.h>
+#include <string.h>
+#include "uartBroker.h"
+#include "uartHelper.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+
+#define LOG_TAG "uartBroker"
+
+#define DEFAULT_DEADLINE_MS 2000
+#define DEFAULT_WAIT_MS 500
+
+/**
+ * requests waiting to be started. the broker task is the only
+ * user of the uart link, callers never touch the ring directly.
+ * pendingCount counts the queued requests to wake the broker up.
+ */
+static UartRequest *queue[UART_BROKER_QUEUE_LEN];
+static uint_t queueLength = 0;
+static uint32_t submitOrder = 0;
+static SemaphoreHandle_t queueLock;
+static SemaphoreHandle_t pendingCount;
+static UartMonitor linkMonitor = NULL;
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void uartBrokerInit();
+void uartBrokerTask(void *pvParameters);
+void uartRequestInit(UartRequest *request, uint8_t type,
+   const void *payload, size_t length, uint8_t *response, size_t responseSize);
+bool_t uartBrokerSubmit(UartRequest *request);
+bool_t uartBrokerWait(UartRequest *request);
+bool_t uartBrokerExecute(UartRequest *request);
+void uartBrokerSetMonitor(UartMonitor monitor);
+static UartRequest* brokerPopRequest();
+static bool_t brokerComesFirst(const UartRequest *a, const UartRequest *b);
+static int brokerRunRequest(UartRequest *request);
+static void brokerComplete(UartRequest *request, int state);
+
+// ********************************************************************************************
+
+void uartBrokerInit()
+{
+   queueLock = xSemaphoreCreateMutex();
+   pendingCount = xSemaphoreCreateCounting(UART_BROKER_QUEUE_LEN, 0);
+
+   BaseType_t ret = xTaskCreatePinnedToCore(
+      uartBrokerTask, "uartBroker", 4096, NULL, 10, NULL, 1
+   );
+   if(ret != pdPASS)
+      ESP_LOGE(LOG_TAG, "failed to create broker task!");
+}
+
+// ********************************************************************************************
+
+void uartBrokerTask(void *pvParameters)
+{
+   while(1)
+   {
+      xSemaphoreTake(pendingCount, portMAX_DELAY);
+
+      UartRequest *request = brokerPopRequest();
+      if (request == NULL) continue;
+
+      TickType_t waited = xTaskGetTickCount() - request->submitTime;
+      if (waited > pdMS_TO_TICKS(request->deadlineMS))
+      {
+         ESP_LOGE(LOG_TAG, "command 0x%02X expired", request->type);
+         brokerComplete(request, UART_REQUEST_EXPIRED);
+         continue;
+      }
+
+      brokerComplete(request, brokerRunRequest(request));
+   }
+}
+
+// ********************************************************************************************
+
+void uartRequestInit(UartRequest *request, uint8_t type,
+   const void *payload, size_t length, uint8_t *response, size_t responseSize)
+{
+   memset(request, 0, sizeof(UartRequest));
+   request->type = type;
+   request->payload = payload;
+   request->length = length;
+   request->response = response;
+   request->responseSize = responseSize;
+   request->priority = UART_PRIORITY_NORMAL;
+   request->deadlineMS = DEFAULT_DEADLINE_MS;
+   request->waitTimeMS = DEFAULT_WAIT_MS;
+   request->retries = 1;
+}
+
+// ********************************************************************************************
+
+bool_t uartBrokerSubmit(UartRequest *request)
+{
+   request->owner = request->callback ? NULL : xTaskGetCurrentTaskHandle();
+   request->submitTime = xTaskGetTickCount();
+   request->responseLength = 0;
+   atomic_store(&request->state, UART_REQUEST_PENDING);
+
+   xSemaphoreTake(queueLock, portMAX_DELAY);
+   bool_t queued = queueLength < UART_BROKER_QUEUE_LEN;
+   if (queued)
+   {
+      request->order = submitOrder++;
+      queue[queueLength++] = request;
+   }
+   xSemaphoreGive(queueLock);
+
+   if (!queued)
+   {
+      ESP_LOGE(LOG_TAG, "queue is full, command 0x%02X dropped", request->type);
+      atomic_store(&request->state, UART_REQUEST_FAILED);
+      return FALSE;
+   }
+
+   xSemaphoreGive(pendingCount);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+bool_t uartBrokerWait(UartRequest *request)
+{
+   // other notifications may wake us up, the state tells the truth
+   while (atomic_load(&request->state) == UART_REQUEST_PENDING)
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+   return atomic_load(&request->state) == UART_REQUEST_DONE;
+}
+
+bool_t uartBrokerExecute(UartRequest *request)
+{
+   if (!uartBrokerSubmit(request))
+      return FALSE;
+
+   return uartBrokerWait(request);
+}
+
+void uartBrokerSetMonitor(UartMonitor monitor)
+{
+   linkMonitor = monitor;
+}
+
+// ********************************************************************************************
+
+// removes the request that should be started next
+static UartRequest* brokerPopRequest()
+{
+   UartRequest *request = NULL;
+
+   xSemaphoreTake(queueLock, portMAX_DELAY);
+   if (queueLength > 0)
+   {
+      uint_t best = 0;
+      for (uint_t i = 1; i < queueLength; i++)
+      {
+         if (brokerComesFirst(queue[i], queue[best]))
+            best = i;
+      }
+
+      request = queue[best];
+      queue[best] = queue[--queueLength];
+   }
+   xSemaphoreGive(queueLock);
+
+   return request;
+}
+
+// priority first, then the earliest deadline, then submit order
+static bool_t brokerComesFirst(const UartRequest *a, const UartRequest *b)
+{
+   if (a->priority != b->priority)
+      return a->priority > b->priority;
+
+   TickType_t now = xTaskGetTickCount();
+   TickType_t aLeft = pdMS_TO_TICKS(a->deadlineMS) - (now - a->submitTime);
+   TickType_t bLeft = pdMS_TO_TICKS(b->deadlineMS) - (now - b->submitTime);
+   if (aLeft != bLeft)
+      return (int32_t) aLeft < (int32_t) bLeft;
+
+   return (int32_t) (a->order - b->order) < 0;
+}
+
+// ********************************************************************************************
+
+// sends the command and copies the response out of the ring
+static int brokerRunRequest(UartRequest *request)
+{
+   if (request->operation != NULL)
+      return request->operation(request) ?
+         UART_REQUEST_DONE : UART_REQUEST_FAILED;
+
+   UartFrame frame;
+   UartResult result;
+   bool_t success = uartTransaction(request->type, request->payload,
+      request->length, &frame, request->waitTimeMS, request->retries, &result);
+
+   if (success)
+   {
+      request->responseLength = frame.length;
+      if (request->response != NULL)
+         uartFrameRead(&frame, 0, request->response, request->responseSize);
+
+      uartFrameRelease(&frame);
+   }
+
+   // the monitor may use the link, so the ring must be free by now
+   if (linkMonitor != NULL)
+      linkMonitor(result);
+
+   return success ? UART_REQUEST_DONE : UART_REQUEST_FAILED;
+}
+
+// ********************************************************************************************
+
+/**
+ * the owner may return (and drop the request) as soon as it sees
+ * the new state, so nothing is read from the request after that
+ */
+static void brokerComplete(UartRequest *request, int state)
+{
+   TaskHandle_t owner = request->owner;
+   atomic_store(&request->state, state);
+
+   // requests with a callback are kept alive until it is called
+   if (request->callback != NULL)
+      request->callback(request, request->param);
+   else if (owner != NULL)
+      xTaskNotifyGive(owner);
+}
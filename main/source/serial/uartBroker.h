@@ -0,0 +1,104 @@
+#ifndef __uartBroker_H__
+#define __uartBroker_H__
+
+#include <stdatomic.h>
+#include "os_port.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "uartHelper.h"
+
+// maximum number of requests waiting for the broker
+#define UART_BROKER_QUEUE_LEN 8
+
+typedef enum
+{
+   UART_PRIORITY_LOW,    // background work (e.g. sampling)
+   UART_PRIORITY_NORMAL, // bulk transfers (e.g. camera chunks)
+   UART_PRIORITY_HIGH    // short interactive requests
+} UartPriority;
+
+typedef enum
+{
+   UART_REQUEST_IDLE,    // not submitted yet
+   UART_REQUEST_PENDING,
+   UART_REQUEST_DONE,
+   UART_REQUEST_FAILED,  // k210 didn't answer properly
+   UART_REQUEST_EXPIRED  // deadline passed before the request was started
+} UartRequestState;
+
+typedef struct _UartRequest UartRequest;
+
+// called from the broker task when a request is complete
+typedef void (*UartCallback)(UartRequest *request, void *param);
+
+/**
+ * runs on the broker task in place of the command, with the link
+ * to itself (e.g. to change the baud rate between transactions)
+ */
+typedef bool_t (*UartOperation)(UartRequest *request);
+
+// told about the outcome of every command the broker runs
+typedef void (*UartMonitor)(UartResult result);
+
+/**
+ * a command for the k210 and the place to store its response.
+ * the request must stay alive until it is complete.
+ */
+struct _UartRequest
+{
+   // set by the caller (see uartRequestInit for the defaults)
+   uint8_t type;
+   const void *payload;
+   size_t length;
+   uint8_t *response;     // response payload is copied here
+   size_t responseSize;
+   UartPriority priority;
+   uint_t deadlineMS;     // time the request may wait in the queue
+   uint_t waitTimeMS;     // time to wait for the response
+   uint_t retries;
+   UartCallback callback; // optional, replaces the notification
+   UartOperation operation; // optional, replaces the command
+   void *param;
+
+   // set by the broker
+   TaskHandle_t owner;
+   TickType_t submitTime;
+   uint32_t order;
+   size_t responseLength; // full length, may exceed responseSize
+   atomic_int state;
+};
+
+// ********************************************************************************************
+
+/**
+ * starts the broker task that owns the uart link.
+ * this function should be called once after serialInit.
+ */
+void uartBrokerInit();
+
+void uartRequestInit(UartRequest *request, uint8_t type,
+   const void *payload, size_t length, uint8_t *response, size_t responseSize);
+
+/**
+ * queues a request without waiting for it. the highest priority
+ * request is started first, then the one with the earliest deadline.
+ * returns FALSE (and fails the request) if the queue is full.
+ */
+bool_t uartBrokerSubmit(UartRequest *request);
+
+/**
+ * blocks until a submitted request (without a callback) is complete.
+ * returns TRUE if the response was recieved.
+ */
+bool_t uartBrokerWait(UartRequest *request);
+
+// submit and wait
+bool_t uartBrokerExecute(UartRequest *request);
+
+/**
+ * installs the link monitor (see linkSpeed.h), it is called
+ * on the broker task and may run transactions of its own
+ */
+void uartBrokerSetMonitor(UartMonitor monitor);
+
+#endif
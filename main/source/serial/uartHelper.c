@@ -1,18 +1,23 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdatomic.h>
 #include "uartHelper.h"
 #include "driver/gpio.h"
 #include "driver/uart.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
+#include "esp_rom_crc.h"
 #include "esp_log.h"
+#include "cpu_endian.h"
 
-// this size will be actually allocated and used as the serial buffer:
-// **! make sure you have enough free memory. if not, change the BUFFER_SIZE !**
-#define ACTUAL_BUF_SIZE (BUFFER_SIZE + 1024)
+// ring indices are free-running and wrapped with this mask
+#define RING_MASK (UART_RING_SIZE - 1)
+
+#if (UART_RING_SIZE & RING_MASK) != 0
+   #error UART_RING_SIZE must be a power of two
+#endif
 
 #define LOG_TAG "UART"
 
@@ -34,37 +39,76 @@ static QueueHandle_t myQueue;
 #define WAIT_FOR_EVENT_TICKS (WAIT_FOR_EVENT_MS / portTICK_PERIOD_MS)
 #define WAIT_FOR_DATA_TICKS (WAIT_FOR_DATA_MS / portTICK_PERIOD_MS)
 
-// ********************************************************************************************
-// Global Variables
+// time given to the rest of a damaged frame to arrive before retrying
+#define RETRY_DELAY_MS 20
 
-// this will point to the beginning of the allocated buffer:
-uint8_t* buffer;
+// rounds up so that a wait never ends before the requested time
+#define MS_TO_TICKS_CEIL(ms) \
+   (((ms) + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS)
 
-// this will show the number of bytes recieved by the UART event handler:
-size_t in_buf_len = 0;
+// ********************************************************************************************
+// Global Variables
 
 /**
- * every function that wants to use the UART serial communication,
- * must acquire this lock and release it after the process is done.
+ * single-producer/single-consumer ring buffer for recieved data.
  * 
- * remember to release the lock in case of process termination due to errors!
+ * head is only advanced by the serial event task (producer) and
+ * tail is only advanced by the broker task (consumer), so no lock
+ * is needed between them. both indices are free-running:
+ * (head - tail) is the number of bytes waiting in the ring.
  */
-SemaphoreHandle_t mutexLock;
+static uint8_t* ring;
+static atomic_size_t ringHead = 0;
+static atomic_size_t ringTail = 0;
+
+/**
+ * consumer waiting for data registers itself here and sleeps
+ * on its task notification. the producer wakes it up as soon as
+ * the ring holds (waitThreshold) bytes instead of being polled.
+ */
+static _Atomic(TaskHandle_t) waitingTask = NULL;
+static atomic_size_t waitThreshold = 0;
+
+// sequence number of the next frame sent to the k210
+static uint8_t txSeq = 0;
 
 // ********************************************************************************************
 // forward declaration of functions
 
 void serialInit();
 void serialEventTask(void *pvParameters);
-bool_t uartAcquire(uint_t waitTimeMS);
-void uartRelease();
+static void ringWrite(size_t length);
+static void ringNotify(size_t head);
+static bool_t ringWaitFor(size_t chunkSize,
+   TimeOut_t *timeOut, TickType_t *ticksToWait);
 void uartClearBuffer();
-uint8_t* uartReadBytesSync(size_t chunkSize, uint_t waitTimeMS);
-size_t uartGetBufLength();
-uint8_t* uartGetBuffer();
+size_t uartRingAvailable();
+size_t uartRingPeek(size_t offset, const uint8_t **span);
+void uartRingCopy(size_t offset, void *dest, size_t length);
+void uartRingCommit(size_t length);
 void uartSendBytes(const void* data, size_t size);
 void uartSendString(const char_t* str);
+uint32_t uartGetBaudRate();
+void uartSetBaudRate(uint32_t baudRate);
 bool_t waitForBuffer(size_t chunkSize, uint_t waitTimeMS);
+static uint32_t uartFrameCrc(const uint8_t *header,
+   size_t payloadOffset, size_t length);
+void uartSendFrame(uint8_t type, uint8_t seq,
+   const void *payload, size_t length);
+bool_t uartReceiveFrame(UartFrame *frame, uint_t waitTimeMS, UartResult *result);
+static bool_t receiveFrameHelper(UartFrame *frame,
+   TimeOut_t *timeOut, TickType_t *ticksToWait, UartResult *result);
+size_t uartFramePeek(const UartFrame *frame,
+   size_t offset, const uint8_t **span);
+size_t uartFrameRead(const UartFrame *frame,
+   size_t offset, void *dest, size_t length);
+void uartFrameRelease(const UartFrame *frame);
+uint8_t uartSendCommand(uint8_t type, const void *payload, size_t length);
+bool_t uartReceiveResponse(uint8_t type, uint8_t seq,
+   UartFrame *response, uint_t waitTimeMS, UartResult *result);
+bool_t uartTransaction(uint8_t type, const void *payload, size_t length,
+   UartFrame *response, uint_t waitTimeMS, uint_t retries, UartResult *result);
+static bool_t setResult(UartResult *result, UartResult value);
 
 // ********************************************************************************************
 // UART initialization
@@ -74,7 +118,7 @@ void serialInit()
 	ESP_LOGI(LOG_TAG, "initializing serial communication!");
 
    uart_config_t uartConfig = {
-		.baud_rate = 921600 ,
+		.baud_rate = UART_BASE_BAUD_RATE,
 		.data_bits = UART_DATA_8_BITS,
 		.parity    = UART_PARITY_DISABLE,
 		.stop_bits = UART_STOP_BITS_1,
@@ -98,6 +142,13 @@ void serialInit()
 
    uart_pattern_queue_reset(MY_UART, 20);
 
+   // allocating the ring buffer before the producer starts
+   ring = (uint8_t*) malloc(UART_RING_SIZE);
+   if (ring == NULL)
+      ESP_LOGE(LOG_TAG, "couldn't allocate Buffer Memory");
+   else
+      ESP_LOGI(LOG_TAG, "Buffer Memory allocated successfully!");
+
    // initialize Serial Event Task
    BaseType_t ret = xTaskCreatePinnedToCore(
       serialEventTask, "serialEventTask", 2048, NULL, 12, NULL, 1
@@ -105,9 +156,6 @@ void serialInit()
    if(ret != pdPASS) { // error check
       ESP_LOGE(LOG_TAG, "failed to create serial event task!");
    }
-
-   mutexLock = xSemaphoreCreateMutex();
-   xSemaphoreGive(mutexLock);
 }
 
 // ********************************************************************************************
@@ -119,13 +167,6 @@ void serialEventTask(void *pvParameters)
    ESP_LOGI(LOG_TAG, "starting serial task on Core: %d", xPortGetCoreID());
    ESP_LOGI(LOG_TAG, "Free Heap Size: %dkb", xPortGetFreeHeapSize()/1024);
 
-   // allocating the serial buffer
-   buffer = (uint8_t*) malloc(ACTUAL_BUF_SIZE);
-   if (buffer == NULL)
-      ESP_LOGE(LOG_TAG, "couldn't allocate Buffer Memory");
-   else
-      ESP_LOGI(LOG_TAG, "Buffer Memory allocated successfully!");
-
    uart_event_t event;
    size_t buffered_size;
 
@@ -135,9 +176,7 @@ void serialEventTask(void *pvParameters)
          switch(event.type)
          {
             case UART_DATA:
-               uart_read_bytes(
-                  MY_UART, buffer+in_buf_len, event.size, WAIT_FOR_DATA_TICKS);
-               in_buf_len += event.size;
+               ringWrite(event.size);
                break;
             // **************************************************
             case UART_FIFO_OVF:
@@ -179,46 +218,132 @@ void serialEventTask(void *pvParameters)
       }
    }
 
-   free(buffer);
-   buffer = NULL;
    vTaskDelete(NULL);
 }
 
 // ********************************************************************************************
-// resource lock
 
-bool_t uartAcquire(uint_t waitTimeMS)
+/**
+ * moves (length) bytes from the uart driver into the ring.
+ * (called only by the serial event task)
+ * 
+ * if the consumer falls behind and the ring gets full,
+ * the rest of the data is dropped. broken frames will be
+ * detected by their crc and requested again.
+ */
+static void ringWrite(size_t length)
 {
-   TickType_t waitTicks = waitTimeMS / portTICK_PERIOD_MS;
-   return xSemaphoreTake(mutexLock, waitTicks) == pdTRUE;
+   size_t head = atomic_load_explicit(&ringHead, memory_order_relaxed);
+   size_t tail = atomic_load_explicit(&ringTail, memory_order_acquire);
+
+   while (length > 0)
+   {
+      size_t space = UART_RING_SIZE - (head - tail);
+      size_t contiguous = UART_RING_SIZE - (head & RING_MASK);
+      size_t n = length;
+      if (n > space) n = space;
+      if (n > contiguous) n = contiguous;
+
+      if (n == 0)
+      {
+         ESP_LOGE(LOG_TAG, "ring buffer full, dropped %d bytes", length);
+         uart_flush_input(MY_UART);
+         return;
+      }
+
+      int res = uart_read_bytes(
+         MY_UART, ring + (head & RING_MASK), n, WAIT_FOR_DATA_TICKS);
+      if (res <= 0) return;
+
+      head += res;
+      length -= res;
+      atomic_store_explicit(&ringHead, head, memory_order_release);
+      ringNotify(head);
+   }
 }
 
-void uartRelease() { xSemaphoreGive(mutexLock); }
+// ********************************************************************************************
+
+// wakes up the waiting consumer if its threshold is reached
+static void ringNotify(size_t head)
+{
+   if (atomic_load_explicit(&waitingTask, memory_order_acquire) == NULL)
+      return;
+
+   size_t tail = atomic_load_explicit(&ringTail, memory_order_acquire);
+   size_t threshold = atomic_load_explicit(&waitThreshold, memory_order_relaxed);
+   if (head - tail < threshold)
+      return;
+
+   TaskHandle_t task = atomic_exchange(&waitingTask, NULL);
+   if (task != NULL)
+      xTaskNotifyGive(task);
+}
 
 // ********************************************************************************************
 
-void uartClearBuffer() { in_buf_len = 0; }
+// ring consumer api (must be called only by the uart broker task)
+
+// discard all the data recieved so far
+void uartClearBuffer()
+{
+   size_t head = atomic_load_explicit(&ringHead, memory_order_acquire);
+   atomic_store_explicit(&ringTail, head, memory_order_release);
+}
+
+// number of bytes waiting in the ring
+size_t uartRingAvailable()
+{
+   size_t head = atomic_load_explicit(&ringHead, memory_order_acquire);
+   size_t tail = atomic_load_explicit(&ringTail, memory_order_relaxed);
+   return head - tail;
+}
 
 /**
- * waits until the size of the recieved data in the buffer
- * matches the chunkSize parameter and returns a pointer
- * to the begining of the buffer.
- * 
- * if filling the buffer takes longer than waitTimeMS,
- * function will return a Null value indicating failure.
+ * zero-copy access to the recieved data:
+ * points span at the byte (offset) bytes after the tail and returns
+ * how many bytes can be read there contiguously (without wrapping).
  * 
- * don't free the buffer retuned by this function!
+ * data stays valid until it is committed.
  */
-uint8_t* uartReadBytesSync(size_t chunkSize, uint_t waitTimeMS)
+size_t uartRingPeek(size_t offset, const uint8_t **span)
 {
-   if (waitForBuffer(chunkSize, waitTimeMS))
-      return buffer;
+   size_t available = uartRingAvailable();
+   if (offset >= available) return 0;
 
-   return NULL;
+   size_t tail = atomic_load_explicit(&ringTail, memory_order_relaxed);
+   size_t index = (tail + offset) & RING_MASK;
+   size_t contiguous = UART_RING_SIZE - index;
+
+   *span = ring + index;
+   available -= offset;
+   return available < contiguous ? available : contiguous;
 }
 
-size_t uartGetBufLength() { return in_buf_len; }
-uint8_t* uartGetBuffer() { return buffer; }
+// copies data out of the ring (caller makes sure it is available)
+void uartRingCopy(size_t offset, void *dest, size_t length)
+{
+   uint8_t *p = (uint8_t*) dest;
+   while (length > 0)
+   {
+      const uint8_t *span;
+      size_t n = uartRingPeek(offset, &span);
+      if (n == 0) return;
+      if (n > length) n = length;
+
+      memcpy(p, span, n);
+      p += n;
+      offset += n;
+      length -= n;
+   }
+}
+
+// releases (length) bytes back to the producer
+void uartRingCommit(size_t length)
+{
+   size_t tail = atomic_load_explicit(&ringTail, memory_order_relaxed);
+   atomic_store_explicit(&ringTail, tail + length, memory_order_release);
+}
 
 // ********************************************************************************************
 
@@ -234,28 +359,342 @@ void uartSendString(const char_t* str)
    uart_write_bytes(MY_UART, str, strlen(str));
 }
 
+// current line speed of the k210 link
+uint32_t uartGetBaudRate()
+{
+   uint32_t baudRate = 0;
+   uart_get_baudrate(MY_UART, &baudRate);
+   return baudRate;
+}
+
+// changes the line speed, whatever was recieved so far is dropped
+void uartSetBaudRate(uint32_t baudRate)
+{
+   uart_wait_tx_done(MY_UART, WAIT_FOR_DATA_TICKS);
+   uart_set_baudrate(MY_UART, baudRate);
+   uart_flush_input(MY_UART);
+   uartClearBuffer();
+}
+
 // ********************************************************************************************
 
 /**
- * waits until the size of the recieved data in the buffer
- * matches the chunkSize parameter and returns a TRUE value
- * indicating success.
+ * waits until at least (chunkSize) bytes are waiting in the ring
+ * and returns a TRUE value indicating success.
  * 
  * if filling the buffer takes longer than waitTimeMS,
  * function will return a FALSE value indicating failure.
  */
 bool_t waitForBuffer(size_t chunkSize, uint_t waitTimeMS)
 {
-   uint_t counter = 0;
-   uint_t waitCount = waitTimeMS / portTICK_PERIOD_MS;
+   TimeOut_t timeOut;
+   TickType_t ticksToWait = MS_TO_TICKS_CEIL(waitTimeMS);
 
-   while (in_buf_len < chunkSize)
+   vTaskSetTimeOutState(&timeOut);
+   return ringWaitFor(chunkSize, &timeOut, &ticksToWait);
+}
+
+// ********************************************************************************************
+
+/**
+ * blocks on the task notification until the producer reports
+ * (chunkSize) bytes in the ring or the timeout expires.
+ * 
+ * timeOut/ticksToWait carry the remaining time, so several waits
+ * can share one deadline (see uartReceiveFrame).
+ */
+static bool_t ringWaitFor(size_t chunkSize,
+   TimeOut_t *timeOut, TickType_t *ticksToWait)
+{
+   while (uartRingAvailable() < chunkSize)
    {
-      if (waitCount < counter)
+      if (xTaskCheckForTimeOut(timeOut, ticksToWait) == pdTRUE)
          return FALSE;
 
-      counter += 1;
-      vTaskDelay(1);
+      // register, then check again so that no wake-up gets lost
+      atomic_store_explicit(&waitThreshold, chunkSize, memory_order_relaxed);
+      atomic_store_explicit(&waitingTask,
+         xTaskGetCurrentTaskHandle(), memory_order_release);
+
+      if (uartRingAvailable() < chunkSize)
+         ulTaskNotifyTake(pdTRUE, *ticksToWait);
+
+      atomic_store_explicit(&waitingTask, NULL, memory_order_release);
    }
    return TRUE;
 }
+
+// ********************************************************************************************
+// framed communication
+
+/**
+ * computes the crc32 of a frame (payload is read from the ring).
+ * start of frame byte is not covered by the crc!
+ */
+static uint32_t uartFrameCrc(const uint8_t *header,
+   size_t payloadOffset, size_t length)
+{
+   uint32_t crc = esp_rom_crc32_le(
+      0, header + 1, UART_FRAME_HEADER_SIZE - 1);
+
+   while (length > 0)
+   {
+      const uint8_t *span;
+      size_t n = uartRingPeek(payloadOffset, &span);
+      if (n > length) n = length;
+
+      crc = esp_rom_crc32_le(crc, span, n);
+      payloadOffset += n;
+      length -= n;
+   }
+   return crc;
+}
+
+// ********************************************************************************************
+
+/**
+ * wraps the payload in a frame (header + crc)
+ * and sends it over the uart
+ */
+void uartSendFrame(uint8_t type, uint8_t seq,
+   const void *payload, size_t length)
+{
+   uint8_t header[UART_FRAME_HEADER_SIZE];
+   uint8_t crc[UART_FRAME_CRC_SIZE];
+
+   header[0] = UART_FRAME_SOF;
+   header[1] = type;
+   header[2] = seq;
+   STORE16LE(length, header + 3);
+
+   uint32_t value = esp_rom_crc32_le(
+      0, header + 1, UART_FRAME_HEADER_SIZE - 1);
+   value = esp_rom_crc32_le(value, payload, length);
+   STORE32LE(value, crc);
+
+   uart_write_bytes(MY_UART, header, UART_FRAME_HEADER_SIZE);
+   if (length > 0)
+      uart_write_bytes(MY_UART, payload, length);
+   uart_write_bytes(MY_UART, crc, UART_FRAME_CRC_SIZE);
+}
+
+// ********************************************************************************************
+
+/**
+ * waits for a complete frame to arrive at the tail of the ring
+ * and validates it. stray bytes in front of the start of frame
+ * are dropped.
+ * 
+ * on success, the frame stays in the ring and its payload can be
+ * accessed with uartFramePeek/uartFrameRead until it is released.
+ * 
+ * returns FALSE if the whole frame doesn't arrive
+ * within waitTimeMS or if the frame is corrupted,
+ * (result) tells which one (may be NULL).
+ * a corrupted frame only gives its start of frame byte back (the
+ * bad length or crc may come from a stray one), so the next call
+ * picks the search up right behind it.
+ */
+bool_t uartReceiveFrame(UartFrame *frame, uint_t waitTimeMS, UartResult *result)
+{
+   TimeOut_t timeOut;
+   TickType_t ticksToWait = MS_TO_TICKS_CEIL(waitTimeMS);
+   vTaskSetTimeOutState(&timeOut);
+
+   return receiveFrameHelper(frame, &timeOut, &ticksToWait, result);
+}
+
+// uartReceiveFrame with a deadline that several frames can share
+static bool_t receiveFrameHelper(UartFrame *frame,
+   TimeOut_t *timeOut, TickType_t *ticksToWait, UartResult *result)
+{
+   uint8_t header[UART_FRAME_HEADER_SIZE];
+   const uint8_t *span;
+
+   // look for the start of frame
+   while (TRUE)
+   {
+      if (!ringWaitFor(UART_FRAME_HEADER_SIZE, timeOut, ticksToWait))
+         return setResult(result, UART_RESULT_TIMEOUT);
+
+      uartRingPeek(0, &span);
+      if (*span == UART_FRAME_SOF)
+         break;
+
+      uartRingCommit(1);
+   }
+
+   uartRingCopy(0, header, UART_FRAME_HEADER_SIZE);
+   uint16_t length = LOAD16LE(header + 3);
+   if (length > UART_FRAME_MAX_PAYLOAD)
+   {
+      ESP_LOGE(LOG_TAG, "invalid frame length %d", length);
+      uartRingCommit(1);
+      return setResult(result, UART_RESULT_CORRUPT);
+   }
+
+   size_t frameSize = UART_FRAME_OVERHEAD + length;
+   if (!ringWaitFor(frameSize, timeOut, ticksToWait))
+      return setResult(result, UART_RESULT_TIMEOUT);
+
+   uint8_t crc[UART_FRAME_CRC_SIZE];
+   uartRingCopy(UART_FRAME_HEADER_SIZE + length, crc, UART_FRAME_CRC_SIZE);
+   if (LOAD32LE(crc) != uartFrameCrc(header, UART_FRAME_HEADER_SIZE, length))
+   {
+      ESP_LOGE(LOG_TAG, "frame crc mismatch");
+      uartRingCommit(1);
+      return setResult(result, UART_RESULT_CORRUPT);
+   }
+
+   frame->type = header[1];
+   frame->seq = header[2];
+   frame->length = length;
+   return setResult(result, UART_RESULT_OK);
+}
+
+// stores (value) if (result) is given, returns TRUE for UART_RESULT_OK
+static bool_t setResult(UartResult *result, UartResult value)
+{
+   if (result != NULL)
+      *result = value;
+   return value == UART_RESULT_OK;
+}
+
+// ********************************************************************************************
+
+/**
+ * zero-copy access to the payload of a recieved frame
+ * (see uartRingPeek). returns the number of contiguous bytes.
+ */
+size_t uartFramePeek(const UartFrame *frame,
+   size_t offset, const uint8_t **span)
+{
+   if (offset >= frame->length) return 0;
+
+   size_t n = uartRingPeek(UART_FRAME_HEADER_SIZE + offset, span);
+   if (n > frame->length - offset)
+      n = frame->length - offset;
+   return n;
+}
+
+// copies up to (length) bytes of the payload and returns the copied size
+size_t uartFrameRead(const UartFrame *frame,
+   size_t offset, void *dest, size_t length)
+{
+   if (offset >= frame->length) return 0;
+   if (length > frame->length - offset)
+      length = frame->length - offset;
+
+   uartRingCopy(UART_FRAME_HEADER_SIZE + offset, dest, length);
+   return length;
+}
+
+// removes the frame from the ring when the payload is no longer needed
+void uartFrameRelease(const UartFrame *frame)
+{
+   uartRingCommit(UART_FRAME_OVERHEAD + frame->length);
+}
+
+// ********************************************************************************************
+
+/**
+ * sends a command frame to the k210 without waiting for the response
+ * and returns its sequence number (see uartReceiveResponse).
+ * 
+ * unlike uartTransaction, the ring is not cleared, so a command
+ * can be issued while the previous response is still being used.
+ */
+uint8_t uartSendCommand(uint8_t type, const void *payload, size_t length)
+{
+   uint8_t seq = txSeq++;
+   uartSendFrame(type, seq, payload, length);
+   return seq;
+}
+
+// ********************************************************************************************
+
+/**
+ * waits for the response to the command sent with (seq).
+ * 
+ * on success the response stays in the ring
+ * and must be released with uartFrameRelease.
+ * a nack for a command the k210 got corrupted counts as
+ * UART_RESULT_CORRUPT in (result).
+ * 
+ * frames of other sequence numbers are late answers to earlier
+ * attempts, they are dropped and the wait goes on for the rest
+ * of waitTimeMS. a crc nack counts whatever its sequence number,
+ * the k210 took it from the corrupted frame.
+ */
+bool_t uartReceiveResponse(uint8_t type, uint8_t seq,
+   UartFrame *response, uint_t waitTimeMS, UartResult *result)
+{
+   TimeOut_t timeOut;
+   TickType_t ticksToWait = MS_TO_TICKS_CEIL(waitTimeMS);
+   vTaskSetTimeOutState(&timeOut);
+
+   while (receiveFrameHelper(response, &timeOut, &ticksToWait, result))
+   {
+      if (response->seq == seq && response->type == K210_RESPONSE(type))
+         return TRUE;
+
+      uint8_t error = 0;
+      bool_t nack = response->type == K210_RSP_NACK &&
+         uartFrameRead(response, 0, &error, 1);
+
+      if (response->seq != seq && !(nack && error == K210_ERR_CRC))
+      {
+         ESP_LOGI(LOG_TAG, "dropped stale response 0x%02X (seq %d)",
+            response->type, response->seq);
+         uartFrameRelease(response);
+         continue;
+      }
+
+      UartResult value = UART_RESULT_UNEXPECTED;
+      if (nack)
+      {
+         ESP_LOGE(LOG_TAG, "k210 rejected command 0x%02X (error %d)",
+            type, error);
+         value = error == K210_ERR_CRC ? UART_RESULT_CORRUPT : UART_RESULT_NACK;
+      }
+      else
+         ESP_LOGE(LOG_TAG, "unexpected response 0x%02X (seq %d)",
+            response->type, response->seq);
+
+      uartFrameRelease(response);
+      return setResult(result, value);
+   }
+
+   return FALSE;
+}
+
+// ********************************************************************************************
+
+/**
+ * sends a command frame to the k210 and waits for its response.
+ * the exchange is repeated up to (retries) more times if the
+ * response is missing, corrupted, of another command or a NACK.
+ * 
+ * on success the response stays in the ring
+ * and must be released with uartFrameRelease.
+ * (result), if given, tells why the last attempt failed.
+ */
+bool_t uartTransaction(uint8_t type, const void *payload, size_t length,
+   UartFrame *response, uint_t waitTimeMS, uint_t retries, UartResult *result)
+{
+   for (uint_t attempt = 0; attempt <= retries; attempt++)
+   {
+      uartClearBuffer();
+      uint8_t seq = uartSendCommand(type, payload, length);
+
+      if (uartReceiveResponse(type, seq, response, waitTimeMS, result))
+         return TRUE;
+
+      ESP_LOGI(LOG_TAG, "command 0x%02X failed (attempt %d)",
+         type, attempt + 1);
+      vTaskDelay(RETRY_DELAY_MS / portTICK_PERIOD_MS);
+   }
+
+   uartClearBuffer();
+   return FALSE;
+}
@@ -3,8 +3,125 @@
 
 #include "os_port.h"
 
-// size of the buffer in bytes to store recieved data
-#define BUFFER_SIZE 39000
+// size of the ring buffer in bytes to store recieved data
+// (must be a power of two and hold at least one full frame)
+#define UART_RING_SIZE 16384
+
+// line speed of the k210 link after reset (see linkSpeed.h)
+#define UART_BASE_BAUD_RATE 921600
+
+// ********************************************************************************************
+// k210 link protocol
+
+/**
+ * every message on the esp32 <-> k210 link is a binary frame:
+ *
+ * | SOF | type | seq | length (LE) | payload ... | crc32 (LE) |
+ * |  1  |  1   |  1  |      2      |   length    |     4      |
+ *
+ * crc32 is the standard (zlib) crc computed over type, seq,
+ * length and payload. responses carry the seq of the request
+ * and their type is the request type with the MSB set.
+ */
+#define UART_FRAME_SOF 0xA5
+#define UART_FRAME_HEADER_SIZE 5
+#define UART_FRAME_CRC_SIZE 4
+#define UART_FRAME_OVERHEAD (UART_FRAME_HEADER_SIZE + UART_FRAME_CRC_SIZE)
+#define UART_FRAME_MAX_PAYLOAD 4100
+
+#define K210_RESPONSE(type) ((type) | 0x80)
+
+// commands sent to the k210
+#define K210_CMD_PING        0x01
+#define K210_CMD_LINK_SPEED  0x02
+#define K210_CMD_LINK_COMMIT 0x03
+#define K210_CMD_CAM_CAPTURE 0x10
+#define K210_CMD_CAM_CHUNK   0x11
+#define K210_CMD_CAM_ROI     0x12
+#define K210_CMD_AI_READ     0x20
+#define K210_CMD_AI_SEND     0x21
+#define K210_CMD_AI_REREAD   0x22
+#define K210_CMD_CONFIG      0x30
+
+// negative acknowledgement (payload is one of the K210_ERR_* codes)
+#define K210_RSP_NACK 0xFF
+
+#define K210_ERR_CRC     0x01
+#define K210_ERR_UNKNOWN 0x02
+#define K210_ERR_ARGS    0x03
+
+// frame encodings for K210_CMD_CAM_CAPTURE (see k210/frameCodec.py)
+#define K210_CODEC_RAW  0x00
+#define K210_CODEC_RLE  0x01
+#define K210_CODEC_JPEG 0x02
+#define K210_CODEC_GRAY4 0x03
+
+/**
+ * K210_CODEC_GRAY4 stream: | width (u16) | height (u16) | pixels |
+ * 4 bits per pixel, the left one of two in the high nibble (rows of
+ * odd width end with a zero nibble). meant for small previews.
+ */
+#define K210_GRAY4_HEADER_SIZE 4
+
+// flags for K210_CMD_CAM_ROI
+#define K210_ROI_WITH_CROPS 0x01
+
+/**
+ * K210_CMD_AI_SEND response, the digits follow the header:
+ * | frame (u32) | confidence (u16, per mille) | age (u16, ms) |
+ * | inferred (u32) | skipped (u32) | digits | probabilities |
+ * there is one probability byte (255 = 1) per digit, older k210
+ * scripts end the response after the digits. frame counts the
+ * inferences since boot (0 = nothing infered yet) and age is the
+ * time since the inference was finished.
+ * inferred and skipped count the digits since boot that went through
+ * the model and the ones whose window didn't change (cached prediction).
+ */
+#define K210_AI_RESULT_HEADER_SIZE 16
+
+/**
+ * K210_CMD_AI_REREAD carries the indexes of the digits to infer
+ * again (one byte each) on a new snapshot, the response holds the
+ * digit (ascii) and its probability byte for each index
+ */
+#define K210_AI_REREAD_ENTRY_SIZE 2
+
+// side of the preprocessed (binarized) digit crops fed to the model
+#define K210_ROI_CROP_SIZE 28
+
+// camera image is transferred in chunks of this size
+// (each chunk is validated and retried on its own)
+#define K210_CAM_CHUNK_SIZE 4096
+
+typedef struct _UartFrame UartFrame;
+
+/**
+ * a validated frame waiting at the tail of the uart ring.
+ * payload is accessed with uartFramePeek/uartFrameRead
+ * and the frame must be released when it is no longer needed.
+ */
+struct _UartFrame
+{
+   uint8_t type;
+   uint8_t seq;
+   uint16_t length;
+};
+
+/**
+ * why a framed exchange failed. only corrupted frames point at the
+ * link itself, the others come from a k210 that is busy, rebooting
+ * or refusing the command (see linkSpeed.c)
+ */
+typedef enum
+{
+   UART_RESULT_OK,
+   UART_RESULT_NACK,       // the k210 rejected the command
+   UART_RESULT_UNEXPECTED, // an intact frame of another command
+   UART_RESULT_TIMEOUT,    // the (whole) response didn't arrive in time
+   UART_RESULT_CORRUPT     // crc or framing error on either side
+} UartResult;
+
+// ********************************************************************************************
 
 /**
  * configure uart and intialize event task
@@ -13,25 +130,50 @@
 void serialInit();
 
 /**
- * every function that needs to use uart must
- * accuire the recource and release it when done
+ * the functions below are used by the broker task that owns the
+ * link (see uartBroker.h), other tasks must go through the broker
  */
-bool_t uartAcquire(uint_t waitTimeMS);
-void uartRelease();
 
 // clear old buffer and get ready to recieve new data
 void uartClearBuffer();
 
-// recieves (chunkSize) bytes of data
-uint8_t* uartReadBytesSync(size_t chunkSize, uint_t waitTimeMS);
+// waits until (chunkSize) bytes are waiting in the ring
 bool_t waitForBuffer(size_t chunkSize, uint_t waitTimeMS);
 
+// zero-copy ring consumer api
+size_t uartRingAvailable();
+size_t uartRingPeek(size_t offset, const uint8_t **span);
+void uartRingCopy(size_t offset, void *dest, size_t length);
+void uartRingCommit(size_t length);
+
 // send data
 void uartSendBytes(const void* data, size_t size);
 void uartSendString(const char_t* str);
 
-// getter functions
-uint8_t* uartGetBuffer();
-size_t uartGetBufLength();
+uint32_t uartGetBaudRate();
+void uartSetBaudRate(uint32_t baudRate);
+
+// framed communication
+void uartSendFrame(uint8_t type, uint8_t seq,
+   const void *payload, size_t length);
+
+bool_t uartReceiveFrame(UartFrame *frame, uint_t waitTimeMS, UartResult *result);
+
+size_t uartFramePeek(const UartFrame *frame,
+   size_t offset, const uint8_t **span);
+
+size_t uartFrameRead(const UartFrame *frame,
+   size_t offset, void *dest, size_t length);
+
+void uartFrameRelease(const UartFrame *frame);
+
+// pipelined commands (send now, collect the response later)
+uint8_t uartSendCommand(uint8_t type, const void *payload, size_t length);
+
+bool_t uartReceiveResponse(uint8_t type, uint8_t seq,
+   UartFrame *response, uint_t waitTimeMS, UartResult *result);
+
+bool_t uartTransaction(uint8_t type, const void *payload, size_t length,
+   UartFrame *response, uint_t waitTimeMS, uint_t retries, UartResult *result);
 
-#endif
\ No newline at end of file
+#endif
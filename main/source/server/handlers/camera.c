@@ -3,31 +3,101 @@
 #include <string.h>
 #include "handlers.h"
 #include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/camera/frameCache.h"
+#include "source/camera/digitWindows.h"
 #include "source/server/httpHelper.h"
 #include "source/appEnv.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 
 static const char_t *LOG_TAG = "camera";
 
-// number of bytes to expect when requesing image
-static const size_t TOTAL_SIZE = 76800;
+// default jpeg quality when the client doesn't ask for one
+#define DEFAULT_JPEG_QUALITY 70
+
+// formats the image can be served in
+typedef enum
+{
+   CAMERA_FORMAT_HEX, // base16 text (2 characters per pixel)
+   CAMERA_FORMAT_RAW, // raw grayscale bytes
+   CAMERA_FORMAT_PGM  // binary pgm (raw bytes with a width/height header)
+} CameraFormat;
+
+typedef struct _TransferTiming TransferTiming;
+
+// timing instrumentation of a camera transfer (in microseconds)
+struct _TransferTiming
+{
+   int64_t start;
+   int64_t uartWait;
+   int64_t tcpWrite;
+};
 
 // ********************************************************************************************
 // forward declaration of functions
 
 error_t cameraImgHandler(HttpConnection *connection);
-error_t getAndSendCameraImg(HttpConnection *connection);
-error_t sendChunk(HttpConnection *connection);
-size_t findChunkSize(size_t size_count);
+CameraFormat getCameraFormat(HttpConnection *connection);
+uint8_t getCameraCodec(HttpConnection *connection, uint8_t *quality);
+uint_t getCameraMaxAge(HttpConnection *connection);
+uint8_t getCameraScale(HttpConnection *connection, uint8_t *codec);
+error_t captureAndSendCameraImg(HttpConnection *connection,
+   CameraFormat format, uint8_t codec, uint8_t quality, uint8_t scale);
+error_t sendCachedCameraImg(HttpConnection *connection,
+   CameraFrame *frame, CameraFormat format);
+error_t cameraRoiHandler(HttpConnection *connection);
+error_t cameraDigitsHandler(HttpConnection *connection);
+error_t sendCameraHeader(HttpConnection *connection,
+   CameraFormat format, const CameraImage *image);
+error_t getAndSendCameraImg(HttpConnection *connection, const CameraImage *image,
+   CameraFormat format, bool_t pipelined, CameraFrame *cache, bool_t *complete);
+error_t sendImageData(HttpConnection *connection,
+   const uint8_t *data, size_t length, CameraFormat format);
+size_t findChunkSize(size_t size_count, size_t total_size);
+void logTransferTiming(const TransferTiming *timing,
+   size_t total_size, bool_t pipelined);
 
 // ********************************************************************************************
 
 /**
  * handler function for serving the camera image over a manual api.
  * 
- * this function will send the http header to the client
- * and then call the getAndSendCameraImg function
- * to do the rest of the job!
+ * the last captured frame is kept in memory (see frameCache.h).
+ * if it is fresh enough, it is served without talking to k210.
+ * otherwise this function will ask k210 to take a new image, send
+ * the http header to the client and then call getAndSendCameraImg
+ * to do the rest of the job, filling the cache on the way.
+ * viewers that arrive while a capture is in flight wait for it
+ * and are then served from the cache.
+ * "?maxAge=" (milliseconds) overrides CAMERA_CACHE_MAX_AGE_MS,
+ * "?maxAge=0" always takes a new image.
+ * 
+ * "?format=" selects how the image is encoded:
+ *    hex (default): text/plain, two characters per pixel
+ *    raw: application/octet-stream, one byte per pixel
+ *    pgm: binary pgm image (raw bytes after a width/height header)
+ * raw and pgm skip the text encoding, the bytes are written as
+ * the broker copied them out of the uart ring (one chunk at a time).
+ * 
+ * "?codec=jpeg[&quality=1..100]" or "?codec=rle" asks k210 to
+ * compress the frame before sending it (see k210/frameCodec.py).
+ * the compressed stream is passed through as it is with a proper
+ * content-type and is never decompressed here (format is ignored).
+ * rle is encoded in micropython, pixel by pixel. by codecBench.py
+ * it saves 760 ms of uart on a flat frame at 921600 baud (nothing
+ * on a noisy one) but takes seconds to encode, so raw, jpeg or a
+ * gray4 preview are faster. k210 logs the encode time of every
+ * capture, only pick rle where that beats the uart time it saves.
+ * 
+ * "?scale=2|4" asks k210 to downscale the frame first and "&bpp=4"
+ * to pack two pixels per byte (K210_CODEC_GRAY4, sent as
+ * application/x-meter-gray4). a 160x120 4-bit preview is 9.6KB
+ * instead of 76.8KB. downscaled frames always come from a new
+ * capture and are not cached.
+ * 
+ * transfer is pipelined by default, "?pipeline=0" selects
+ * the sequential transfer (useful for comparing the timings).
  * 
  * if there are any errors in the getAndSendCameraImg function,
  * client will face a CONTENT_LENGTH_MISMATCH error that should
@@ -35,112 +105,452 @@ size_t findChunkSize(size_t size_count);
  */
 error_t cameraImgHandler(HttpConnection *connection)
 {
-   if (strcmp(connection->request.method, "GET"))
-      return ERROR_NOT_FOUND;
-
    ESP_LOGI(LOG_TAG, "camera image requested!");
 
-   if (!uartAcquire(50))
+   CameraFormat format = getCameraFormat(connection);
+   uint8_t quality;
+   uint8_t codec = getCameraCodec(connection, &quality);
+   uint_t maxAge = getCameraMaxAge(connection);
+   uint8_t scale = getCameraScale(connection, &codec);
+
+   // compressed streams are always sent as binary
+   if (codec != K210_CODEC_RAW)
+      format = CAMERA_FORMAT_RAW;
+
+   CameraFrame *frame = scale > 1 ? NULL : frameCacheGet(codec, quality, maxAge);
+   if (frame == NULL)
+   {
+      if (!frameCacheBeginCapture(CAMERA_CACHE_ATTACH_MS))
+         return apiSendRejectionManual(connection);
+
+      // the capture we waited for may have filled the cache
+      frame = scale > 1 ? NULL : frameCacheGet(codec, quality, maxAge);
+      if (frame == NULL)
+      {
+         error_t error = captureAndSendCameraImg(
+            connection, format, codec, quality, scale);
+         frameCacheEndCapture();
+         if (error) return error;
+
+         return httpCloseStream(connection);
+      }
+      frameCacheEndCapture();
+   }
+
+   error_t error = sendCachedCameraImg(connection, frame, format);
+   frameCacheRelease(frame);
+   if (error) return error;
+   ESP_LOGI(LOG_TAG, "image task done!");
+   return httpCloseStream(connection);
+}
+
+// ********************************************************************************************
+
+// parses the "format" query parameter
+CameraFormat getCameraFormat(HttpConnection *connection)
+{
+   char_t value[8];
+   if (!httpGetQueryParam(connection, "format", value, sizeof(value)))
+      return CAMERA_FORMAT_HEX;
+
+   if (!strcmp(value, "raw"))
+      return CAMERA_FORMAT_RAW;
+
+   if (!strcmp(value, "pgm"))
+      return CAMERA_FORMAT_PGM;
+
+   return CAMERA_FORMAT_HEX;
+}
+
+// ********************************************************************************************
+
+// parses the "codec" and "quality" query parameters
+uint8_t getCameraCodec(HttpConnection *connection, uint8_t *quality)
+{
+   char_t value[8];
+   *quality = DEFAULT_JPEG_QUALITY;
+
+   if (!httpGetQueryParam(connection, "codec", value, sizeof(value)))
+      return K210_CODEC_RAW;
+
+   if (!strcmp(value, "rle"))
+      return K210_CODEC_RLE;
+
+   if (strcmp(value, "jpeg"))
+      return K210_CODEC_RAW;
+
+   if (httpGetQueryParam(connection, "quality", value, sizeof(value)))
+   {
+      int_t q = atoi(value);
+      if (1 <= q && q <= 100) *quality = q;
+   }
+   return K210_CODEC_JPEG;
+}
+
+// ********************************************************************************************
+
+// parses the "maxAge" query parameter (milliseconds)
+uint_t getCameraMaxAge(HttpConnection *connection)
+{
+   char_t value[12];
+   if (!httpGetQueryParam(connection, "maxAge", value, sizeof(value)))
+      return CAMERA_CACHE_MAX_AGE_MS;
+
+   return strtoul(value, NULL, 10);
+}
+
+// ********************************************************************************************
+
+/**
+ * parses the "scale" (1, 2 or 4) and "bpp" (8 or 4) query parameters.
+ * 4 bits per pixel turn an uncompressed (codec) into K210_CODEC_GRAY4.
+ */
+uint8_t getCameraScale(HttpConnection *connection, uint8_t *codec)
+{
+   char_t value[4];
+   uint8_t scale = 1;
+
+   if (httpGetQueryParam(connection, "scale", value, sizeof(value)))
+   {
+      int_t s = atoi(value);
+      if (s == 2 || s == CAMERA_MAX_SCALE) scale = s;
+   }
+
+   if (*codec == K210_CODEC_RAW &&
+      httpGetQueryParam(connection, "bpp", value, sizeof(value)) &&
+      !strcmp(value, "4"))
+      *codec = K210_CODEC_GRAY4;
+
+   return scale;
+}
+
+// ********************************************************************************************
+
+/**
+ * takes a new image and streams it to the client while it
+ * arrives from k210. full size images are also stored in a new
+ * cache frame that is published once the transfer is complete.
+ * must be called with the capture lock held.
+ */
+error_t captureAndSendCameraImg(HttpConnection *connection,
+   CameraFormat format, uint8_t codec, uint8_t quality, uint8_t scale)
+{
+   CameraImage image;
+   if (!frameCacheCapture(codec, quality, scale, &image))
+      return apiSendRejectionManual(connection);
+
+   error_t error = sendCameraHeader(connection, format, &image);
+   if(error) return error;
+
+   char_t value[4];
+   bool_t pipelined = !httpGetQueryParam(
+      connection, "pipeline", value, sizeof(value)) || strcmp(value, "0");
+
+   // the image is still sent if there is no memory to cache it
+   CameraFrame *frame = scale > 1 ? NULL : frameCacheAlloc(&image, quality);
+
+   bool_t complete = FALSE;
+   error = getAndSendCameraImg(connection,
+      &image, format, pipelined, frame, &complete);
+
+   if (frame != NULL)
+   {
+      if (complete) frameCachePublish(frame);
+      frameCacheRelease(frame);
+   }
+
+   return error;
+}
+
+// ********************************************************************************************
+
+// serves a frame from the cache
+error_t sendCachedCameraImg(HttpConnection *connection,
+   CameraFrame *frame, CameraFormat format)
+{
+   int64_t age = esp_timer_get_time() - frame->capturedAt;
+   ESP_LOGI(LOG_TAG, "serving cached image (%lld ms old)", age / 1000);
+
+   error_t error = sendCameraHeader(connection, format, &frame->image);
+   if (error) return error;
+
+   return sendImageData(connection,
+      frame->data, frame->image.size, format);
+}
+
+// ********************************************************************************************
+
+/**
+ * handler function for serving only the configured digit windows.
+ * 
+ * k210 takes a new image and packs the digit rectangles of
+ * ImgConfig (and, with "?crops=1", the 28x28 binarized crops that
+ * are fed to the model) into one frame that is transferred like a
+ * camera image and sent as application/octet-stream:
+ * 
+ * | digitCount (1) | flags (1) | frame width (2) | frame height (2) |
+ * | [x, y, width, height] (2 each) per digit                        |
+ * | width*height grayscale bytes per digit                          |
+ * | 28*28 binarized bytes per digit (only if flags & 1)             |
+ * 
+ * rectangles are clipped to the frame, all values are little-endian.
+ */
+error_t cameraRoiHandler(HttpConnection *connection)
+{
+   ESP_LOGI(LOG_TAG, "digit windows requested!");
+
+   if (!appEnv.imgConfig.isConfigured)
+      return apiSendRejectionManual(connection);
+
+   char_t value[4];
+   uint8_t flags = 0;
+   if (httpGetQueryParam(connection, "crops", value, sizeof(value)) &&
+      strcmp(value, "0"))
+      flags |= K210_ROI_WITH_CROPS;
+
+   // the packed frame is staged in the same k210 buffer as camera images
+   if (!frameCacheBeginCapture(CAMERA_CACHE_ATTACH_MS))
+      return apiSendRejectionManual(connection);
+
+   CameraImage image;
+   if (!digitWindowsCapture(flags, &image))
+   {
+      frameCacheEndCapture();
       return apiSendRejectionManual(connection);
+   }
 
    error_t error = httpSendHeaderManual(
-      connection, 200, "text/plain", TOTAL_SIZE*2);
-   if(error) {
-      uartRelease();
-      return error;
+      connection, 200, "application/octet-stream", image.size);
+   if (!error)
+      error = getAndSendCameraImg(
+         connection, &image, CAMERA_FORMAT_RAW, TRUE, NULL, NULL);
+
+   frameCacheEndCapture();
+   if (error) return error;
+
+   return httpCloseStream(connection);
+}
+
+// ********************************************************************************************
+
+/**
+ * handler function for serving the digit crops made on the esp32.
+ * 
+ * only the digit windows are transferred from k210 (see
+ * cameraRoiHandler), the crops are made here (see digitPrep.h)
+ * and sent with one bit per pixel as application/octet-stream:
+ * 
+ * | digitCount (1) | crop size (1) | DIGIT_CROP_PACKED_SIZE per digit |
+ * 
+ * rows are packed MSB first without padding between them.
+ */
+error_t cameraDigitsHandler(HttpConnection *connection)
+{
+   ESP_LOGI(LOG_TAG, "digit crops requested!");
+
+   if (!appEnv.imgConfig.isConfigured)
+      return apiSendRejectionManual(connection);
+
+   uint_t count = 0;
+   uint8_t *crops = digitWindowsReadCrops(&count);
+   uint8_t *packed = crops ? (uint8_t*) malloc(
+      2 + MAX_DIGIT_COUNT * DIGIT_CROP_PACKED_SIZE) : NULL;
+   if (packed == NULL)
+   {
+      free(crops);
+      return apiSendRejectionManual(connection);
    }
 
-   error = getAndSendCameraImg(connection);
-   if(error) {
-      uartRelease();
-      return error;
+   packed[0] = count;
+   packed[1] = DIGIT_CROP_SIZE;
+   for (uint_t i = 0; i < count; i++)
+   {
+      digitPackCrop(crops + i * DIGIT_CROP_PIXELS,
+         packed + 2 + i * DIGIT_CROP_PACKED_SIZE);
    }
 
-   uartRelease();
-   ESP_LOGI(LOG_TAG, "image task done!");
+   free(crops);
+   size_t length = 2 + count * DIGIT_CROP_PACKED_SIZE;
+
+   error_t error = httpSendHeaderManual(
+      connection, 200, "application/octet-stream", length);
+   if (!error)
+      error = httpWriteStream(connection, packed, length);
+
+   free(packed);
+   if (error) return error;
+
    return httpCloseStream(connection);
 }
 
 // ********************************************************************************************
 
 /**
- * requests the camera image from k210 over UART
- * in chunks equal to the buffer size and sends each chunk
- * to the client immediately using the sendChunk function.
+ * sends the http header (and the pgm header if needed)
+ * with the content length of the encoded image
+ */
+error_t sendCameraHeader(HttpConnection *connection,
+   CameraFormat format, const CameraImage *image)
+{
+   if (image->codec == K210_CODEC_JPEG)
+      return httpSendHeaderManual(
+         connection, 200, "image/jpeg", image->size);
+
+   if (image->codec == K210_CODEC_RLE)
+      return httpSendHeaderManual(
+         connection, 200, "application/x-meter-rle", image->size);
+
+   if (image->codec == K210_CODEC_GRAY4)
+      return httpSendHeaderManual(
+         connection, 200, "application/x-meter-gray4", image->size);
+
+   if (format == CAMERA_FORMAT_HEX)
+      return httpSendHeaderManual(
+         connection, 200, "text/plain", image->size*2);
+
+   if (format == CAMERA_FORMAT_RAW)
+      return httpSendHeaderManual(
+         connection, 200, "application/octet-stream", image->size);
+
+   char_t pgmHeader[24];
+   int_t n = sprintf(pgmHeader, "P5\n%u %u\n255\n",
+      image->width, image->height);
+
+   error_t error = httpSendHeaderManual(
+      connection, 200, "image/x-portable-graymap", image->size + n);
+   if (error) return error;
+
+   return httpWriteStream(connection, pgmHeader, n);
+}
+
+// ********************************************************************************************
+
+/**
+ * requests the camera image from k210 through the uart broker
+ * in chunks of K210_CAM_CHUNK_SIZE bytes and sends each
+ * chunk to the client as soon as it arrives.
+ * 
+ * in pipelined mode, the request for chunk N+1 is queued before
+ * chunk N is written to the socket, so the broker fills the other
+ * chunk buffer while the current one is being sent. a transfer
+ * then takes about max(uart, tcp) time instead of their sum.
+ * 
+ * only one chunk request is queued at a time, so higher priority
+ * requests (e.g. ai reads) are started between two chunks.
+ * 
+ * each chunk is crc-checked and requested again on its own
+ * if it gets corrupted on the way.
+ * 
+ * if (cache) is given, every chunk is also copied into it.
+ * (complete), if given, tells whether the whole image arrived.
  * 
  * closes the http connection if k210 doesn't respond
  */
-error_t getAndSendCameraImg(HttpConnection *connection)
+error_t getAndSendCameraImg(HttpConnection *connection, const CameraImage *image,
+   CameraFormat format, bool_t pipelined, CameraFrame *cache, bool_t *complete)
 {
+   size_t total_size = image->size;
    size_t size_count = 0, chunk_size = 0;
-   char_t cmdStr[20];
+   error_t error = NO_ERROR;
+
+   uint8_t *buffers = (uint8_t*) malloc(2 * CAMERA_CHUNK_BUFFER_SIZE);
+   if (buffers == NULL)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't allocate chunk buffers!");
+      return ERROR_OUT_OF_MEMORY;
+   }
+
+   CameraChunk chunks[2];
+   memset(chunks, 0, sizeof(chunks));
+   chunks[0].buffer = buffers;
+   chunks[1].buffer = buffers + CAMERA_CHUNK_BUFFER_SIZE;
+   uint_t current = 0;
 
-   uartSendBytes("camTakeNew", 10);
-   vTaskDelay(200 / portTICK_PERIOD_MS);
+   TransferTiming timing = {0};
+   timing.start = esp_timer_get_time();
 
-   while (size_count < TOTAL_SIZE)
+   if (pipelined)
+      frameCacheSubmitChunk(&chunks[0], 0, findChunkSize(0, total_size));
+
+   while (size_count < total_size)
    {
-      uartClearBuffer();
-      chunk_size = findChunkSize(size_count);
+      CameraChunk *chunk = &chunks[current];
+      chunk_size = findChunkSize(size_count, total_size);
 
-      if (size_count == 0) // if first request
-         sprintf(cmdStr, "camStart:%d", chunk_size);
-      else // if it's not the first request ...
-         sprintf(cmdStr, "camNext:%d", chunk_size);
+      int64_t t0 = esp_timer_get_time();
+      bool_t res = pipelined && frameCacheWaitChunk(chunk);
+      // the pipelined response got lost, ask for it again
+      if (!res) res = frameCacheFetchChunk(chunk, size_count, chunk_size);
+      timing.uartWait += esp_timer_get_time() - t0;
 
-      uartSendString(cmdStr);
-      uint8_t *buffer = uartReadBytesSync(chunk_size, 1000);
-      if (!buffer) {
+      if (!res)
+      {
          ESP_LOGI(LOG_TAG, "K210 seems to be off! exiting the task ...");
          appEnv.errorLog.k210_not_responding = true;
-         return NO_ERROR;
+         break;
       }
-      ESP_LOGI(LOG_TAG, "read chunk with size %d", uartGetBufLength());
 
-      error_t error = sendChunk(connection);
-      if (error) return error;
-      size_count += chunk_size;
+      size_t next = size_count + chunk_size;
+      if (pipelined && next < total_size)
+         frameCacheSubmitChunk(&chunks[current ^ 1],
+            next, findChunkSize(next, total_size));
+
+      if (cache != NULL)
+         memcpy(cache->data + size_count, chunk->buffer + 4, chunk_size);
+
+      int64_t t1 = esp_timer_get_time();
+      error = sendImageData(connection, chunk->buffer + 4, chunk_size, format);
+      timing.tcpWrite += esp_timer_get_time() - t1;
+
+      if (error) break;
+      size_count = next;
+      current ^= 1;
    }
 
-   uartClearBuffer();
-   return NO_ERROR;
+   // the broker may still be filling the other buffer
+   uartBrokerWait(&chunks[current ^ 1].request);
+   free(buffers);
+
+   if (size_count == total_size)
+      logTransferTiming(&timing, total_size, pipelined);
+
+   if (complete != NULL)
+      *complete = size_count == total_size;
+
+   return error;
 }
 
 // ********************************************************************************************
 
 /**
- * encodes the current data in the UART buffer
- * and sends it as a base16 string (manual encoding)
+ * writes image bytes to the client in the requested format.
+ * 
+ * in hex format, each pixel is written as two characters
+ * ('0' + high nibble, '0' + low nibble) using the connection
+ * buffer as scratch space, so no memory is allocated.
  */
-error_t sendChunk(HttpConnection *connection)
+error_t sendImageData(HttpConnection *connection,
+   const uint8_t *data, size_t length, CameraFormat format)
 {
-   error_t error;
-   uint8_t *tmp_buf = (uint8_t*) malloc(4096);
-   if (tmp_buf == NULL)
-      ESP_LOGE(LOG_TAG, "couldn't allocate memory");
-      //! handle this error
+   if (format != CAMERA_FORMAT_HEX)
+      return httpWriteStream(connection, data, length);
 
-   uint8_t *buffer = uartGetBuffer();
-   size_t bufLen = uartGetBufLength();
-
-   uint32_t counter = 0;
-   while(counter < bufLen)
+   uint8_t *tmp_buf = (uint8_t*) connection->buffer;
+   while (length > 0)
    {
       uint32_t i = 0;
-      for (i = 0; i < 2048 && counter+i < bufLen; i++)
+      for (i = 0; i < HTTP_SERVER_BUFFER_SIZE/2 && i < length; i++)
       {
-         tmp_buf[2*i] = buffer[counter+i] / 16 + 48;
-         tmp_buf[2*i + 1] = buffer[counter+i] % 16 + 48;
-      }
-      counter += i;
-      error = httpWriteStream(connection, tmp_buf, 2*i);
-      if(error) {
-         free(tmp_buf);
-         return error;
+         tmp_buf[2*i] = data[i] / 16 + 48;
+         tmp_buf[2*i + 1] = data[i] % 16 + 48;
       }
+      data += i;
+      length -= i;
+
+      error_t error = httpWriteStream(connection, tmp_buf, 2*i);
+      if (error) return error;
    }
 
-   free(tmp_buf);
    return NO_ERROR;
 }
 
@@ -150,12 +560,40 @@ error_t sendChunk(HttpConnection *connection)
  * calculates the chunk size to request from k210
  * such that no overflow occurs
  */
-size_t findChunkSize(size_t size_count)
+size_t findChunkSize(size_t size_count, size_t total_size)
 {
-   if (size_count + BUFFER_SIZE <= TOTAL_SIZE)
-      return BUFFER_SIZE;
+   if (size_count + K210_CAM_CHUNK_SIZE <= total_size)
+      return K210_CAM_CHUNK_SIZE;
+
+   else return (total_size - size_count);
+}
+
+// ********************************************************************************************
+
+/**
+ * reports where the time of a camera transfer went.
+ * 
+ * wire time is what the image needs on the uart at the current
+ * baud rate. the part of it that didn't show up as waiting for
+ * the uart was hidden behind the socket writes (overlap).
+ */
+void logTransferTiming(const TransferTiming *timing,
+   size_t total_size, bool_t pipelined)
+{
+   int64_t total = esp_timer_get_time() - timing->start;
+
+   size_t frames = (total_size + K210_CAM_CHUNK_SIZE - 1) / K210_CAM_CHUNK_SIZE;
+   size_t wireBytes = total_size + frames * (UART_FRAME_OVERHEAD + 4);
+   int64_t wire = (int64_t) wireBytes * 10 * 1000000 / uartGetBaudRate();
+
+   int64_t overlap = wire - timing->uartWait;
+   if (overlap < 0) overlap = 0;
 
-   else return (TOTAL_SIZE - size_count);
+   ESP_LOGI(LOG_TAG, "%s transfer: total %lld ms, uart wait %lld ms, "
+      "tcp write %lld ms, uart wire time %lld ms, overlap %lld ms (%lld%%)",
+      pipelined ? "pipelined" : "sequential",
+      total / 1000, timing->uartWait / 1000, timing->tcpWrite / 1000,
+      wire / 1000, overlap / 1000, overlap * 100 / wire);
 }
 
 // ********************************************************************************************
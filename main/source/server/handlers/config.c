@@ -4,26 +4,42 @@
 #include <string.h>
 #include "handlers.h"
 #include "source/storage/storage.h"
+#include "source/utils/cJSON.h"
 #include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+#include "source/serial/linkSpeed.h"
 #include "source/server/httpHelper.h"
+#include "source/server/jsonWriter.h"
+#include "source/server/server.h"
 #include "source/network/netConfigParser.h"
 #include "source/utils/imgConfigParser.h"
 #include "source/mqtt/mqttConfigParser.h"
+#include "source/mqtt/aiTask.h"
+#include "source/camera/frameCache.h"
+#include "source/camera/digitLocate.h"
 #include "esp_log.h"
 #include "source/appEnv.h"
 
 static const uint_t READ_STREAM_BUF_SIZE = 511;
+
+// an img config of MAX_DIGIT_COUNT rectangles takes about 1.5KB
+static const uint_t IMG_CONFIG_BUF_SIZE = 2047;
 static const char_t *LOG_TAG = "configHandler";
 
 // ********************************************************************************************
 // forward declaration of functions
 
 error_t imgConfigHandler(HttpConnection *connection);
+static void applyImgConfig();
 bool_t sendConfigToK210(ImgConfig *imgConfig);
+error_t autoConfigHandler(HttpConnection *connection);
+static bool_t locateDigits(ImgConfig *imgConfig);
 error_t mqttConfigHandler(HttpConnection *connection);
 error_t lanConfigHandler(HttpConnection *connection);
 error_t staWifiConfigHandler(HttpConnection *connection);
 error_t apWifiConfigHandler(HttpConnection *connection);
+error_t linkSpeedHandler(HttpConnection *connection);
+static error_t sendLinkStats(HttpConnection *connection);
 
 // ********************************************************************************************
 
@@ -34,18 +50,12 @@ error_t apWifiConfigHandler(HttpConnection *connection);
  */
 error_t imgConfigHandler(HttpConnection *connection)
 {
-   if (strcmp(connection->request.method, "POST"))
-      return ERROR_NOT_FOUND;
-
-   if (!uartAcquire(50))
-      return apiSendRejectionManual(connection);
-
    bool_t parsingResult = FALSE;
-   char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
+   char_t *data = (char_t*) malloc(IMG_CONFIG_BUF_SIZE+1);
    if (data)
    {
       size_t length = 0;
-      httpReadStream(connection, data, READ_STREAM_BUF_SIZE, &length, 0);
+      httpReadStream(connection, data, IMG_CONFIG_BUF_SIZE, &length, 0);
       data[length] = '\0';
       parsingResult = parseImgConfig(&appEnv.imgConfig, data);
       free(data);
@@ -54,52 +64,60 @@ error_t imgConfigHandler(HttpConnection *connection)
 
    if (parsingResult)
    {
-      appEnv.meterCounter[0] = '\0';
-      saveImgConfig(&appEnv.imgConfig);
-      sendConfigToK210(&appEnv.imgConfig);
-   }
-
-   uartRelease();
-
-   if (parsingResult)
+      applyImgConfig();
       return apiSendSuccessManual(connection, "Configs Recieved!");
+   }
 
    return apiSendRejectionManual(connection);
 }
 
+// stores appEnv.imgConfig and passes it on to k210
+static void applyImgConfig()
+{
+   // the committed counters belong to the old meters
+   appEnv.meterCounter[0] = '\0';
+   saveMeterCounter(appEnv.meterCounter);
+   saveImgConfig(&appEnv.imgConfig);
+   sendConfigToK210(&appEnv.imgConfig);
+
+   // the last reading belongs to the old digit layout
+   aiInvalidateReading();
+}
+
 // ********************************************************************************************
 
 /**
  * this function will send the k210Config object to k210
- * over UART as a ':' seperated string 
+ * over UART as a binary frame:
+ * digitCount (1), invert (1), [x, y, width, height] (2 each) per digit
+ * 
+ * k210 doesn't know about the meters: it infers the digits of all of
+ * them from one snapshot in the order sent, which is grouped by meter.
  */
 bool_t sendConfigToK210(ImgConfig *imgConfig)
 {
-   char_t* str = (char_t*) malloc(MAX_DIGIT_COUNT * 30 + 20);
-   char_t* tmp = (char_t*) malloc(30);
-   sprintf(str, "config:%"PRIu8":%"PRIu8,
-      imgConfig->digitCount, imgConfig->invert ? 1 : 0);
+   uint8_t payload[2 + MAX_DIGIT_COUNT * 8];
+   uint8_t *p = payload;
+
+   *p++ = imgConfig->digitCount;
+   *p++ = imgConfig->invert ? 1 : 0;
 
    for (uint_t i = 0; i < imgConfig->digitCount; i++)
    {
-      sprintf(tmp, ":%"PRIu16":%"PRIu16":%"PRIu16":%"PRIu16, 
-         imgConfig->positions[i].x,
-         imgConfig->positions[i].y,
-         imgConfig->positions[i].width,
-         imgConfig->positions[i].height
-      );
-      strcat(str, tmp);
+      STORE16LE(imgConfig->positions[i].x, p);
+      STORE16LE(imgConfig->positions[i].y, p + 2);
+      STORE16LE(imgConfig->positions[i].width, p + 4);
+      STORE16LE(imgConfig->positions[i].height, p + 6);
+      p += 8;
    }
-   free(tmp);
 
-   uartSendString(str);
-   ESP_LOGI(LOG_TAG, "uart sent %s", str);
-   free(str);
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_CONFIG, payload, p - payload, NULL, 0);
+   request.priority = UART_PRIORITY_HIGH;
+   request.waitTimeMS = 400;
+   request.retries = 2;
 
-   uartClearBuffer();
-   uint8_t *hanshake = uartReadBytesSync(8, 400);
-   hanshake[8] = '\0';
-   if (!hanshake || strcmp((char*) hanshake, "recieved"))
+   if (!uartBrokerExecute(&request))
    {
       ESP_LOGE(LOG_TAG, "handshaking failed!");
       return false;
@@ -110,18 +128,95 @@ bool_t sendConfigToK210(ImgConfig *imgConfig)
 
 // ********************************************************************************************
 
+/**
+ * handler function for the automatic calibration.
+ * 
+ * a camera frame is searched for the digit row (see digitLocate.h)
+ * and the proposed config is sent back in the json layout that
+ * "/config" accepts, so the client can review and post it.
+ * GET only proposes, POST also stores and applies the proposal
+ * (a prefetch or a cross-site image must not recalibrate the meter).
+ * the request is rejected if no row of digits was found.
+ */
+error_t autoConfigHandler(HttpConnection *connection)
+{
+   ESP_LOGI(LOG_TAG, "automatic calibration requested!");
+
+   ImgConfig *imgConfig = malloc(sizeof(ImgConfig));
+   if (imgConfig == NULL || !locateDigits(imgConfig))
+   {
+      free(imgConfig);
+      return apiSendRejectionManual(connection);
+   }
+
+   if (!strcmp(connection->request.method, "POST"))
+   {
+      memcpy(&appEnv.imgConfig, imgConfig, sizeof(ImgConfig));
+      applyImgConfig();
+   }
+
+   JsonWriter writer;
+   jsonWriterInit(&writer, connection, 200);
+   imgConfigWriteJson(&writer, imgConfig);
+   free(imgConfig);
+   return jsonWriterFinish(&writer);
+}
+
+// fills (imgConfig) with the digit row found in a recent raw frame
+static bool_t locateDigits(ImgConfig *imgConfig)
+{
+   // the http task stack is too small for the scratch
+   DigitLocateScratch *scratch = malloc(sizeof(DigitLocateScratch));
+   CameraFrame *frame = scratch ? frameCacheGetRaw(CAMERA_CACHE_MAX_AGE_MS) : NULL;
+   if (frame == NULL)
+   {
+      ESP_LOGE(LOG_TAG, "couldn't get a camera frame!");
+      free(scratch);
+      return FALSE;
+   }
+
+   DigitLocation location;
+   bool_t found = digitLocate(frame->data, frame->image.width,
+      frame->image.height, scratch, &location);
+   frameCacheRelease(frame);
+   free(scratch);
+
+   if (!found || location.digitCount > MAX_DIGIT_COUNT)
+   {
+      ESP_LOGI(LOG_TAG, "no digit row found");
+      return FALSE;
+   }
+
+   memset(imgConfig, 0, sizeof(ImgConfig));
+   imgConfig->isConfigured = TRUE;
+   imgConfig->digitCount = location.digitCount;
+   imgConfig->invert = location.invert;
+
+   for (uint_t i = 0; i < location.digitCount; i++)
+   {
+      imgConfig->positions[i].x = location.boxes[i].x;
+      imgConfig->positions[i].y = location.boxes[i].y;
+      imgConfig->positions[i].width = location.boxes[i].width;
+      imgConfig->positions[i].height = location.boxes[i].height;
+   }
+   imgConfigSingleMeter(imgConfig);
+
+   ESP_LOGI(LOG_TAG, "found %d digits", location.digitCount);
+   return TRUE;
+}
+
+// ********************************************************************************************
+
 error_t mqttConfigHandler(HttpConnection *connection)
 {
    if (!strcmp(connection->request.method, "GET"))
    {
-      char_t *data = mqttConfigToJson(&appEnv.mqttConfig);
-      if (!data) return apiSendRejectionManual(connection);
-      return httpSendJsonAndFreeManual(connection, 200, data);
+      JsonWriter writer;
+      jsonWriterInit(&writer, connection, 200);
+      mqttConfigWriteJson(&writer, &appEnv.mqttConfig);
+      return jsonWriterFinish(&writer);
    }
 
-   if (strcmp(connection->request.method, "POST"))
-      return ERROR_NOT_FOUND;
-
    bool_t parsingResult = FALSE;
 
    char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
@@ -152,14 +247,12 @@ error_t lanConfigHandler(HttpConnection *connection)
 {
    if (!strcmp(connection->request.method, "GET"))
    {
-      char_t *data = lanConfigToJson(&appEnv.lanConfig);
-      if (!data) return apiSendRejectionManual(connection);
-      return httpSendJsonAndFreeManual(connection, 200, data);
+      JsonWriter writer;
+      jsonWriterInit(&writer, connection, 200);
+      lanConfigWriteJson(&writer, &appEnv.lanConfig);
+      return jsonWriterFinish(&writer);
    }
 
-   if (strcmp(connection->request.method, "POST"))
-      return ERROR_NOT_FOUND;
-
    bool_t parsingResult = FALSE;
 
    char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
@@ -190,14 +283,12 @@ error_t staWifiConfigHandler(HttpConnection *connection)
 {
    if (!strcmp(connection->request.method, "GET"))
    {
-      char_t *data = staWifiConfigToJson(&appEnv.staWifiConfig);
-      if (!data) return apiSendRejectionManual(connection);
-      return httpSendJsonAndFreeManual(connection, 200, data);
+      JsonWriter writer;
+      jsonWriterInit(&writer, connection, 200);
+      staWifiConfigWriteJson(&writer, &appEnv.staWifiConfig);
+      return jsonWriterFinish(&writer);
    }
 
-   if (strcmp(connection->request.method, "POST"))
-      return ERROR_NOT_FOUND;
-
    bool_t parsingResult = FALSE;
 
    char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
@@ -228,14 +319,12 @@ error_t apWifiConfigHandler(HttpConnection *connection)
 {
    if (!strcmp(connection->request.method, "GET"))
    {
-      char_t *data = apWifiConfigToJson(&appEnv.apWifiConfig);
-      if (!data) return apiSendRejectionManual(connection);
-      return httpSendJsonAndFreeManual(connection, 200, data);
+      JsonWriter writer;
+      jsonWriterInit(&writer, connection, 200);
+      apWifiConfigWriteJson(&writer, &appEnv.apWifiConfig);
+      return jsonWriterFinish(&writer);
    }
 
-   if (strcmp(connection->request.method, "POST"))
-      return ERROR_NOT_FOUND;
-
    bool_t parsingResult = FALSE;
 
    char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
@@ -261,3 +350,75 @@ error_t apWifiConfigHandler(HttpConnection *connection)
 }
 
 // ********************************************************************************************
+
+/**
+ * GET reports the link rate and the counters of every candidate rate,
+ * POST {"maxBaud": 2000000} renegotiates up to the given rate
+ * (503 while every k210 slot is taken, see slowRequestBegin)
+ */
+error_t linkSpeedHandler(HttpConnection *connection)
+{
+   if (!strcmp(connection->request.method, "GET"))
+      return sendLinkStats(connection);
+
+   uint32_t rate = 0;
+   char_t *data = (char_t*) malloc(READ_STREAM_BUF_SIZE+1);
+
+   if (data)
+   {
+      size_t length = 0;
+      httpReadStream(connection, data, READ_STREAM_BUF_SIZE, &length, 0);
+      data[length] = '\0';
+
+      cJSON *json = cJSON_Parse(data);
+      cJSON *maxBaud = cJSON_GetObjectItemCaseSensitive(json, "maxBaud");
+      if (cJSON_IsNumber(maxBaud) &&
+         maxBaud->valuedouble >= UART_BASE_BAUD_RATE &&
+         maxBaud->valuedouble <= UINT32_MAX)
+         rate = (uint32_t) maxBaud->valuedouble;
+
+      cJSON_Delete(json);
+   }
+   else ESP_LOGE(LOG_TAG, "couldn't allocate memory!");
+
+   // nothing of the request is kept during the renegotiation
+   free(data);
+
+   if (rate == 0)
+      return apiSendRejectionManual(connection);
+
+   // renegotiating waits on the k210
+   if (!slowRequestBegin())
+      return httpSendBusyManual(connection);
+   linkNegotiate(rate);
+   slowRequestEnd();
+
+   return sendLinkStats(connection);
+}
+
+static error_t sendLinkStats(HttpConnection *connection)
+{
+   LinkRateStats stats[LINK_RATE_COUNT];
+   linkGetStats(stats);
+
+   JsonWriter writer;
+   jsonWriterInit(&writer, connection, 200);
+   jsonBeginObject(&writer, NULL);
+   jsonAddNumber(&writer, "baudRate", linkGetBaudRate());
+   jsonAddNumber(&writer, "maxBaud", appEnv.linkBaudRate);
+
+   jsonBeginArray(&writer, "rates");
+   for (uint_t i = 0; i < LINK_RATE_COUNT; i++)
+   {
+      jsonBeginObject(&writer, NULL);
+      jsonAddNumber(&writer, "baudRate", stats[i].baudRate);
+      jsonAddNumber(&writer, "transactions", stats[i].transactions);
+      jsonAddNumber(&writer, "errors", stats[i].errors);
+      jsonAddNumber(&writer, "fallbacks", stats[i].fallbacks);
+      jsonEndObject(&writer);
+   }
+   jsonEndArray(&writer);
+
+   jsonEndObject(&writer);
+   return jsonWriterFinish(&writer);
+}
@@ -6,12 +6,16 @@
 #include "source/network/network.h"
 
 error_t imgConfigHandler(HttpConnection *connection);
+error_t autoConfigHandler(HttpConnection *connection);
 error_t mqttConfigHandler(HttpConnection *connection);
 error_t lanConfigHandler(HttpConnection *connection);
 error_t staWifiConfigHandler(HttpConnection *connection);
 error_t apWifiConfigHandler(HttpConnection *connection);
+error_t linkSpeedHandler(HttpConnection *connection);
 
 error_t cameraImgHandler(HttpConnection* connection);
+error_t cameraRoiHandler(HttpConnection* connection);
+error_t cameraDigitsHandler(HttpConnection* connection);
 error_t getAIHandler(HttpConnection *connection);
 
 #endif
\ No newline at end of file
@@ -1,104 +1,150 @@
 #include <stdlib.h>
 #include <string.h>
 #include "handlers.h"
-#include "os_port_freertos.h"
-#include "source/serial/uartHelper.h"
+#include "source/utils/cJSON.h"
+#include "source/mqtt/aiTask.h"
+#include "source/storage/storage.h"
 #include "source/server/httpHelper.h"
+#include "source/server/jsonWriter.h"
+#include "source/server/server.h"
 #include "source/appEnv.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 
 static const char_t *LOG_TAG = "readMeter";
+static const uint_t READ_STREAM_BUF_SIZE = 127;
 
 // ********************************************************************************************
 // forward declaration of functions
 
 error_t getAIHandler(HttpConnection *connection);
-bool_t getAiHelper(char_t *res);
-bool_t checkAiResponseHelper();
+error_t sendAiReading(HttpConnection *connection, const AiReading *reading);
+error_t setAiIntervalHandler(HttpConnection *connection);
 
 // ********************************************************************************************
 
 /**
  * handler function for serving the ai results
  * 
- * this function will request the ai result from k210
- * over UART and send the actual reading over api
+ * the reading is taken by the sampler task in the background
+ * (see aiTask.h) and served right away from its last snapshot.
+ * "?fresh=1" takes a new reading from k210 before responding
+ * (503 while every k210 slot is taken, see slowRequestBegin).
+ * 
+ * POST {"interval": ms} changes the sampling interval.
  */
 error_t getAIHandler(HttpConnection *connection)
 {
-   if (strcmp(connection->request.method, "GET"))
-      return ERROR_NOT_FOUND;
+   if (!strcmp(connection->request.method, "POST"))
+      return setAiIntervalHandler(connection);
 
    ESP_LOGI(LOG_TAG, "AI result requested!");
-   if (!uartAcquire(50))
-      return apiSendRejectionManual(connection);
 
-   char_t tmp[11];
-   bool_t res = getAiHelper(tmp);
+   char_t value[4];
+   bool_t fresh = httpGetQueryParam(
+      connection, "fresh", value, sizeof(value)) && strcmp(value, "0");
 
-   uartRelease();
+   AiReading reading;
+   if (!fresh)
+      aiGetReading(&reading);
 
-   if (!res)
-      return apiSendRejectionManual(connection);
+   // nothing sampled yet, read it now
+   if (fresh || !reading.valid)
+   {
+      if (!slowRequestBegin())
+         return httpSendBusyManual(connection);
+      bool_t done = aiReadNow(&reading);
+      slowRequestEnd();
+
+      if (!done)
+         return apiSendRejectionManual(connection);
+   }
 
-   return apiSendSuccessManual(connection, tmp);
+   return sendAiReading(connection, &reading);
 }
 
 // ********************************************************************************************
 
 /**
- * requests and recieves the AI reading over uart communication
+ * sends the reading along with its sequence number, its age in
+ * milliseconds, the k210 frame counter, the confidence (per mille),
+ * the inferred/skipped digit counters of the change detector and
+ * where the digits were classified ("k210" or the "esp32" fallback).
+ * 
+ * "message" holds the digits of all the meters, "meters" splits them:
+ * [{"name", "value", "raw", "stable", "confidence"}, ...] in the
+ * configured order. value is the one committed by the reading filter
+ * (see readingFilter.h) once stable, raw the digits as classified.
+ * "reread" counts the digits infered again for a low probability.
  */
-bool_t getAiHelper(char_t *res)
+error_t sendAiReading(HttpConnection *connection, const AiReading *reading)
 {
-   uint8_t *buffer = uartGetBuffer();
-
-   vTaskDelay(100 / portTICK_PERIOD_MS);
-   uartSendBytes("AIread:1", 8);
-   uartClearBuffer();
-   uint8_t *hanshake = uartReadBytesSync(4, 400);
-   hanshake[4] = '\0';
-   ESP_LOGI("UART", "recieved '%s'", (char_t*)buffer);
-   if (!hanshake || strcmp((char*) hanshake, "done"))
+   int64_t age = (esp_timer_get_time() - reading->timestamp) / 1000;
+
+   JsonWriter writer;
+   jsonWriterInit(&writer, connection, 200);
+   jsonBeginObject(&writer, NULL);
+   jsonAddNumber(&writer, "status", 1);
+   jsonAddString(&writer, "message", reading->value);
+   jsonAddNumber(&writer, "seq", reading->seq);
+   jsonAddNumber(&writer, "age", age);
+   jsonAddNumber(&writer, "frame", reading->frame);
+   jsonAddNumber(&writer, "confidence", reading->confidence);
+   jsonAddNumber(&writer, "inferred", reading->inferred);
+   jsonAddNumber(&writer, "skipped", reading->skipped);
+   jsonAddNumber(&writer, "reread", reading->reread);
+   jsonAddString(&writer, "source",
+      reading->source == AI_SOURCE_ESP32 ? "esp32" : "k210");
+
+   jsonBeginArray(&writer, "meters");
+   char_t value[MAX_DIGIT_COUNT+1];
+
+   for (uint_t i = 0; i < reading->meterCount; i++)
    {
-      ESP_LOGE(LOG_TAG, "handshaking failed!");
-      return false;
-   }
-
-   uartClearBuffer();
-   uartSendBytes("AIsend:1", 8);
-   if (!waitForBuffer(5 + appEnv.imgConfig.digitCount, 300)) {
-      ESP_LOGI("API", "K210 seems to be off! exiting the task ...");
-      return FALSE;
-   }
-
-   buffer[5 + appEnv.imgConfig.digitCount] = 0;
-   ESP_LOGI("UART", "recieved '%s'", (char_t*)buffer);
-   if (checkAiResponseHelper()) {
-      ESP_LOGE("UART", "k210 sent invalid response for ai request");
-      return FALSE;
+      jsonBeginObject(&writer, NULL);
+
+      const AiMeterReading *meterReading = &reading->meters[i];
+      aiGetMeterValue(reading, i, value);
+      jsonAddString(&writer, "name", appEnv.imgConfig.meters[i].name);
+      jsonAddString(&writer, "value", value);
+
+      memcpy(value, reading->raw + meterReading->offset, meterReading->digitCount);
+      jsonAddString(&writer, "raw", value);
+      jsonAddBool(&writer, "stable", meterReading->stable);
+      jsonAddNumber(&writer, "confidence", meterReading->confidence);
+      jsonEndObject(&writer);
    }
+   jsonEndArray(&writer);
 
-   strncpy(res, (char_t*)(buffer+4), appEnv.imgConfig.digitCount);
-   res[appEnv.imgConfig.digitCount] = '\0';
-   return TRUE;
+   jsonEndObject(&writer);
+   return jsonWriterFinish(&writer);
 }
 
 // ********************************************************************************************
 
-/**
- * validates the k210 response for ai result request
- */
-bool_t checkAiResponseHelper()
+error_t setAiIntervalHandler(HttpConnection *connection)
 {
-   uint8_t* buffer = uartGetBuffer();
+   char_t data[READ_STREAM_BUF_SIZE+1];
+   size_t length = 0;
+   httpReadStream(connection, data, READ_STREAM_BUF_SIZE, &length, 0);
+   data[length] = '\0';
 
-   char_t tmp[5];
-   strncpy(tmp, (char_t*)buffer, 4);
-   tmp[4] = '\0';
+   cJSON *json = cJSON_Parse(data);
+   cJSON *interval = cJSON_GetObjectItemCaseSensitive(json, "interval");
 
-   return buffer[4 + appEnv.imgConfig.digitCount] != ';' ||
-      strcmp(tmp, "num:");
-}
+   bool_t valid = cJSON_IsNumber(interval) && (interval->valuedouble == 0 ||
+      (interval->valuedouble >= AI_MIN_SAMPLE_INTERVAL_MS &&
+      interval->valuedouble <= UINT32_MAX));
 
-// ********************************************************************************************
+   if (valid)
+   {
+      aiSetSampleInterval((uint32_t) interval->valuedouble);
+      saveAiSampleInterval(appEnv.aiSampleInterval);
+   }
+   cJSON_Delete(json);
+
+   if (!valid)
+      return apiSendRejectionManual(connection);
+
+   return apiSendSuccessManual(connection, "Interval Recieved!");
+}
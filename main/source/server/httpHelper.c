@@ -1,9 +1,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include "httpHelper.h"
-#include "source/utils/cJSON.h"
+#include "jsonWriter.h"
 #include "esp_log.h"
 
+// ********************************************************************************************
+// forward declaration of functions
+
+static error_t apiSendStatusHelper(HttpConnection *connection,
+   uint_t statusCode, int32_t status, const char_t *message);
+
 // ********************************************************************************************
 
 /**
@@ -92,21 +98,13 @@ error_t httpSendJsonManual(HttpConnection *connection,
 // ********************************************************************************************
 
 /**
- * send message buffer to client and free the message buffer
- * set content-type to json
+ * tells the client to try again later with a "Service Unavailable"
+ * status code (every k210 slot is taken, see slowRequestBegin)
  * then safely close the http connection
- * 
- * ! message is expected to be null-terminated !
- * message buffer won't be accessable after calling this function
  */
-error_t httpSendJsonAndFreeManual(HttpConnection *connection,
-   int32_t statusCode, char_t *message)
+error_t httpSendBusyManual(HttpConnection *connection)
 {
-   error_t error = httpSendJsonManual(
-      connection, statusCode, message
-   );
-   free(message);
-   return error;
+   return httpSendManual(connection, 503, "text/plain", "busy, try again");
 }
 
 // ********************************************************************************************
@@ -118,17 +116,8 @@ error_t httpSendJsonAndFreeManual(HttpConnection *connection,
  */
 error_t apiSendRejectionManual(HttpConnection *connection)
 {
-   cJSON *res = cJSON_CreateObject();
-   char_t *jsonStr = NULL;
-
-   cJSON_AddNumberToObject(res, "status", 0);
-   cJSON_AddStringToObject(res, "message", "request rejected!");
-   jsonStr = cJSON_Print(res);
-   cJSON_Delete(res);
    ESP_LOGI("API", "request rejected!");
-   return httpSendJsonAndFreeManual(
-      connection, 400, jsonStr
-   );
+   return apiSendStatusHelper(connection, 400, 0, "request rejected!");
 }
 
 // ********************************************************************************************
@@ -142,17 +131,60 @@ error_t apiSendRejectionManual(HttpConnection *connection)
  */
 error_t apiSendSuccessManual(HttpConnection *connection, char_t *message)
 {
-   cJSON *res = cJSON_CreateObject();
-   char_t *jsonStr = NULL;
-
-   cJSON_AddNumberToObject(res, "status", 1);
-   cJSON_AddStringToObject(res, "message", message);
-   jsonStr = cJSON_Print(res);
-   cJSON_Delete(res);
    ESP_LOGI("API", "request ok!");
-   return httpSendJsonAndFreeManual(
-      connection, 200, jsonStr
-   );
+   return apiSendStatusHelper(connection, 200, 1, message);
+}
+
+// sends {"status": (status), "message": (message)}
+static error_t apiSendStatusHelper(HttpConnection *connection,
+   uint_t statusCode, int32_t status, const char_t *message)
+{
+   JsonWriter writer;
+   jsonWriterInit(&writer, connection, statusCode);
+   jsonBeginObject(&writer, NULL);
+   jsonAddNumber(&writer, "status", status);
+   jsonAddString(&writer, "message", message);
+   jsonEndObject(&writer);
+   return jsonWriterFinish(&writer);
+}
+
+// ********************************************************************************************
+
+/**
+ * looks up (name) in the query string of the request
+ * (e.g. "/camera?format=raw") and copies its value
+ * as a null-terminated string into (value).
+ * 
+ * returns FALSE if the parameter is not present.
+ */
+bool_t httpGetQueryParam(HttpConnection *connection,
+   const char_t *name, char_t *value, size_t size)
+{
+   const char_t *p = connection->request.queryString;
+   size_t nameLen = strlen(name);
+
+   while (*p)
+   {
+      const char_t *end = strchr(p, '&');
+      if (!end) end = p + strlen(p);
+
+      if (!strncmp(p, name, nameLen) &&
+         (p[nameLen] == '=' || p + nameLen == end))
+      {
+         const char_t *v = p + nameLen;
+         if (*v == '=') v += 1;
+
+         size_t n = end - v;
+         if (n >= size) n = size - 1;
+         memcpy(value, v, n);
+         value[n] = '\0';
+         return TRUE;
+      }
+
+      p = *end ? end + 1 : end;
+   }
+
+   return FALSE;
 }
 
 // ********************************************************************************************
@@ -17,12 +17,14 @@ error_t httpSendAndFreeManual(HttpConnection* connection,
 error_t httpSendJsonManual(HttpConnection* connection,
    int32_t statusCode, char_t* message);
 
-error_t httpSendJsonAndFreeManual(HttpConnection* connection,
-   int32_t statusCode, char_t* message);
+error_t httpSendBusyManual(HttpConnection* connection);
 
 error_t apiSendRejectionManual(HttpConnection* connection);
 
 error_t apiSendSuccessManual(HttpConnection* connection,
    char_t* message);
 
+bool_t httpGetQueryParam(HttpConnection* connection,
+   const char_t* name, char_t* value, size_t size);
+
 #endif
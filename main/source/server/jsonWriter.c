@@ -0,0 +1,272 @@
+#include <string.h>
+#include "jsonWriter.h"
+#include "http/http_server_misc.h"
+
+// ********************************************************************************************
+// forward declaration of functions
+
+void jsonWriterInit(JsonWriter *writer,
+   HttpConnection *connection, uint_t statusCode);
+void jsonBeginObject(JsonWriter *writer, const char_t *name);
+void jsonEndObject(JsonWriter *writer);
+void jsonBeginArray(JsonWriter *writer, const char_t *name);
+void jsonEndArray(JsonWriter *writer);
+void jsonAddString(JsonWriter *writer, const char_t *name, const char_t *value);
+void jsonAddNumber(JsonWriter *writer, const char_t *name, int64_t value);
+void jsonAddBool(JsonWriter *writer, const char_t *name, bool_t value);
+error_t jsonWriterFinish(JsonWriter *writer);
+
+static void beginContainer(JsonWriter *writer, const char_t *name, char_t open);
+static void endContainer(JsonWriter *writer, char_t close);
+static void beginValue(JsonWriter *writer, const char_t *name);
+static void writeString(JsonWriter *writer, const char_t *value);
+static void writeData(JsonWriter *writer, const char_t *data, size_t length);
+static void flushBody(JsonWriter *writer);
+static void sendHeader(JsonWriter *writer, bool_t chunked);
+
+// ********************************************************************************************
+
+void jsonWriterInit(JsonWriter *writer,
+   HttpConnection *connection, uint_t statusCode)
+{
+   memset(writer, 0, sizeof(JsonWriter));
+   writer->connection = connection;
+   writer->statusCode = statusCode;
+   writer->error = NO_ERROR;
+}
+
+// ********************************************************************************************
+
+void jsonBeginObject(JsonWriter *writer, const char_t *name)
+{
+   beginContainer(writer, name, '{');
+}
+
+void jsonEndObject(JsonWriter *writer)
+{
+   endContainer(writer, '}');
+}
+
+void jsonBeginArray(JsonWriter *writer, const char_t *name)
+{
+   beginContainer(writer, name, '[');
+}
+
+void jsonEndArray(JsonWriter *writer)
+{
+   endContainer(writer, ']');
+}
+
+// ********************************************************************************************
+
+void jsonAddString(JsonWriter *writer, const char_t *name, const char_t *value)
+{
+   beginValue(writer, name);
+   writeString(writer, value ? value : "");
+}
+
+void jsonAddNumber(JsonWriter *writer, const char_t *name, int64_t value)
+{
+   // formatted by hand, newlib's printf may lack 64-bit support
+   char_t digits[20];
+   uint_t n = sizeof(digits);
+   uint64_t magnitude = value < 0 ? -(uint64_t) value : (uint64_t) value;
+
+   do {
+      digits[--n] = '0' + magnitude % 10;
+      magnitude /= 10;
+   } while (magnitude);
+
+   beginValue(writer, name);
+   if (value < 0) writeData(writer, "-", 1);
+   writeData(writer, digits + n, sizeof(digits) - n);
+}
+
+void jsonAddBool(JsonWriter *writer, const char_t *name, bool_t value)
+{
+   beginValue(writer, name);
+   if (value) writeData(writer, "true", 4);
+   else writeData(writer, "false", 5);
+}
+
+// ********************************************************************************************
+
+error_t jsonWriterFinish(JsonWriter *writer)
+{
+   HttpConnection *connection = writer->connection;
+
+   if (!writer->error && writer->depth != 0)
+      writer->error = ERROR_INVALID_SYNTAX;
+
+   // the whole body is in the buffer, so its length is known
+   if (!writer->headerSent)
+      sendHeader(writer, FALSE);
+
+   flushBody(writer);
+
+   if (!writer->error)
+      writer->error = httpCloseStream(connection);
+
+   return writer->error;
+}
+
+// ********************************************************************************************
+
+static void beginContainer(JsonWriter *writer, const char_t *name, char_t open)
+{
+   if (writer->depth + 1 >= JSON_WRITER_MAX_DEPTH)
+   {
+      if (!writer->error)
+         writer->error = ERROR_INVALID_SYNTAX;
+      return;
+   }
+
+   beginValue(writer, name);
+   writeData(writer, &open, 1);
+
+   writer->depth++;
+   writer->hasMembers &= ~(1UL << writer->depth);
+}
+
+static void endContainer(JsonWriter *writer, char_t close)
+{
+   if (writer->depth == 0)
+   {
+      if (!writer->error)
+         writer->error = ERROR_INVALID_SYNTAX;
+      return;
+   }
+
+   writer->depth--;
+   writeData(writer, &close, 1);
+}
+
+/**
+ * separates the value from the previous member of its container
+ * and writes its key if there is one
+ */
+static void beginValue(JsonWriter *writer, const char_t *name)
+{
+   uint32_t bit = 1UL << writer->depth;
+   if (writer->hasMembers & bit)
+      writeData(writer, ",", 1);
+   writer->hasMembers |= bit;
+
+   if (name != NULL)
+   {
+      writeString(writer, name);
+      writeData(writer, ":", 1);
+   }
+}
+
+// ********************************************************************************************
+
+static void writeString(JsonWriter *writer, const char_t *value)
+{
+   static const char_t hex[] = "0123456789abcdef";
+   const char_t *run = value;
+
+   writeData(writer, "\"", 1);
+
+   // the characters that need no escape are copied in runs
+   for (const char_t *p = value; *p; p++)
+   {
+      uint8_t c = (uint8_t) *p;
+      if (c >= 0x20 && c != '"' && c != '\\')
+         continue;
+
+      writeData(writer, run, p - run);
+      run = p + 1;
+
+      char_t escape[6] = {'\\', c, 0, 0, 0, 0};
+      size_t length = 2;
+
+      if (c == '\n') escape[1] = 'n';
+      else if (c == '\r') escape[1] = 'r';
+      else if (c == '\t') escape[1] = 't';
+      else if (c < 0x20)
+      {
+         memcpy(escape + 1, "u00", 3);
+         escape[4] = hex[c >> 4];
+         escape[5] = hex[c & 0xF];
+         length = 6;
+      }
+
+      writeData(writer, escape, length);
+   }
+
+   writeData(writer, run, strlen(run));
+   writeData(writer, "\"", 1);
+}
+
+static void writeData(JsonWriter *writer, const char_t *data, size_t length)
+{
+   char_t *buffer = writer->connection->buffer;
+
+   while (length > 0 && !writer->error)
+   {
+      size_t size = HTTP_SERVER_BUFFER_SIZE;
+      if (!writer->headerSent)
+         size -= JSON_WRITER_HEADER_RESERVE;
+
+      if (writer->length == size)
+      {
+         // too large for a Content-Length, stream it in chunks
+         if (!writer->headerSent)
+            sendHeader(writer, TRUE);
+         flushBody(writer);
+         continue;
+      }
+
+      size_t n = MIN(length, size - writer->length);
+      memcpy(buffer + writer->length, data, n);
+      writer->length += n;
+      data += n;
+      length -= n;
+   }
+}
+
+// ********************************************************************************************
+
+static void flushBody(JsonWriter *writer)
+{
+   if (!writer->error && writer->length > 0)
+   {
+      writer->error = httpWriteStream(writer->connection,
+         writer->connection->buffer, writer->length);
+   }
+   writer->length = 0;
+}
+
+/**
+ * formats the response header behind the pending body (see
+ * JSON_WRITER_HEADER_RESERVE) and sends it ahead of the body
+ */
+static void sendHeader(JsonWriter *writer, bool_t chunked)
+{
+   HttpConnection *connection = writer->connection;
+   char_t *header = connection->buffer + writer->length;
+
+   writer->headerSent = TRUE;
+   if (writer->error) return;
+
+   connection->response.version = connection->request.version;
+   connection->response.statusCode = writer->statusCode;
+   connection->response.keepAlive = connection->request.keepAlive;
+   connection->response.noCache = TRUE;
+   connection->response.contentType = "application/json";
+   connection->response.chunkedEncoding = chunked;
+   // not counted in JSON_WRITER_HEADER_RESERVE
+   connection->response.location = NULL;
+   connection->response.allow = NULL;
+   connection->response.contentLength = chunked ? 0 : writer->length;
+
+   // nothing is formatted for http 0.9
+   header[0] = '\0';
+   writer->error = httpFormatResponseHeader(connection, header);
+   if (!writer->error)
+   {
+      writer->error = httpSend(connection, header,
+         strlen(header), HTTP_FLAG_DELAY);
+   }
+}
@@ -0,0 +1,81 @@
+#ifndef __JSON_WRITER_H__
+#define __JSON_WRITER_H__
+
+#include "core/net.h"
+#include "http/http_server.h"
+
+/**
+ * streams a json response straight into connection->buffer, without
+ * building a cJSON tree or a heap string first:
+ *
+ *    JsonWriter writer;
+ *    jsonWriterInit(&writer, connection, 200);
+ *    jsonBeginObject(&writer, NULL);
+ *    jsonAddString(&writer, "message", "done!");
+ *    jsonEndObject(&writer);
+ *    return jsonWriterFinish(&writer);
+ *
+ * a body that fits in the buffer is sent with its Content-Length once
+ * finished (the connection stays alive), a larger one is flushed in
+ * chunks whenever the buffer fills up. (name) is the key of the value
+ * inside an object and NULL inside an array or at the top level.
+ *
+ * errors are sticky: the add functions don't return anything and
+ * jsonWriterFinish reports the first failure.
+ */
+#define JSON_WRITER_MAX_DEPTH 8
+
+/**
+ * the response header is formatted behind the pending body, so the
+ * body may only take the rest of the buffer until the header is sent.
+ * this is the longest header the writer can send, line by line:
+ *   HTTP/1.1 500 Internal Server Error               36
+ *   Connection: keep-alive                           24
+ *   Keep-Alive: timeout=4294967295, max=4294967295   48
+ *   Pragma and Cache-Control (no-cache)             123
+ *   Set-Cookie: (HTTP_SERVER_COOKIE_MAX_LEN chars)   14 + cookie
+ *   Content-Type: application/json                   32
+ *   Content-Length: 18446744073709551615             38
+ *   empty line and null terminator                    3
+ * (the longest reason phrase of http_server_misc.c, crlf included)
+ */
+#define JSON_WRITER_HEADER_RESERVE (318 + HTTP_SERVER_COOKIE_MAX_LEN)
+
+#if (HTTP_SERVER_BUFFER_SIZE <= JSON_WRITER_HEADER_RESERVE)
+   #error HTTP_SERVER_BUFFER_SIZE is too small for the json writer
+#endif
+
+typedef struct _JsonWriter JsonWriter;
+
+struct _JsonWriter
+{
+   HttpConnection *connection;
+   uint_t statusCode;
+   size_t length; // body bytes pending in connection->buffer
+   uint_t depth;
+   uint32_t hasMembers; // bit n: the container at depth n isn't empty
+   bool_t headerSent;
+   error_t error;
+};
+
+// ********************************************************************************************
+
+void jsonWriterInit(JsonWriter *writer,
+   HttpConnection *connection, uint_t statusCode);
+
+void jsonBeginObject(JsonWriter *writer, const char_t *name);
+void jsonEndObject(JsonWriter *writer);
+void jsonBeginArray(JsonWriter *writer, const char_t *name);
+void jsonEndArray(JsonWriter *writer);
+
+void jsonAddString(JsonWriter *writer, const char_t *name, const char_t *value);
+void jsonAddNumber(JsonWriter *writer, const char_t *name, int64_t value);
+void jsonAddBool(JsonWriter *writer, const char_t *name, bool_t value);
+
+/**
+ * sends what is left of the body and closes the output stream.
+ * returns the first error of the writer.
+ */
+error_t jsonWriterFinish(JsonWriter *writer);
+
+#endif
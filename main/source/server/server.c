@@ -1,50 +1,126 @@
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
 #include "esp_system.h"
 #include "core/net.h"
 #include "source/network/network.h"
 #include "http/http_server.h"
 #include "server.h"
 #include "httpHelper.h"
+#include "jsonWriter.h"
 #include "handlers/session.h"
 #include "handlers/handlers.h"
 #include "esp_log.h"
 #include "debug.h"
 
 // application configuration
-#define APP_HTTP_MAX_CONNECTIONS 4
+// requests served at a time, each worker is a task (see HTTP_SERVER_POLL_SUPPORT).
+// the open connections are limited by HTTP_SERVER_MAX_SOCKETS instead
+#define APP_HTTP_WORKERS 4
+// workers that may wait on the k210 at a time (see slowRequestBegin), the
+// rest keep serving pages, logins and config calls meanwhile
+#define APP_HTTP_SLOW_WORKERS (APP_HTTP_WORKERS - 1)
+
+// methods a route accepts (mask)
+#define ROUTE_GET    0x01
+#define ROUTE_POST   0x02
+#define ROUTE_DELETE 0x04
+#define ROUTE_ANY    0xFF // any method, even the ones without a flag
+
+typedef error_t (*RouteHandler)(HttpConnection *connection);
+typedef struct _Route Route;
+
+struct _Route
+{
+   const char_t *path;
+   uint8_t methods;     // ROUTE_* mask
+   bool_t auth;         // only served to logged in users
+   bool_t slow;         // always waits on the k210 (up to seconds)
+   RouteHandler handler;
+   atomic_uint hits;    // requests passed to the handler
+};
 
 // global variables
 HttpServerSettings httpServerSettings;
 HttpServerContext httpServerContext;
-HttpConnection httpConnections[APP_HTTP_MAX_CONNECTIONS];
+HttpConnection httpConnections[APP_HTTP_WORKERS];
+static OsSemaphore slowRequests;
 
 // ********************************************************************************************
 // forward declaration of functions
 
-error_t httpServerRouter(
-	HttpConnection *connection, const char_t *uri);
-
-error_t routerHelper(HttpConnection *connection,
-	const char_t *uri, User *currentUser);
+error_t httpServerRouter(HttpConnection *connection, const char_t *uri);
+static Route* findRoute(const char_t *uri);
+static int compareRoute(const void *uri, const void *route);
+static uint8_t methodMask(const char_t *method);
+static error_t redirectToLogin(HttpConnection *connection);
+static error_t methodNotAllowed(HttpConnection *connection, const Route *route);
+static bool_t checkRouteTable();
+static error_t publicFileHandler(HttpConnection *connection);
+static error_t resetHandler(HttpConnection *connection);
+static error_t routesHandler(HttpConnection *connection);
+bool_t slowRequestBegin();
+void slowRequestEnd();
 
 error_t httpServerUriNotFoundCallback(
    HttpConnection *connection, const char_t *uri);
 
 // ********************************************************************************************
 
+/**
+ * the api endpoints and the pages that are served without a login.
+ * ! must stay sorted by path (strcmp order), it is binary searched !
+ *
+ * handlers only see the methods their route allows, anything else
+ * is answered with 405 here. uris that are not in the table are
+ * static pages served by the http server (for logged in users).
+ * slow routes run in a slowRequestBegin slot and are answered with 503
+ * when none is free (the k210 serves one of them at a time anyway).
+ * /ai and /link only wait on the k210 for some requests, their
+ * handlers take the slot themselves.
+ */
+static Route routes[] =
+{
+   { "/ai",          ROUTE_GET | ROUTE_POST, TRUE,  FALSE, getAIHandler },
+   { "/apwifi",      ROUTE_GET | ROUTE_POST, TRUE,  FALSE, apWifiConfigHandler },
+   { "/autoconfig",  ROUTE_GET | ROUTE_POST, TRUE,  TRUE,  autoConfigHandler },
+   { "/camera",      ROUTE_GET,              TRUE,  TRUE,  cameraImgHandler },
+   { "/config",      ROUTE_POST,             TRUE,  FALSE, imgConfigHandler },
+   { "/digits",      ROUTE_GET,              TRUE,  TRUE,  cameraDigitsHandler },
+   { "/lan",         ROUTE_GET | ROUTE_POST, TRUE,  FALSE, lanConfigHandler },
+   { "/link",        ROUTE_GET | ROUTE_POST, TRUE,  FALSE, linkSpeedHandler },
+   { "/login",       ROUTE_ANY,              FALSE, FALSE, loginHandler },
+   { "/login.html",  ROUTE_GET,              FALSE, FALSE, publicFileHandler },
+   { "/mqttConfig",  ROUTE_GET | ROUTE_POST, TRUE,  FALSE, mqttConfigHandler },
+   { "/reset",       ROUTE_GET | ROUTE_POST, TRUE,  FALSE, resetHandler },
+   { "/roi",         ROUTE_GET,              TRUE,  TRUE,  cameraRoiHandler },
+   { "/routes",      ROUTE_GET,              TRUE,  FALSE, routesHandler },
+   { "/stawifi",     ROUTE_GET | ROUTE_POST, TRUE,  FALSE, staWifiConfigHandler },
+   { "/styles.css",  ROUTE_GET,              FALSE, FALSE, publicFileHandler },
+};
+
+#define ROUTE_COUNT (sizeof(routes) / sizeof(Route))
+
+// ********************************************************************************************
+
 void initializeHttpServer()
 {
    error_t error;
    initSessionHandler();
 
+   if (!checkRouteTable())
+      TRACE_ERROR("The route table is not sorted!\r\n");
+
+   if (!osCreateSemaphore(&slowRequests, APP_HTTP_SLOW_WORKERS))
+      TRACE_ERROR("Failed to create the slow request semaphore!\r\n");
+
    httpServerGetDefaultSettings(&httpServerSettings);
    // bind HTTP server to a desired interface
    httpServerSettings.interface = NULL;
 
    // listen on port 80
    httpServerSettings.port = HTTP_PORT;
-   httpServerSettings.maxConnections = APP_HTTP_MAX_CONNECTIONS;
+   httpServerSettings.maxConnections = APP_HTTP_WORKERS;
    httpServerSettings.connections = httpConnections;
    strcpy(httpServerSettings.rootDirectory, "/");
    strcpy(httpServerSettings.defaultDocument, "index.html");
@@ -71,66 +147,128 @@ void initializeHttpServer()
  */
 error_t httpServerRouter(HttpConnection *connection, const char_t *uri)
 {
-   if(!strcmp(uri, "/login.html") ||
-      !strcmp(uri, "/styles.css"))
-   {
-      // serve public content without authentication
-      return httpSendResponse(connection, uri);
-   }
+   Route *route = findRoute(uri);
+   bool_t auth = route == NULL || route->auth;
 
-   if (!strcmp(uri, "/login"))
-      return loginHandler(connection);
+   // block request if not logged in
+   if (auth && !findLoggedInUser(connection))
+      return redirectToLogin(connection);
 
-   User *currentUser = findLoggedInUser(connection);
+   // static content, served by the http server
+   if (route == NULL)
+      return ERROR_NOT_FOUND;
 
-   // block request if not logged in
-   if (!currentUser)
-   {
-      connection->response.location = "/login.html";
-      error_t error = httpSendHeaderManual(connection, 302, NULL, 0);
-      if (error) return error;
-      return httpCloseStream(connection);
-   }
+   if (route->methods != ROUTE_ANY &&
+      !(route->methods & methodMask(connection->request.method)))
+      return methodNotAllowed(connection, route);
+
+   atomic_fetch_add_explicit(&route->hits, 1, memory_order_relaxed);
+   if (!route->slow)
+      return route->handler(connection);
 
-   return routerHelper(connection, uri, currentUser);
+   if (!slowRequestBegin())
+      return httpSendBusyManual(connection);
+
+   error_t error = route->handler(connection);
+   slowRequestEnd();
+   return error;
 }
 
 // ********************************************************************************************
 
-error_t routerHelper(HttpConnection *connection,
-	const char_t *uri, User *currentUser)
+// keeps a worker for the requests that don't wait on the k210
+bool_t slowRequestBegin()
 {
-   // use handler functions (API)
-   if (!strcmp(uri, "/config"))
-      return imgConfigHandler(connection);
+   return osWaitForSemaphore(&slowRequests, 0);
+}
 
-   if (!strcmp(uri, "/camera"))
-      return cameraImgHandler(connection);
+void slowRequestEnd()
+{
+   osReleaseSemaphore(&slowRequests);
+}
 
-   if (!strcmp(uri, "/ai"))
-      return getAIHandler(connection);
+// ********************************************************************************************
+
+static Route* findRoute(const char_t *uri)
+{
+   return (Route*) bsearch(uri, routes, ROUTE_COUNT, sizeof(Route), compareRoute);
+}
 
-   if (!strcmp(uri, "/mqttConfig"))
-      return mqttConfigHandler(connection);
+static int compareRoute(const void *uri, const void *route)
+{
+   return strcmp((const char_t*) uri, ((const Route*) route)->path);
+}
 
-   if (!strcmp(uri, "/lan"))
-      return lanConfigHandler(connection);
-   
-   if (!strcmp(uri, "/stawifi"))
-      return staWifiConfigHandler(connection);
+static uint8_t methodMask(const char_t *method)
+{
+   if (!strcmp(method, "GET")) return ROUTE_GET;
+   if (!strcmp(method, "POST")) return ROUTE_POST;
+   if (!strcmp(method, "DELETE")) return ROUTE_DELETE;
+   return 0;
+}
 
-   if (!strcmp(uri, "/apwifi"))
-      return apWifiConfigHandler(connection);
-   
-   if (!strcmp(uri, "/reset"))
+// the table is written by hand, a misplaced entry would be unreachable
+static bool_t checkRouteTable()
+{
+   for (uint_t i = 1; i < ROUTE_COUNT; i++)
    {
-      apiSendSuccessManual(connection, "done!");
-      osDelayTask(50);
-      esp_restart();
-      return NO_ERROR;
+      if (strcmp(routes[i-1].path, routes[i].path) >= 0)
+         return FALSE;
    }
+   return TRUE;
+}
 
-   return ERROR_NOT_FOUND;
+// ********************************************************************************************
+
+static error_t redirectToLogin(HttpConnection *connection)
+{
+   connection->response.location = "/login.html";
+   error_t error = httpSendHeaderManual(connection, 302, NULL, 0);
+   if (error) return error;
+   return httpCloseStream(connection);
+}
+
+// answers 405 with the allowed methods in the Allow header
+static error_t methodNotAllowed(HttpConnection *connection, const Route *route)
+{
+   char_t allow[20] = "";
+   if (route->methods & ROUTE_GET) strcat(allow, ", GET");
+   if (route->methods & ROUTE_POST) strcat(allow, ", POST");
+   if (route->methods & ROUTE_DELETE) strcat(allow, ", DELETE");
+
+   connection->response.allow = allow + 2;
+   return httpSendManual(connection, 405, "text/plain", "method not allowed");
+}
+
+// ********************************************************************************************
+
+// serves public content without authentication
+static error_t publicFileHandler(HttpConnection *connection)
+{
+   return httpSendResponse(connection, connection->request.uri);
+}
+
+static error_t resetHandler(HttpConnection *connection)
+{
+   apiSendSuccessManual(connection, "done!");
+   osDelayTask(50);
+   esp_restart();
+   return NO_ERROR;
+}
+
+// sends the hit counter of every route as {"path": hits, ...}
+static error_t routesHandler(HttpConnection *connection)
+{
+   JsonWriter writer;
+   jsonWriterInit(&writer, connection, 200);
+   jsonBeginObject(&writer, NULL);
+   for (uint_t i = 0; i < ROUTE_COUNT; i++)
+   {
+      jsonAddNumber(&writer, routes[i].path, atomic_load_explicit(
+         &routes[i].hits, memory_order_relaxed));
+   }
+   jsonEndObject(&writer);
+   return jsonWriterFinish(&writer);
 }
 
 // ********************************************************************************************
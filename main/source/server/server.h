@@ -1,6 +1,16 @@
 #ifndef __ROUTER_H__
 #define __ROUTER_H__
 
+#include "os_port.h"
+
 void initializeHttpServer();
 
+/**
+ * takes one of the APP_HTTP_SLOW_WORKERS slots for a request that waits
+ * on the k210, FALSE if they are all taken (answer httpSendBusyManual).
+ * slowRequestEnd gives the slot back.
+ */
+bool_t slowRequestBegin();
+void slowRequestEnd();
+
 #endif
\ No newline at end of file
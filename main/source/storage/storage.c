@@ -2,6 +2,9 @@
 #include <stdbool.h>
 #include <string.h>
 #include "storage.h"
+#include "source/mqtt/aiTask.h"
+#include "source/serial/linkSpeed.h"
+#include "source/utils/imgConfigParser.h"
 #include "esp_log.h"
 
 #define LOG_TAG "storage"
@@ -14,6 +17,8 @@
 #define NVS_users_KEY "users"
 #define NVS_meterCounter_KEY "meterCounter"
 #define NVS_mqttConfig_VAR "mqttConfig"
+#define NVS_aiSampleInterval_KEY "aiInterval"
+#define NVS_linkBaudRate_KEY "linkBaud"
 
 #define DEFAULT_USERNAME "admin#"
 #define DEFAULT_PASSWORD "test1234"
@@ -29,6 +34,8 @@ void retrieveImgConfig(ImgConfig *imgConfig);
 void retrieveUsers(User *users);
 void retrieveMeterCounter(char_t *meterCounter);
 void retrieveMqttConfig(MqttConfig *mqttConfig);
+void retrieveAiSampleInterval(uint32_t *interval);
+void retrieveLinkBaudRate(uint32_t *baudRate);
 
 bool_t saveLanConfig(LanConfig *lanConfig);
 bool_t saveStaWifiConfig(StaWifiConfig *staWifiConfig);
@@ -37,6 +44,8 @@ bool_t saveImgConfig(ImgConfig *imgConfig);
 bool_t saveUsers(User *users);
 bool_t saveMeterCounter(char_t *meterCounter);
 bool_t saveMqttConfig(MqttConfig *mqttConfig);
+bool_t saveAiSampleInterval(uint32_t interval);
+bool_t saveLinkBaudRate(uint32_t baudRate);
 
 void setDefaultUsers(User *users);
 
@@ -60,6 +69,10 @@ bool_t retrieveEnvironment(Environment *appEnv)
    retrieveMeterCounter(appEnv->meterCounter);
    osDelayTask(50);
    retrieveMqttConfig(&appEnv->mqttConfig);
+   osDelayTask(50);
+   retrieveAiSampleInterval(&appEnv->aiSampleInterval);
+   osDelayTask(50);
+   retrieveLinkBaudRate(&appEnv->linkBaudRate);
 
    nvsFinish();
    return TRUE;
@@ -118,13 +131,20 @@ bool_t saveApWifiConfig(ApWifiConfig *apWifiConfig)
 
 // ********************************************************************************************
 
+/**
+ * blobs saved before the multi-meter layout are shorter and leave
+ * the meters zeroed, their digits are loaded as one meter
+ */
 void retrieveImgConfig(ImgConfig *imgConfig)
 {
+   memset(imgConfig, 0, sizeof(ImgConfig));
    bool_t result = nvsGetBlob(
       NVS_imgConfig_KEY, imgConfig, sizeof(ImgConfig));
    
    if (!result)
       imgConfig->isConfigured = FALSE;
+   else if (imgConfig->meterCount == 0)
+      imgConfigSingleMeter(imgConfig);
 }
 
 bool_t saveImgConfig(ImgConfig *imgConfig)
@@ -197,3 +217,38 @@ bool_t saveMqttConfig(MqttConfig *mqttConfig)
 }
 
 // ********************************************************************************************
+
+void retrieveAiSampleInterval(uint32_t *interval)
+{
+   bool_t result = nvsGetBlob(
+      NVS_aiSampleInterval_KEY, interval, sizeof(uint32_t));
+
+   if (!result)
+      *interval = AI_DEFAULT_SAMPLE_INTERVAL_MS;
+}
+
+bool_t saveAiSampleInterval(uint32_t interval)
+{
+   return nvsSetBlob(
+      NVS_aiSampleInterval_KEY, &interval, sizeof(uint32_t));
+}
+
+// ********************************************************************************************
+
+void retrieveLinkBaudRate(uint32_t *baudRate)
+{
+   bool_t result = nvsGetBlob(
+      NVS_linkBaudRate_KEY, baudRate, sizeof(uint32_t));
+
+   // never negotiated, try the fastest rate
+   if (!result)
+      *baudRate = LINK_MAX_BAUD_RATE;
+}
+
+bool_t saveLinkBaudRate(uint32_t baudRate)
+{
+   return nvsSetBlob(
+      NVS_linkBaudRate_KEY, &baudRate, sizeof(uint32_t));
+}
+
+// ********************************************************************************************
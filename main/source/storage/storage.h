@@ -14,5 +14,7 @@ bool_t saveImgConfig(ImgConfig *imgConfig);
 bool_t saveUsers(User *users);
 bool_t saveMeterCounter(char_t *meterCounter);
 bool_t saveMqttConfig(MqttConfig *mqttConfig);
+bool_t saveAiSampleInterval(uint32_t interval);
+bool_t saveLinkBaudRate(uint32_t baudRate);
 
 #endif
\ No newline at end of file
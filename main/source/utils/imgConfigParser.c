@@ -13,6 +13,11 @@ bool_t parseHelper(ImgConfig *imgConfig, cJSON *root);
 bool_t fillAttributes(ImgConfig *imgConfig, cJSON *root);
 bool_t fillPositionArray(ImgConfig *imgConfig, cJSON *arrNode);
 bool_t extractPosition(Position *position, cJSON *child);
+bool_t fillMeterArray(ImgConfig *imgConfig, cJSON *arrNode);
+bool_t extractMeter(ImgConfig *imgConfig, uint_t index, cJSON *child);
+void sortMeterPositions(ImgConfig *imgConfig);
+void imgConfigSingleMeter(ImgConfig *imgConfig);
+void imgConfigWriteJson(JsonWriter *writer, ImgConfig *imgConfig);
 
 // ********************************************************************************************
 
@@ -50,7 +55,18 @@ bool_t parseHelper(ImgConfig *imgConfig, cJSON *root)
    cJSON* arrNode  = cJSON_GetObjectItem(root, "rectanglePositions");
    if (!cJSON_IsArray(arrNode)) return FALSE;
 
-   return fillPositionArray(imgConfig, arrNode);
+   if (!fillPositionArray(imgConfig, arrNode))
+      return FALSE;
+
+   // configs without "meters" describe a single meter
+   arrNode = cJSON_GetObjectItem(root, "meters");
+   if (arrNode == NULL)
+      imgConfigSingleMeter(imgConfig);
+   else if (!cJSON_IsArray(arrNode) || !fillMeterArray(imgConfig, arrNode))
+      return FALSE;
+
+   sortMeterPositions(imgConfig);
+   return TRUE;
 }
 
 // ********************************************************************************************
@@ -117,3 +133,133 @@ bool_t extractPosition(Position *position, cJSON *child)
 }
 
 // ********************************************************************************************
+
+/**
+ * parse the [{"name", "digitCount"}, ...] meter list, the meters take
+ * the rectangles in order and must cover all of them
+ */
+bool_t fillMeterArray(ImgConfig *imgConfig, cJSON *arrNode)
+{
+   int_t count = cJSON_GetArraySize(arrNode);
+   if (count < 1 || count > MAX_METER_COUNT)
+      return FALSE;
+
+   imgConfig->meterCount = count;
+   uint_t digitCount = 0;
+
+   for (int_t i = 0; i < count; i++)
+   {
+      cJSON* child = cJSON_GetArrayItem(arrNode, i);
+      if (!extractMeter(imgConfig, i, child)) return FALSE;
+      digitCount += imgConfig->meters[i].digitCount;
+   }
+
+   return digitCount == imgConfig->digitCount;
+}
+
+// ********************************************************************************************
+
+/**
+ * parse the name and digitCount of the (index)th meter, names must be
+ * unique since they identify the readings in "/ai" and mqtt
+ */
+bool_t extractMeter(ImgConfig *imgConfig, uint_t index, cJSON *child)
+{
+   MeterConfig *meter = &(imgConfig->meters[index]);
+
+   cJSON* attribute = cJSON_GetObjectItem(child, "name");
+   char_t *name = cJSON_GetStringValue(attribute);
+   if (name == NULL || name[0] == '\0' || strlen(name) > METER_NAME_LENGTH)
+      return FALSE;
+   strcpy(meter->name, name);
+
+   for (uint_t i = 0; i < index; i++)
+   {
+      if (!strcmp(imgConfig->meters[i].name, name))
+         return FALSE;
+   }
+
+   attribute = cJSON_GetObjectItem(child, "digitCount");
+   if (!cJSON_IsNumber(attribute)) return FALSE;
+
+   double digitCount = cJSON_GetNumberValue(attribute);
+   if (digitCount < 1 || digitCount > MAX_DIGIT_COUNT)
+      return FALSE;
+   meter->digitCount = digitCount;
+
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+/**
+ * orders the rectangles of each meter from left to right, which is
+ * the order the digits of its reading are infered in
+ */
+void sortMeterPositions(ImgConfig *imgConfig)
+{
+   Position *positions = imgConfig->positions;
+
+   for (uint_t m = 0; m < imgConfig->meterCount; m++)
+   {
+      uint_t count = imgConfig->meters[m].digitCount;
+
+      // insertion sort, a meter has only a few digits
+      for (uint_t i = 1; i < count; i++)
+      {
+         Position position = positions[i];
+         uint_t j = i;
+         for (; j > 0 && positions[j-1].x > position.x; j--)
+            positions[j] = positions[j-1];
+         positions[j] = position;
+      }
+
+      positions += count;
+   }
+}
+
+// ********************************************************************************************
+
+void imgConfigSingleMeter(ImgConfig *imgConfig)
+{
+   imgConfig->meterCount = 1;
+   strcpy(imgConfig->meters[0].name, DEFAULT_METER_NAME);
+   imgConfig->meters[0].digitCount = imgConfig->digitCount;
+}
+
+// ********************************************************************************************
+
+void imgConfigWriteJson(JsonWriter *writer, ImgConfig *imgConfig)
+{
+   jsonBeginObject(writer, NULL);
+   jsonAddNumber(writer, "digitCount", imgConfig->digitCount);
+   jsonAddBool(writer, "invert", imgConfig->invert);
+
+   jsonBeginArray(writer, "rectanglePositions");
+   for (uint_t i = 0; i < imgConfig->digitCount; i++)
+   {
+      Position *position = &(imgConfig->positions[i]);
+      jsonBeginObject(writer, NULL);
+      jsonAddNumber(writer, "x", position->x);
+      jsonAddNumber(writer, "y", position->y);
+      jsonAddNumber(writer, "width", position->width);
+      jsonAddNumber(writer, "height", position->height);
+      jsonEndObject(writer);
+   }
+   jsonEndArray(writer);
+
+   jsonBeginArray(writer, "meters");
+   for (uint_t i = 0; i < imgConfig->meterCount; i++)
+   {
+      MeterConfig *meter = &(imgConfig->meters[i]);
+      jsonBeginObject(writer, NULL);
+      jsonAddString(writer, "name", meter->name);
+      jsonAddNumber(writer, "digitCount", meter->digitCount);
+      jsonEndObject(writer);
+   }
+   jsonEndArray(writer);
+
+   jsonEndObject(writer);
+}
+
+// ********************************************************************************************
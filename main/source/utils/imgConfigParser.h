@@ -2,7 +2,17 @@
 #define __IMG_CONFIG_PARSER__
 
 #include "source/envTypes.h"
+#include "source/server/jsonWriter.h"
+
+// name of the meter of configs that don't list their meters
+#define DEFAULT_METER_NAME "meter"
 
 bool_t parseImgConfig(ImgConfig *imgConfig, char_t *data);
 
+// makes all the digits of (imgConfig) one meter named DEFAULT_METER_NAME
+void imgConfigSingleMeter(ImgConfig *imgConfig);
+
+// same layout as the json accepted by parseImgConfig
+void imgConfigWriteJson(JsonWriter *writer, ImgConfig *imgConfig);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,9 @@
+#!/bin/sh
+# builds the host benchmark (digitBench) from the firmware sources
+cd "$(dirname "$0")"
+MAIN=../../main
+
+gcc -O2 -std=gnu11 -Wall -DIDF_VER=\"host\" -D__error_t_defined \
+   -I../uartBench/hostPort -I$MAIN -I$MAIN/common \
+   digitBench.c $MAIN/source/camera/digitPrep.c \
+   -o digitBench
@@ -0,0 +1,229 @@
+/**
+ * times the digit preprocessing kernels (main/source/camera/digitPrep.c)
+ * on a linux host and checks the crops against the python reference.
+ *
+ * usage: digitBench <image.pgm> <invert 0|1> <x,y,w,h>... [-g golden.bin] [-n iterations]
+ *
+ * with -g the 28x28 crops must match the file written by
+ * digitPrepRef.py byte for byte, otherwise the exit status is 1.
+ * see build.sh for the build and README.md for a complete run.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "os_port.h"
+#include "source/camera/digitPrep.h"
+
+#define MAX_RECTS 16
+
+typedef struct _Frame Frame;
+
+struct _Frame
+{
+   uint_t width;
+   uint_t height;
+   uint8_t *pixels;
+};
+
+// ********************************************************************************************
+// forward declaration of functions
+
+static bool_t readPgm(const char *path, Frame *frame);
+static int64_t nowNs();
+static DigitWindow frameWindow(const Frame *frame, const uint_t *rect);
+static int checkGolden(const char *path, const uint8_t *crops, uint_t count);
+static void benchKernels(const Frame *frame, uint_t rects[][4],
+   uint_t count, bool_t invert, uint_t iterations);
+
+// ********************************************************************************************
+
+int main(int argc, char **argv)
+{
+   if (argc < 4) {
+      fprintf(stderr, "usage: %s <image.pgm> <invert 0|1> <x,y,w,h>... "
+         "[-g golden.bin] [-n iterations]\n", argv[0]);
+      return 1;
+   }
+
+   Frame frame;
+   if (!readPgm(argv[1], &frame)) return 1;
+   bool_t invert = atoi(argv[2]) != 0;
+
+   uint_t rects[MAX_RECTS][4];
+   uint_t count = 0, iterations = 200;
+   const char *golden = NULL;
+
+   for (int i = 3; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "-g") && i + 1 < argc)
+         golden = argv[++i];
+      else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+         iterations = atoi(argv[++i]);
+      else if (count < MAX_RECTS && sscanf(argv[i], "%u,%u,%u,%u", &rects[count][0],
+         &rects[count][1], &rects[count][2], &rects[count][3]) == 4)
+      {
+         if (rects[count][0] + rects[count][2] > frame.width ||
+            rects[count][1] + rects[count][3] > frame.height) {
+            fprintf(stderr, "%s is outside the frame\n", argv[i]);
+            return 1;
+         }
+         count++;
+      }
+      else {
+         fprintf(stderr, "bad argument: %s\n", argv[i]);
+         return 1;
+      }
+   }
+
+   // one pass on a copy for the golden check (windows are changed in place)
+   uint8_t *crops = malloc(count * DIGIT_CROP_PIXELS);
+   DigitScratch *scratch = malloc(sizeof(DigitScratch));
+   Frame work = frame;
+   work.pixels = malloc(frame.width * frame.height);
+   memcpy(work.pixels, frame.pixels, frame.width * frame.height);
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      DigitWindow window = frameWindow(&work, rects[i]);
+      digitPrepare(&window, invert, scratch, crops + i * DIGIT_CROP_PIXELS);
+   }
+
+   int status = golden ? checkGolden(golden, crops, count) : 0;
+   benchKernels(&frame, rects, count, invert, iterations);
+
+   free(work.pixels);
+   free(scratch);
+   free(crops);
+   free(frame.pixels);
+   return status;
+}
+
+// ********************************************************************************************
+
+static bool_t readPgm(const char *path, Frame *frame)
+{
+   FILE *f = fopen(path, "rb");
+   uint_t maxValue = 0;
+   if (f == NULL || fscanf(f, "P5 %u %u %u", &frame->width,
+      &frame->height, &maxValue) != 3 || maxValue != 255 || fgetc(f) == EOF) {
+      fprintf(stderr, "%s: only 8-bit binary pgm is supported\n", path);
+      if (f) fclose(f);
+      return FALSE;
+   }
+
+   size_t size = frame->width * frame->height;
+   frame->pixels = malloc(size);
+   bool_t ok = fread(frame->pixels, 1, size, f) == size;
+   fclose(f);
+
+   if (!ok) fprintf(stderr, "%s: truncated image\n", path);
+   return ok;
+}
+
+static int64_t nowNs()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static DigitWindow frameWindow(const Frame *frame, const uint_t *rect)
+{
+   DigitWindow window = {
+      frame->pixels + rect[1] * frame->width + rect[0],
+      rect[2], rect[3], frame->width
+   };
+   return window;
+}
+
+// ********************************************************************************************
+
+static int checkGolden(const char *path, const uint8_t *crops, uint_t count)
+{
+   size_t size = count * DIGIT_CROP_PIXELS;
+   uint8_t *golden = malloc(size + 1);
+
+   FILE *f = fopen(path, "rb");
+   size_t length = f ? fread(golden, 1, size + 1, f) : 0;
+   if (f) fclose(f);
+
+   if (length != size) {
+      printf("golden     %s holds %zu bytes, expected %zu\n", path, length, size);
+      free(golden);
+      return 1;
+   }
+
+   uint_t mismatches = 0;
+   for (size_t i = 0; i < size; i++)
+   {
+      if (crops[i] == golden[i]) continue;
+      if (mismatches++ < 8)
+         printf("golden     digit %zu pixel (%zu, %zu): %u, reference %u\n",
+            i / DIGIT_CROP_PIXELS, i % DIGIT_CROP_SIZE,
+            i % DIGIT_CROP_PIXELS / DIGIT_CROP_SIZE, crops[i], golden[i]);
+   }
+
+   printf("golden     %u digits, %u mismatching pixels\n", count, mismatches);
+   free(golden);
+   return mismatches ? 1 : 0;
+}
+
+// ********************************************************************************************
+
+/**
+ * every kernel runs over all windows (iterations) times on a fresh copy
+ * of the frame, the time per digit and the window throughput are reported
+ */
+static void benchKernels(const Frame *frame, uint_t rects[][4],
+   uint_t count, bool_t invert, uint_t iterations)
+{
+   static const char *names[] = {
+      "histogram", "stretch", "otsu", "lut", "binarize", "resize", "prepare"
+   };
+   const uint_t kernels = sizeof(names) / sizeof(names[0]);
+
+   size_t pixels = 0;
+   for (uint_t i = 0; i < count; i++)
+      pixels += rects[i][2] * rects[i][3];
+
+   DigitScratch *scratch = malloc(sizeof(DigitScratch));
+   uint8_t crop[DIGIT_CROP_PIXELS];
+   Frame work = *frame;
+   work.pixels = malloc(frame->width * frame->height);
+
+   for (uint_t k = 0; k < kernels; k++)
+   {
+      int64_t spent = 0;
+      for (uint_t n = 0; n < iterations; n++)
+      {
+         memcpy(work.pixels, frame->pixels, frame->width * frame->height);
+         int64_t start = nowNs();
+
+         for (uint_t i = 0; i < count; i++)
+         {
+            DigitWindow window = frameWindow(&work, rects[i]);
+            switch (k)
+            {
+               case 0: digitHistogram(&window, scratch); break;
+               case 1: digitStretchLut(scratch, invert); break;
+               case 2: digitOtsuThreshold(scratch); break;
+               case 3: digitApplyLut(&window, scratch->lut); break;
+               case 4: digitBinarize(&window, 128); break;
+               case 5: digitResizeArea(&window, scratch, crop); break;
+               default: digitPrepare(&window, invert, scratch, crop); break;
+            }
+         }
+
+         spent += nowNs() - start;
+      }
+
+      double perDigit = (double) spent / iterations / count;
+      printf("%-10s %9.0f ns/digit  %8.1f MB/s\n", names[k], perDigit,
+         k == 1 || k == 2 ? 0.0 : pixels * 1e3 * iterations / spent);
+   }
+
+   free(work.pixels);
+   free(scratch);
+}
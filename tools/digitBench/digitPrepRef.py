@@ -0,0 +1,168 @@
+"""
+python reference of main/source/camera/digitPrep.c, used to produce
+the golden crops that digitBench checks the C kernels against.
+
+usage:
+    python3 digitPrepRef.py synth out.pgm
+        writes a synthetic 320x240 meter-like frame
+    python3 digitPrepRef.py crops image.pgm invert x,y,w,h [x,y,w,h ...] out.bin
+        writes the 28x28 grayscale crop of every window (784 bytes each)
+
+the arithmetic is the same integer (and double) arithmetic as the C
+code, so the outputs must match byte for byte.
+"""
+
+import random, sys
+
+CROP_SIZE = 28
+FRAC_BITS = 8
+
+def readPgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    fields, pos = [], 0
+    while len(fields) < 4:
+        while data[pos:pos+1].isspace(): pos += 1
+        if data[pos:pos+1] == b"#":
+            pos = data.index(b"\n", pos)
+            continue
+        end = pos
+        while not data[end:end+1].isspace(): end += 1
+        fields.append(data[pos:end])
+        pos = end
+
+    if fields[0] != b"P5" or int(fields[3]) != 255:
+        raise ValueError(path + ": only 8-bit binary pgm is supported")
+
+    width, height = int(fields[1]), int(fields[2])
+    return width, height, bytearray(data[pos+1: pos+1 + width*height])
+
+def writePgm(path, width, height, pixels):
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (width, height))
+        f.write(bytes(pixels))
+
+# ********************************************************************************************
+
+def stretchLut(histogram, invert):
+    low, high = 0, 255
+    while low < 255 and histogram[low] == 0: low += 1
+    while high > 0 and histogram[high] == 0: high -= 1
+    if invert: low, high = 255 - high, 255 - low
+
+    lut, span = [], high - low
+    for v in range(256):
+        x = 255 - v if invert else v
+        if span <= 0: lut.append(x)
+        elif x <= low: lut.append(0)
+        elif x >= high: lut.append(255)
+        else: lut.append(((x - low) * 255 + span // 2) // span)
+    return lut
+
+def otsuThreshold(histogram):
+    total = sum(histogram)
+    sumAll = sum(v * n for v, n in enumerate(histogram))
+
+    w0 = sum0 = 0
+    best, threshold = 0.0, 128
+    for t in range(255):
+        w0 += histogram[t]
+        sum0 += t * histogram[t]
+        if w0 == 0: continue
+        w1 = total - w0
+        if w1 == 0: break
+
+        diff = sum0 / w0 - (sumAll - sum0) / w1
+        between = float(w0) * w1 * diff * diff
+        if between > best:
+            best, threshold = between, t + 1
+    return threshold
+
+def resizeArea(window, width, height):
+    if width == 0 or height == 0: return bytes(CROP_SIZE * CROP_SIZE)
+
+    size = max(width, height)
+    left, top = (size - width) // 2, (size - height) // 2
+    edge = [(d * size << FRAC_BITS) // CROP_SIZE for d in range(CROP_SIZE + 1)]
+
+    def overlap(start, end, pixel):
+        low, high = max(start, pixel << FRAC_BITS), min(end, (pixel + 1) << FRAC_BITS)
+        return high - low if high > low else 0
+
+    sums = [0] * (CROP_SIZE * CROP_SIZE)
+    for y in range(height):
+        rowSums = []
+        for dx in range(CROP_SIZE):
+            first = max(edge[dx] >> FRAC_BITS, left)
+            last = min((edge[dx+1] - 1) >> FRAC_BITS, left + width - 1)
+            rowSums.append(sum(window[y*width + x - left] * overlap(edge[dx], edge[dx+1], x)
+                for x in range(first, last + 1)))
+
+        for dy in range(CROP_SIZE):
+            weight = overlap(edge[dy], edge[dy+1], top + y)
+            for dx in range(CROP_SIZE):
+                sums[dy*CROP_SIZE + dx] += rowSums[dx] * weight
+
+    crop = bytearray(CROP_SIZE * CROP_SIZE)
+    for dy in range(CROP_SIZE):
+        for dx in range(CROP_SIZE):
+            area = (edge[dy+1] - edge[dy]) * (edge[dx+1] - edge[dx])
+            crop[dy*CROP_SIZE + dx] = (sums[dy*CROP_SIZE + dx] + area // 2) // area
+    return crop
+
+def prepare(frame, frameWidth, rect, invert):
+    x, y, width, height = rect
+    window = bytearray()
+    for row in range(y, y + height):
+        window.extend(frame[row*frameWidth + x: row*frameWidth + x + width])
+
+    histogram = [0] * 256
+    for p in window: histogram[p] += 1
+
+    lut = stretchLut(histogram, invert)
+    stretched = [0] * 256
+    for v in range(256): stretched[lut[v]] += histogram[v]
+
+    threshold = otsuThreshold(stretched)
+    lut = [255 if v >= threshold else 0 for v in lut]
+    window = bytes(lut[p] for p in window)
+    return resizeArea(window, width, height)
+
+# ********************************************************************************************
+
+def synthFrame(width=320, height=240, seed=1):
+    """ dark digits on a lit gradient with some noise """
+    rnd = random.Random(seed)
+    pixels = bytearray(width * height)
+    for y in range(height):
+        for x in range(width):
+            pixels[y*width + x] = min(255, 120 + x // 4 + rnd.randrange(24))
+
+    for digit in range(5):
+        x0, y0 = 40 + digit * 48, 90
+        for y in range(y0, y0 + 60):
+            for x in range(x0, x0 + 36):
+                stroke = (x - x0 < 6) or (x - x0 >= 30) or (y - y0 < 6) or \
+                    (y - y0 >= 54) or (digit % 2 and abs(y - y0 - 30) < 3)
+                if stroke: pixels[y*width + x] = 30 + rnd.randrange(20)
+    return width, height, pixels
+
+def main():
+    if len(sys.argv) == 3 and sys.argv[1] == "synth":
+        writePgm(sys.argv[2], *synthFrame())
+        return
+
+    if len(sys.argv) < 6 or sys.argv[1] != "crops":
+        print(__doc__)
+        sys.exit(1)
+
+    width, height, frame = readPgm(sys.argv[2])
+    invert = sys.argv[3] != "0"
+    rects = [tuple(int(v) for v in arg.split(",")) for arg in sys.argv[4:-1]]
+
+    with open(sys.argv[-1], "wb") as f:
+        for rect in rects: f.write(prepare(frame, width, rect, invert))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,11 @@
+#!/bin/sh
+# builds the trainer (digitTrain) and the accuracy / throughput harness
+# (digitEval) of the fallback digit classifier
+cd "$(dirname "$0")"
+MAIN=../../main
+FLAGS="-O2 -std=gnu11 -Wall -DIDF_VER=\"host\" -D__error_t_defined \
+   -I../uartBench/hostPort -I$MAIN -I$MAIN/common"
+
+gcc $FLAGS digitTrain.c $MAIN/source/camera/digitPrep.c -lm -o digitTrain &&
+gcc $FLAGS digitEval.c $MAIN/source/ai/digitClassifier.c \
+   $MAIN/source/ai/digitModel.c -lm -o digitEval
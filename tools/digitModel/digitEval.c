@@ -0,0 +1,179 @@
+/**
+ * accuracy and throughput harness of the fallback digit classifier
+ * (main/source/ai/digitClassifier.c) on a linux host.
+ *
+ * usage: digitEval <set.bin> [-n iterations] [-m min accuracy %]
+ *
+ * the set holds one record per crop: the label byte followed by the
+ * 28x28 grayscale crop (digitTrain set writes one). the exit status is
+ * 1 when the accuracy is below the -m limit.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "os_port.h"
+#include "source/ai/digitClassifier.h"
+
+#define RECORD_SIZE (1 + DIGIT_CROP_PIXELS)
+
+// ********************************************************************************************
+// forward declaration of functions
+
+static uint8_t* readSet(const char *path, uint_t *count);
+static int64_t nowNs();
+static float evaluate(const uint8_t *records, uint_t count);
+static void benchClassifier(const uint8_t *records, uint_t count, uint_t iterations);
+
+// ********************************************************************************************
+
+int main(int argc, char **argv)
+{
+   if (argc < 2) {
+      fprintf(stderr, "usage: %s <set.bin> [-n iterations] [-m min accuracy %%]\n",
+         argv[0]);
+      return 1;
+   }
+
+   uint_t iterations = 20;
+   float minimum = 0;
+
+   for (int i = 2; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "-n") && i + 1 < argc)
+         iterations = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+         minimum = atof(argv[++i]);
+      else {
+         fprintf(stderr, "bad argument: %s\n", argv[i]);
+         return 1;
+      }
+   }
+
+   uint_t count;
+   uint8_t *records = readSet(argv[1], &count);
+   if (records == NULL) return 1;
+
+   float accuracy = evaluate(records, count);
+   benchClassifier(records, count, iterations);
+
+   free(records);
+   return accuracy * 100 < minimum ? 1 : 0;
+}
+
+// ********************************************************************************************
+
+static uint8_t* readSet(const char *path, uint_t *count)
+{
+   FILE *f = fopen(path, "rb");
+   if (f == NULL) {
+      perror(path);
+      return NULL;
+   }
+
+   fseek(f, 0, SEEK_END);
+   long size = ftell(f);
+   fseek(f, 0, SEEK_SET);
+
+   if (size <= 0 || size % RECORD_SIZE) {
+      fprintf(stderr, "%s: %ld bytes is not a whole number of %d byte records\n",
+         path, size, RECORD_SIZE);
+      fclose(f);
+      return NULL;
+   }
+
+   uint8_t *records = malloc(size);
+   bool_t ok = fread(records, 1, size, f) == (size_t) size;
+   fclose(f);
+
+   for (long i = 0; ok && i < size; i += RECORD_SIZE)
+      ok = records[i] < DIGIT_MODEL_CLASSES;
+
+   if (!ok) {
+      fprintf(stderr, "%s: truncated set or bad label\n", path);
+      free(records);
+      return NULL;
+   }
+
+   *count = size / RECORD_SIZE;
+   return records;
+}
+
+static int64_t nowNs()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// ********************************************************************************************
+
+/**
+ * prints the accuracy, the confusion matrix (rows are the labels) and
+ * the mean confidence of the right and of the wrong answers
+ */
+static float evaluate(const uint8_t *records, uint_t count)
+{
+   uint_t confusion[DIGIT_MODEL_CLASSES][DIGIT_MODEL_CLASSES] = { 0 };
+   uint64_t rightConfidence = 0, wrongConfidence = 0;
+   uint_t correct = 0;
+
+   DigitClassifierArena arena;
+   DigitPrediction prediction;
+
+   for (uint_t n = 0; n < count; n++)
+   {
+      const uint8_t *record = records + (size_t) n * RECORD_SIZE;
+      digitClassify(record + 1, &arena, &prediction);
+      confusion[record[0]][prediction.digit]++;
+
+      if (prediction.digit == record[0]) {
+         correct++;
+         rightConfidence += prediction.confidence;
+      }
+      else wrongConfidence += prediction.confidence;
+   }
+
+   printf("confusion  ");
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+      printf("%6u", c);
+   printf("\n");
+
+   for (uint_t l = 0; l < DIGIT_MODEL_CLASSES; l++)
+   {
+      printf("%10u ", l);
+      for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+         printf("%6u", confusion[l][c]);
+      printf("\n");
+   }
+
+   float accuracy = (float) correct / count;
+   printf("accuracy   %u / %u = %.2f%%\n", correct, count, accuracy * 100);
+   printf("confidence right %.1f%%  wrong %.1f%%\n",
+      correct ? rightConfidence / 10.0 / correct : 0.0,
+      count > correct ? wrongConfidence / 10.0 / (count - correct) : 0.0);
+   return accuracy;
+}
+
+static void benchClassifier(const uint8_t *records, uint_t count, uint_t iterations)
+{
+   DigitClassifierArena arena;
+   DigitPrediction prediction;
+   uint_t checksum = 0;
+
+   int64_t start = nowNs();
+   for (uint_t i = 0; i < iterations; i++)
+   {
+      for (uint_t n = 0; n < count; n++)
+      {
+         digitClassify(records + (size_t) n * RECORD_SIZE + 1, &arena, &prediction);
+         checksum += prediction.digit;
+      }
+   }
+   int64_t spent = nowNs() - start;
+
+   double perCrop = (double) spent / iterations / count;
+   printf("classify   %9.0f ns/crop  %8.0f crops/s  (arena %zu bytes, checksum %u)\n",
+      perCrop, 1e9 / perCrop, sizeof(DigitClassifierArena), checksum);
+}
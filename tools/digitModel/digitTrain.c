@@ -0,0 +1,627 @@
+/**
+ * trains the fallback digit classifier of main/source/ai and writes its
+ * int8 weights (main/source/ai/digitModel.c), or writes a labeled crop
+ * set for digitEval.
+ *
+ * usage: digitTrain model <out.c> [-s samples] [-e epochs] [-r seed]
+ *        digitTrain set <out.bin> <count> [-r seed]
+ *
+ * there is no labeled meter data set in the repository, so the digits
+ * are rendered from a stroke font with random geometry, lighting and
+ * noise, and go through the firmware preprocessing (digitPrepare) to
+ * give exactly the crops that the classifier sees on the device.
+ * see README.md for the quantization scheme.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "os_port.h"
+#include "source/camera/digitPrep.h"
+#include "source/ai/digitModel.h"
+
+#define MAX_STROKES 3
+#define MAX_POINTS 40
+#define MAX_WINDOW 64
+
+#define INPUT_SCALE (2.0f / 255)
+#define BATCH_SIZE 32
+#define LEARNING_RATE 0.05f
+#define MOMENTUM 0.9f
+
+typedef struct _Stroke Stroke;
+typedef struct _Glyph Glyph;
+typedef struct _Network Network;
+
+struct _Stroke
+{
+   uint_t count;
+   float x[MAX_POINTS];
+   float y[MAX_POINTS];
+};
+
+// strokes in a unit box, y grows downwards
+struct _Glyph
+{
+   uint_t count;
+   Stroke strokes[MAX_STROKES];
+};
+
+struct _Network
+{
+   float w1[DIGIT_MODEL_HIDDEN][DIGIT_CROP_PIXELS];
+   float b1[DIGIT_MODEL_HIDDEN];
+   float w2[DIGIT_MODEL_CLASSES][DIGIT_MODEL_HIDDEN];
+   float b2[DIGIT_MODEL_CLASSES];
+};
+
+static Glyph glyphs[DIGIT_MODEL_CLASSES];
+static uint64_t randomState = 1;
+
+// ********************************************************************************************
+// forward declaration of functions
+
+static float randomUniform(float low, float high);
+static float randomNormal();
+static void strokeAppend(Stroke *stroke, const float *points, uint_t count);
+static void strokeLine(Glyph *glyph, const float *points, uint_t count);
+static void strokeArc(Stroke *stroke, float cx, float cy,
+   float rx, float ry, float from, float to);
+static void buildGlyphs();
+static float segmentDistance(float px, float py, const Stroke *stroke);
+static void renderCrop(uint_t label, uint8_t *crop, DigitScratch *scratch);
+static int writeSet(const char *path, uint_t count);
+static void forward(const Network *net, const float *input,
+   float *hidden, float *output);
+static void cropInput(const uint8_t *crop, float *input);
+static void trainNetwork(Network *net, const uint8_t *crops,
+   const uint8_t *labels, uint_t count, uint_t epochs);
+static float accuracy(const Network *net, const uint8_t *crops,
+   const uint8_t *labels, uint_t count);
+static int compareFloat(const void *a, const void *b);
+static float maxAbs(const float *values, size_t count);
+static void writeArray(FILE *f, const char *type, const char *name,
+   const int32_t *values, size_t count, uint_t perLine);
+static int writeModel(const char *path, const Network *net,
+   const uint8_t *crops, uint_t count);
+
+// ********************************************************************************************
+
+int main(int argc, char **argv)
+{
+   if (argc < 3 || (strcmp(argv[1], "model") && strcmp(argv[1], "set"))) {
+      fprintf(stderr, "usage: %s model <out.c> [-s samples] [-e epochs] [-r seed]\n"
+         "       %s set <out.bin> <count> [-r seed]\n", argv[0], argv[0]);
+      return 1;
+   }
+
+   bool_t model = !strcmp(argv[1], "model");
+   uint_t samples = 30000, epochs = 12;
+   int first = 3;
+
+   if (!model)
+   {
+      if (argc < 4) {
+         fprintf(stderr, "set: the crop count is missing\n");
+         return 1;
+      }
+      samples = atoi(argv[3]);
+      first = 4;
+   }
+
+   for (int i = first; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "-s") && i + 1 < argc)
+         samples = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-e") && i + 1 < argc)
+         epochs = atoi(argv[++i]);
+      else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+         randomState = strtoull(argv[++i], NULL, 0) | 1;
+      else {
+         fprintf(stderr, "bad argument: %s\n", argv[i]);
+         return 1;
+      }
+   }
+
+   buildGlyphs();
+   if (!model)
+      return writeSet(argv[2], samples);
+
+   uint8_t *crops = malloc((size_t) samples * DIGIT_CROP_PIXELS);
+   uint8_t *labels = malloc(samples);
+   DigitScratch *scratch = malloc(sizeof(DigitScratch));
+   Network *net = malloc(sizeof(Network));
+
+   for (uint_t i = 0; i < samples; i++)
+   {
+      labels[i] = i % DIGIT_MODEL_CLASSES;
+      renderCrop(labels[i], crops + (size_t) i * DIGIT_CROP_PIXELS, scratch);
+   }
+
+   // he initialization for the relu layer
+   float spread1 = sqrtf(2.0f / DIGIT_CROP_PIXELS);
+   float spread2 = sqrtf(2.0f / DIGIT_MODEL_HIDDEN);
+   memset(net, 0, sizeof(Network));
+   for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+      for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+         net->w1[h][i] = randomNormal() * spread1;
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+      for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+         net->w2[c][h] = randomNormal() * spread2;
+
+   // the last tenth is held out
+   uint_t held = samples / 10, trained = samples - held;
+   trainNetwork(net, crops, labels, trained, epochs);
+   printf("float      train %.2f%%  held out %.2f%%\n",
+      accuracy(net, crops, labels, trained) * 100,
+      accuracy(net, crops + (size_t) trained * DIGIT_CROP_PIXELS,
+         labels + trained, held) * 100);
+
+   int status = writeModel(argv[2], net, crops, trained);
+
+   free(net);
+   free(scratch);
+   free(labels);
+   free(crops);
+   return status;
+}
+
+// ********************************************************************************************
+
+static float randomUniform(float low, float high)
+{
+   // xorshift64*
+   randomState ^= randomState >> 12;
+   randomState ^= randomState << 25;
+   randomState ^= randomState >> 27;
+   uint64_t value = randomState * 0x2545F4914F6CDD1DULL;
+   return low + (high - low) * (float) ((value >> 40) / 16777216.0);
+}
+
+static float randomNormal()
+{
+   float u = randomUniform(1e-7f, 1);
+   float v = randomUniform(0, 1);
+   return sqrtf(-2 * logf(u)) * cosf(2 * (float) M_PI * v);
+}
+
+// ********************************************************************************************
+
+// points are (x, y) pairs
+static void strokeAppend(Stroke *stroke, const float *points, uint_t count)
+{
+   for (uint_t i = 0; i < count; i++)
+   {
+      stroke->x[stroke->count] = points[2 * i];
+      stroke->y[stroke->count++] = points[2 * i + 1];
+   }
+}
+
+static void strokeLine(Glyph *glyph, const float *points, uint_t count)
+{
+   strokeAppend(&glyph->strokes[glyph->count++], points, count);
+}
+
+// appends an elliptic arc (angles in degrees, counterclockwise, y up)
+static void strokeArc(Stroke *stroke, float cx, float cy,
+   float rx, float ry, float from, float to)
+{
+   const uint_t steps = 16;
+   for (uint_t i = 0; i <= steps; i++)
+   {
+      float a = (from + (to - from) * i / steps) * (float) M_PI / 180;
+      stroke->x[stroke->count] = cx + rx * cosf(a);
+      stroke->y[stroke->count++] = cy - ry * sinf(a);
+   }
+}
+
+static void buildGlyphs()
+{
+   Glyph *g;
+   memset(glyphs, 0, sizeof(glyphs));
+
+   g = &glyphs[0]; g->count = 1;
+   strokeArc(&g->strokes[0], 0.5f, 0.5f, 0.4f, 0.48f, 0, 360);
+
+   static const float one[] = { 0.3f, 0.2f, 0.55f, 0.02f, 0.55f, 0.98f };
+   static const float oneBase[] = { 0.3f, 0.98f, 0.8f, 0.98f };
+   strokeLine(&glyphs[1], one, 3);
+   strokeLine(&glyphs[1], oneBase, 2);
+
+   g = &glyphs[2]; g->count = 1;
+   strokeArc(&g->strokes[0], 0.5f, 0.28f, 0.38f, 0.26f, 160, -40);
+   static const float twoTail[] = { 0.12f, 0.98f, 0.88f, 0.98f };
+   strokeAppend(&g->strokes[0], twoTail, 2);
+
+   g = &glyphs[3]; g->count = 2;
+   strokeArc(&g->strokes[0], 0.5f, 0.27f, 0.36f, 0.25f, 150, -90);
+   strokeArc(&g->strokes[1], 0.5f, 0.73f, 0.4f, 0.25f, 90, -150);
+
+   static const float four[] = { 0.7f, 0.98f, 0.7f, 0.02f, 0.1f, 0.7f, 0.92f, 0.7f };
+   strokeLine(&glyphs[4], four, 4);
+
+   g = &glyphs[5]; g->count = 1;
+   static const float fiveTop[] = { 0.85f, 0.02f, 0.2f, 0.02f, 0.15f, 0.45f };
+   strokeAppend(&g->strokes[0], fiveTop, 3);
+   strokeArc(&g->strokes[0], 0.5f, 0.68f, 0.38f, 0.3f, 140, -150);
+
+   g = &glyphs[6]; g->count = 2;
+   strokeArc(&g->strokes[0], 0.55f, 0.6f, 0.43f, 0.55f, 60, 190);
+   strokeArc(&g->strokes[1], 0.5f, 0.7f, 0.36f, 0.28f, 0, 360);
+
+   static const float seven[] = { 0.12f, 0.02f, 0.88f, 0.02f, 0.4f, 0.98f };
+   strokeLine(&glyphs[7], seven, 3);
+
+   g = &glyphs[8]; g->count = 2;
+   strokeArc(&g->strokes[0], 0.5f, 0.27f, 0.32f, 0.24f, 0, 360);
+   strokeArc(&g->strokes[1], 0.5f, 0.73f, 0.38f, 0.26f, 0, 360);
+
+   // nine is a six turned upside down
+   glyphs[9] = glyphs[6];
+   for (uint_t k = 0; k < glyphs[9].count; k++)
+   {
+      Stroke *s = &glyphs[9].strokes[k];
+      for (uint_t i = 0; i < s->count; i++)
+      {
+         s->x[i] = 1 - s->x[i];
+         s->y[i] = 1 - s->y[i];
+      }
+   }
+}
+
+// ********************************************************************************************
+
+static float segmentDistance(float px, float py, const Stroke *stroke)
+{
+   float best = 1e9f;
+   for (uint_t i = 0; i + 1 < stroke->count; i++)
+   {
+      float ax = stroke->x[i], ay = stroke->y[i];
+      float dx = stroke->x[i + 1] - ax, dy = stroke->y[i + 1] - ay;
+      float length = dx * dx + dy * dy;
+      float t = length > 0 ? ((px - ax) * dx + (py - ay) * dy) / length : 0;
+      if (t < 0) t = 0;
+      if (t > 1) t = 1;
+
+      float ex = px - ax - t * dx, ey = py - ay - t * dy;
+      float distance = ex * ex + ey * ey;
+      if (distance < best) best = distance;
+   }
+   return best;
+}
+
+/**
+ * draws the digit into a meter-like window (random size, slant, stroke
+ * width, polarity, lighting gradient and sensor noise) and runs it
+ * through the firmware preprocessing
+ */
+static void renderCrop(uint_t label, uint8_t *crop, DigitScratch *scratch)
+{
+   static uint8_t pixels[MAX_WINDOW * MAX_WINDOW];
+
+   uint_t width = (uint_t) randomUniform(14, 40);
+   uint_t height = (uint_t) (width * randomUniform(1.3f, 2.0f));
+   if (height > MAX_WINDOW) height = MAX_WINDOW;
+
+   // glyph box inside the window, in window pixels
+   float boxW = width * randomUniform(0.6f, 0.9f);
+   float boxH = height * randomUniform(0.7f, 0.92f);
+   float boxX = (width - boxW) * randomUniform(0.2f, 0.8f);
+   float boxY = (height - boxH) * randomUniform(0.2f, 0.8f);
+   float shear = randomUniform(-0.2f, 0.2f);
+   float angle = randomUniform(-0.08f, 0.08f);
+   float thickness = randomUniform(0.05f, 0.12f);
+   float radius2 = thickness * thickness;
+
+   bool_t dark = randomUniform(0, 1) < 0.7f;
+   float ink = randomUniform(10, 90), paper = randomUniform(140, 240);
+   if (!dark)
+   {
+      float tmp = ink;
+      ink = 255 - paper;
+      paper = 255 - tmp;
+   }
+   float gradientX = randomUniform(-1.5f, 1.5f);
+   float gradientY = randomUniform(-1.0f, 1.0f);
+   float noise = randomUniform(2, 14);
+
+   // distances are measured in glyph heights
+   Glyph glyph = glyphs[label];
+   for (uint_t k = 0; k < glyph.count; k++)
+      for (uint_t i = 0; i < glyph.strokes[k].count; i++)
+         glyph.strokes[k].x[i] *= boxW / boxH;
+
+   float cosA = cosf(angle), sinA = sinf(angle);
+
+   for (uint_t y = 0; y < height; y++)
+   {
+      for (uint_t x = 0; x < width; x++)
+      {
+         // 2x2 supersampling of the coverage
+         float coverage = 0;
+         for (uint_t sub = 0; sub < 4; sub++)
+         {
+            float wx = x + 0.25f + 0.5f * (sub & 1) - width / 2.0f;
+            float wy = y + 0.25f + 0.5f * (sub >> 1) - height / 2.0f;
+            float rx = cosA * wx + sinA * wy + width / 2.0f;
+            float ry = -sinA * wx + cosA * wy + height / 2.0f;
+            float uy = (ry - boxY) / boxH;
+            float ux = (rx - boxX) / boxW + shear * (uy - 0.5f);
+
+            float px = ux * boxW / boxH, best = 1e9f;
+            for (uint_t k = 0; k < glyph.count; k++)
+            {
+               float distance = segmentDistance(px, uy, &glyph.strokes[k]);
+               if (distance < best) best = distance;
+            }
+            coverage += best <= radius2 ? 0.25f : 0;
+         }
+
+         float background = paper + gradientX * x + gradientY * y;
+         float value = background + (ink - background) * coverage +
+            randomNormal() * noise;
+         pixels[y * width + x] = value < 0 ? 0 : value > 255 ? 255 : value;
+      }
+   }
+
+   DigitWindow window = { pixels, width, height, width };
+   digitPrepare(&window, dark, scratch, crop);
+}
+
+static int writeSet(const char *path, uint_t count)
+{
+   FILE *f = fopen(path, "wb");
+   if (f == NULL) {
+      perror(path);
+      return 1;
+   }
+
+   DigitScratch *scratch = malloc(sizeof(DigitScratch));
+   uint8_t record[1 + DIGIT_CROP_PIXELS];
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      record[0] = i % DIGIT_MODEL_CLASSES;
+      renderCrop(record[0], record + 1, scratch);
+      fwrite(record, 1, sizeof(record), f);
+   }
+
+   free(scratch);
+   fclose(f);
+   printf("set        %u crops written to %s\n", count, path);
+   return 0;
+}
+
+// ********************************************************************************************
+
+static void forward(const Network *net, const float *input,
+   float *hidden, float *output)
+{
+   for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+   {
+      float sum = net->b1[h];
+      for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+         sum += net->w1[h][i] * input[i];
+      hidden[h] = sum > 0 ? sum : 0;
+   }
+
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+   {
+      float sum = net->b2[c];
+      for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+         sum += net->w2[c][h] * hidden[h];
+      output[c] = sum;
+   }
+}
+
+// the input the int8 model gets: (pixel >> 1) in units of INPUT_SCALE
+static void cropInput(const uint8_t *crop, float *input)
+{
+   for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+      input[i] = (crop[i] >> 1) * INPUT_SCALE;
+}
+
+// minibatch sgd with momentum on the softmax cross entropy
+static void trainNetwork(Network *net, const uint8_t *crops,
+   const uint8_t *labels, uint_t count, uint_t epochs)
+{
+   Network *grad = calloc(1, sizeof(Network));
+   Network *velocity = calloc(1, sizeof(Network));
+   uint_t *order = malloc(count * sizeof(uint_t));
+   float input[DIGIT_CROP_PIXELS], hidden[DIGIT_MODEL_HIDDEN];
+   float output[DIGIT_MODEL_CLASSES], delta[DIGIT_MODEL_HIDDEN];
+
+   for (uint_t i = 0; i < count; i++)
+      order[i] = i;
+
+   for (uint_t epoch = 0; epoch < epochs; epoch++)
+   {
+      for (uint_t i = count - 1; i > 0; i--)
+      {
+         uint_t j = (uint_t) randomUniform(0, i + 1);
+         if (j > i) j = i;
+         uint_t tmp = order[i]; order[i] = order[j]; order[j] = tmp;
+      }
+
+      // step decay over the last third of the run
+      float rate = LEARNING_RATE * (epoch * 3 >= epochs * 2 ? 0.2f : 1);
+      double loss = 0;
+
+      for (uint_t start = 0; start < count; start += BATCH_SIZE)
+      {
+         uint_t end = start + BATCH_SIZE < count ? start + BATCH_SIZE : count;
+         memset(grad, 0, sizeof(Network));
+
+         for (uint_t n = start; n < end; n++)
+         {
+            uint_t index = order[n];
+            cropInput(crops + (size_t) index * DIGIT_CROP_PIXELS, input);
+            forward(net, input, hidden, output);
+
+            float top = output[0], sum = 0;
+            for (uint_t c = 1; c < DIGIT_MODEL_CLASSES; c++)
+               if (output[c] > top) top = output[c];
+            for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+               sum += output[c] = expf(output[c] - top);
+
+            loss -= logf(output[labels[index]] / sum + 1e-12f);
+            memset(delta, 0, sizeof(delta));
+
+            for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+            {
+               float g = output[c] / sum - (c == labels[index]);
+               grad->b2[c] += g;
+               for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+               {
+                  grad->w2[c][h] += g * hidden[h];
+                  delta[h] += g * net->w2[c][h];
+               }
+            }
+
+            for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+            {
+               if (hidden[h] <= 0) continue;
+               grad->b1[h] += delta[h];
+               for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+                  grad->w1[h][i] += delta[h] * input[i];
+            }
+         }
+
+         // all the parameters are floats laid out back to back
+         float *p = (float*) net, *g = (float*) grad, *v = (float*) velocity;
+         float step = rate / (end - start);
+         for (size_t i = 0; i < sizeof(Network) / sizeof(float); i++)
+         {
+            v[i] = MOMENTUM * v[i] - step * g[i];
+            p[i] += v[i];
+         }
+      }
+
+      printf("epoch %2u   loss %.4f\n", epoch + 1, loss / count);
+   }
+
+   free(order);
+   free(velocity);
+   free(grad);
+}
+
+static float accuracy(const Network *net, const uint8_t *crops,
+   const uint8_t *labels, uint_t count)
+{
+   float input[DIGIT_CROP_PIXELS], hidden[DIGIT_MODEL_HIDDEN];
+   float output[DIGIT_MODEL_CLASSES];
+   uint_t correct = 0;
+
+   for (uint_t n = 0; n < count; n++)
+   {
+      cropInput(crops + (size_t) n * DIGIT_CROP_PIXELS, input);
+      forward(net, input, hidden, output);
+
+      uint_t best = 0;
+      for (uint_t c = 1; c < DIGIT_MODEL_CLASSES; c++)
+         if (output[c] > output[best]) best = c;
+      correct += best == labels[n];
+   }
+
+   return count ? (float) correct / count : 0;
+}
+
+// ********************************************************************************************
+
+static int compareFloat(const void *a, const void *b)
+{
+   float x = *(const float*) a, y = *(const float*) b;
+   return (x > y) - (x < y);
+}
+
+static float maxAbs(const float *values, size_t count)
+{
+   float top = 0;
+   for (size_t i = 0; i < count; i++)
+      if (fabsf(values[i]) > top) top = fabsf(values[i]);
+   return top;
+}
+
+static void writeArray(FILE *f, const char *type, const char *name,
+   const int32_t *values, size_t count, uint_t perLine)
+{
+   fprintf(f, "\nconst %s %s[%zu] = {", type, name, count);
+   for (size_t i = 0; i < count; i++)
+      fprintf(f, "%s%ld,", i % perLine ? " " : "\n   ", (long) values[i]);
+   fprintf(f, "\n};\n");
+}
+
+/**
+ * symmetric per layer scales. the hidden scale covers the 99.99th
+ * percentile of the activations on the training crops, the few larger
+ * ones saturate at 127.
+ */
+static int writeModel(const char *path, const Network *net,
+   const uint8_t *crops, uint_t count)
+{
+   float scaleW1 = maxAbs(&net->w1[0][0], sizeof(net->w1) / sizeof(float)) / 127;
+   float scaleW2 = maxAbs(&net->w2[0][0], sizeof(net->w2) / sizeof(float)) / 127;
+
+   uint_t sampled = count < 4000 ? count : 4000;
+   float *activations = malloc((size_t) sampled * DIGIT_MODEL_HIDDEN * sizeof(float));
+   float input[DIGIT_CROP_PIXELS], output[DIGIT_MODEL_CLASSES];
+   for (uint_t n = 0; n < sampled; n++)
+   {
+      cropInput(crops + (size_t) n * DIGIT_CROP_PIXELS, input);
+      forward(net, input, activations + (size_t) n * DIGIT_MODEL_HIDDEN, output);
+   }
+
+   size_t total = (size_t) sampled * DIGIT_MODEL_HIDDEN;
+   qsort(activations, total, sizeof(float), compareFloat);
+   float scaleH = activations[total - 1 - total / 10000] / 127;
+   free(activations);
+
+   // hidden = acc * (input scale * w1 scale / hidden scale) = acc * mult / 2^shift
+   double multiplier = INPUT_SCALE * scaleW1 / scaleH;
+   int shift = 31;
+   while (multiplier * ((int64_t) 1 << shift) >= 2147483648.0) shift--;
+   while (multiplier * ((int64_t) 1 << shift) < 1073741824.0) shift++;
+
+   static int32_t w1[DIGIT_MODEL_HIDDEN * DIGIT_CROP_PIXELS];
+   int32_t b1[DIGIT_MODEL_HIDDEN];
+   int32_t w2[DIGIT_MODEL_CLASSES * DIGIT_MODEL_HIDDEN];
+   int32_t b2[DIGIT_MODEL_CLASSES];
+
+   for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+   {
+      b1[h] = lroundf(net->b1[h] / (INPUT_SCALE * scaleW1));
+      for (uint_t i = 0; i < DIGIT_CROP_PIXELS; i++)
+         w1[h * DIGIT_CROP_PIXELS + i] = lroundf(net->w1[h][i] / scaleW1);
+   }
+
+   for (uint_t c = 0; c < DIGIT_MODEL_CLASSES; c++)
+   {
+      b2[c] = lroundf(net->b2[c] / (scaleH * scaleW2));
+      for (uint_t h = 0; h < DIGIT_MODEL_HIDDEN; h++)
+         w2[c * DIGIT_MODEL_HIDDEN + h] = lroundf(net->w2[c][h] / scaleW2);
+   }
+
+   FILE *f = fopen(path, "w");
+   if (f == NULL) {
+      perror(path);
+      return 1;
+   }
+
+   fprintf(f, "// generated by tools/digitModel/digitTrain, do not edit\n\n");
+   fprintf(f, "#include \"digitModel.h\"\n");
+   fprintf(f, "\nconst int32_t digitModelHiddenMult = %ld;\n",
+      (long) llround(multiplier * ((int64_t) 1 << shift)));
+   fprintf(f, "const uint8_t digitModelHiddenShift = %d;\n", shift);
+   fprintf(f, "const float digitModelLogitScale = %.9gf;\n", scaleH * scaleW2);
+   writeArray(f, "int32_t", "digitModelHiddenBias", b1, DIGIT_MODEL_HIDDEN, 8);
+   writeArray(f, "int32_t", "digitModelOutputBias", b2, DIGIT_MODEL_CLASSES, 8);
+   writeArray(f, "int8_t", "digitModelOutputWeights", w2,
+      DIGIT_MODEL_CLASSES * DIGIT_MODEL_HIDDEN, 16);
+   writeArray(f, "int8_t", "digitModelHiddenWeights", w1,
+      DIGIT_MODEL_HIDDEN * DIGIT_CROP_PIXELS, 16);
+   fclose(f);
+
+   printf("model      %s written, hidden shift %d\n", path, shift);
+   return 0;
+}
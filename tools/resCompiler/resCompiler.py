@@ -0,0 +1,212 @@
+"""
+builds main/res.c (the static web pages of the http server) from the
+web directory, in the resource format of common/resource_manager.c.
+
+usage:
+    python3 resCompiler.py [web dir] [res.c]
+
+next to every file it stores name.gz, the gzip variant, when it saves
+at least 10%. the server sends it to clients that accept gzip
+(HTTP_SERVER_GZIP_TYPE_SUPPORT).
+
+res.c also holds resIndex, a perfect hash table of every stored path
+with its data, MIME type and a strong entity tag. resGetData finds a
+file with one hash and one compare, and the server sends the tag as
+ETag and answers a matching If-None-Match with 304
+(HTTP_SERVER_ETAG_SUPPORT).
+
+the output only depends on the file contents (no timestamps), so an
+unchanged web directory gives the same res.c and the same tags.
+"""
+
+import gzip, hashlib, os, re, struct, sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+WEB_DIR = os.path.join(HERE, "..", "..", "web")
+RES_FILE = os.path.join(HERE, "..", "..", "main", "res.c")
+MIME_FILE = os.path.join(HERE, "..", "..", "main", "cyclone_tcp", "http", "mime.c")
+
+# sources of the pages, not served
+SKIPPED = (".md", ".scss")
+
+RES_TYPE_DIR = 1
+RES_TYPE_FILE = 2
+ENTRY_SIZE = 10 # type, dataStart, dataLength, nameLength
+HEADER_SIZE = 4 + ENTRY_SIZE
+
+MIN_GZIP_SAVING = 0.1
+
+# seeds tried per table size before the table is doubled
+MAX_SEEDS = 1 << 16
+
+def readMimeTypes(path):
+    """ the extension table of the http server, so both agree """
+    with open(path) as f:
+        return dict(re.findall(r'\{"(\.\w+)",\s*"([^"]+)"\}', f.read()))
+
+MIME_TYPES = readMimeTypes(MIME_FILE)
+
+def mimeOf(name):
+    if name.endswith(".gz"):
+        name = name[:-3]
+    extension = os.path.splitext(name)[1].lower()
+    return MIME_TYPES.get(extension, "application/octet-stream")
+
+def etagOf(data, suffix=""):
+    return '"%s%s"' % (hashlib.sha256(data).hexdigest()[:16], suffix)
+
+def collect(path):
+    """ returns the tree of a directory: {name: bytes or dict} """
+    tree = {}
+    for name in sorted(os.listdir(path), key=str.lower):
+        full = os.path.join(path, name)
+        if os.path.isdir(full):
+            tree[name] = collect(full)
+        elif not name.endswith(SKIPPED):
+            with open(full, "rb") as f:
+                data = f.read()
+            tree[name] = data
+
+            packed = gzip.compress(data, 9, mtime=0)
+            if len(packed) <= len(data) * (1 - MIN_GZIP_SAVING):
+                tree[name + ".gz"] = packed
+    return dict(sorted(tree.items(), key=lambda item: item[0].lower()))
+
+def hashPath(path, seed):
+    """ resHashPath of resource_manager.c (FNV-1a of the lower case path) """
+    value = 2166136261 ^ seed
+    for c in path.lower().encode():
+        value = ((value ^ c) * 16777619) & 0xFFFFFFFF
+    return value ^ (value >> 16)
+
+def perfectHash(paths):
+    """ the smallest table (power of two) and a seed without collisions """
+    size = 1
+    while size < 2 * len(paths):
+        size *= 2
+    while True:
+        for seed in range(MAX_SEEDS):
+            slots = {hashPath(path, seed) & (size - 1) for path in paths}
+            if len(slots) == len(paths):
+                return size, seed
+        size *= 2
+
+def tableSize(tree, isRoot):
+    names = list(tree) + ["."] + ([] if isRoot else [".."])
+    return sum(ENTRY_SIZE + len(name) for name in names)
+
+def compile(tree):
+    """
+    directory tables first (breadth first), then the file data.
+    returns the data and the files as (path, start, length, etag)
+    """
+    tables = [] # (tree, parent table index)
+    queue = [(tree, None)]
+    while queue:
+        node, parent = queue.pop(0)
+        tables.append((node, parent))
+        queue += [(child, len(tables) - 1) for child in node.values()
+            if isinstance(child, dict)]
+
+    pathOf = {id(tree): ""}
+    for node, _ in tables:
+        for name, child in node.items():
+            if isinstance(child, dict):
+                pathOf[id(child)] = pathOf[id(node)] + name + "/"
+
+    starts, offset = [], HEADER_SIZE
+    for node, parent in tables:
+        starts.append(offset)
+        offset += tableSize(node, parent is None)
+
+    files = [] # (offset, data)
+    tableOf = {id(node): i for i, (node, _) in enumerate(tables)}
+    for node, _ in tables:
+        for child in node.values():
+            if not isinstance(child, dict):
+                offset = (offset + 3) & ~3
+                files.append((offset, child))
+                offset += len(child)
+    fileStarts = iter(start for start, _ in files)
+    index = []
+
+    out = bytearray(offset)
+    struct.pack_into("<I", out, 0, offset)
+    struct.pack_into("<BIIB", out, 4, RES_TYPE_DIR, starts[0], tableSize(tree, True), 0)
+
+    for i, (node, parent) in enumerate(tables):
+        entries = [(".", RES_TYPE_DIR, starts[i], tableSize(node, parent is None))]
+        if parent is not None:
+            parentNode = tables[parent][0]
+            entries.append(("..", RES_TYPE_DIR, starts[parent],
+                tableSize(parentNode, tables[parent][1] is None)))
+        for name, child in node.items():
+            if isinstance(child, dict):
+                j = tableOf[id(child)]
+                entries.append((name, RES_TYPE_DIR, starts[j], tableSize(child, False)))
+            else:
+                entries.append((name, RES_TYPE_FILE, next(fileStarts), len(child)))
+                # a gzip variant is tagged after the file it was made from
+                original = node.get(name[:-3], child) if name.endswith(".gz") else child
+                etag = etagOf(original, "-gz" if child is not original else "")
+                index.append((pathOf[id(node)] + name, entries[-1][2], len(child), etag))
+
+        position = starts[i]
+        for name, type, start, length in entries:
+            encoded = name.encode()
+            struct.pack_into("<BIIB", out, position, type, start, length, len(encoded))
+            out[position + ENTRY_SIZE:position + ENTRY_SIZE + len(encoded)] = encoded
+            position += ENTRY_SIZE + len(encoded)
+
+    for start, data in files:
+        out[start:start + len(data)] = data
+    return bytes(out), index
+
+def writeSource(path, data, index):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("   " + ", ".join("0x%02X" % b for b in data[i:i + 16]))
+    text = "#include \"resource_manager.h\"\n\n"
+    text += "const unsigned char res[] =\n{\n" + ",\n".join(lines) + "\n};\n"
+
+    size, seed = perfectHash([path for path, _, _, _ in index])
+    slots = sorted((hashPath(path, seed) & (size - 1), path, start, length, etag)
+        for path, start, length, etag in index)
+
+    text += "\n// perfect hash table of the paths (see resFindEntry)\n"
+    text += "const uint32_t resIndexSize = %d;\n" % size
+    text += "const uint32_t resIndexSeed = 0x%08X;\n\n" % seed
+    text += "const ResIndexEntry resIndex[%d] =\n{\n" % size
+    text += ",\n".join('   [%d] = {"%s", %d, %d, "%s", "%s"}' % (slot, path,
+        start, length, mimeOf(path), etag.replace('"', '\\"'))
+        for slot, path, start, length, etag in slots)
+    text += "\n};\n"
+
+    with open(path, "wb") as f:
+        f.write(text.replace("\n", "\r\n").encode())
+
+def main():
+    webDir = sys.argv[1] if len(sys.argv) > 1 else WEB_DIR
+    resFile = sys.argv[2] if len(sys.argv) > 2 else RES_FILE
+
+    tree = collect(webDir)
+    data, index = compile(tree)
+    writeSource(resFile, data, index)
+
+    def walk(node, prefix):
+        plain = packed = 0
+        for name, child in node.items():
+            if isinstance(child, dict):
+                p, g = walk(child, prefix + name + "/")
+                plain, packed = plain + p, packed + g
+            elif not name.endswith(".gz"):
+                served = node.get(name + ".gz", child)
+                print("%-28s %7d -> %7d bytes" % (prefix + name, len(child), len(served)))
+                plain, packed = plain + len(child), packed + len(served)
+        return plain, packed
+
+    plain, packed = walk(tree, "")
+    print("%-28s %7d -> %7d bytes (res.c holds %d)" % ("total", plain, packed, len(data)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,9 @@
+#!/bin/sh
+# builds the host benchmark (roiBench) of the digit row locator
+cd "$(dirname "$0")"
+MAIN=../../main
+
+gcc -O2 -std=gnu11 -Wall -DIDF_VER=\"host\" -D__error_t_defined \
+   -I../uartBench/hostPort -I$MAIN -I$MAIN/common \
+   roiBench.c $MAIN/source/camera/digitLocate.c \
+   -o roiBench
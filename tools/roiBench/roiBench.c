@@ -0,0 +1,164 @@
+/**
+ * runs the digit row locator (main/source/camera/digitLocate.c) on
+ * sample frames on a linux host and times it.
+ *
+ * usage: roiBench [-n iterations] <image.pgm>...
+ *
+ * when <image>.txt exists next to a frame (see roiSamples.py), the
+ * proposal must have the same polarity and one box around the center
+ * of every expected digit, otherwise the exit status is 1.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "os_port.h"
+#include "source/camera/digitLocate.h"
+
+typedef struct _Frame Frame;
+
+struct _Frame
+{
+   uint_t width;
+   uint_t height;
+   uint8_t *pixels;
+};
+
+// ********************************************************************************************
+// forward declaration of functions
+
+static bool_t readPgm(const char *path, Frame *frame);
+static int64_t nowNs();
+static int checkExpected(const char *path, const DigitLocation *location);
+static void printLocation(const char *path, const DigitLocation *location,
+   double microseconds);
+
+// ********************************************************************************************
+
+int main(int argc, char **argv)
+{
+   uint_t iterations = 100;
+   int status = 0, images = 0;
+   DigitLocateScratch *scratch = malloc(sizeof(DigitLocateScratch));
+
+   for (int i = 1; i < argc; i++)
+   {
+      if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+         iterations = atoi(argv[++i]);
+         continue;
+      }
+
+      Frame frame;
+      if (!readPgm(argv[i], &frame)) {
+         status = 1;
+         continue;
+      }
+
+      DigitLocation location;
+      int64_t start = nowNs();
+      for (uint_t n = 0; n < iterations; n++)
+         digitLocate(frame.pixels, frame.width, frame.height, scratch, &location);
+      int64_t spent = nowNs() - start;
+
+      printLocation(argv[i], &location, spent / 1e3 / iterations);
+      status |= checkExpected(argv[i], &location);
+      free(frame.pixels);
+      images++;
+   }
+
+   if (images == 0) {
+      fprintf(stderr, "usage: %s [-n iterations] <image.pgm>...\n", argv[0]);
+      status = 1;
+   }
+
+   printf("scratch    %zu bytes\n", sizeof(DigitLocateScratch));
+   free(scratch);
+   return status;
+}
+
+// ********************************************************************************************
+
+static bool_t readPgm(const char *path, Frame *frame)
+{
+   FILE *f = fopen(path, "rb");
+   uint_t maxValue = 0;
+   if (f == NULL || fscanf(f, "P5 %u %u %u", &frame->width,
+      &frame->height, &maxValue) != 3 || maxValue != 255 || fgetc(f) == EOF) {
+      fprintf(stderr, "%s: only 8-bit binary pgm is supported\n", path);
+      if (f) fclose(f);
+      return FALSE;
+   }
+
+   size_t size = frame->width * frame->height;
+   frame->pixels = malloc(size);
+   bool_t ok = fread(frame->pixels, 1, size, f) == size;
+   fclose(f);
+
+   if (!ok) {
+      fprintf(stderr, "%s: truncated image\n", path);
+      free(frame->pixels);
+   }
+   return ok;
+}
+
+static int64_t nowNs()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// ********************************************************************************************
+
+static void printLocation(const char *path, const DigitLocation *location,
+   double microseconds)
+{
+   printf("%s: %.0f us, invert %d, %u digits", path, microseconds,
+      location->invert, location->digitCount);
+   for (uint_t i = 0; i < location->digitCount; i++)
+   {
+      const DigitBox *box = &location->boxes[i];
+      printf(" %u,%u,%u,%u", box->x, box->y, box->width, box->height);
+   }
+   printf("\n");
+}
+
+static int checkExpected(const char *path, const DigitLocation *location)
+{
+   char name[512];
+   size_t length = strlen(path);
+   if (length < 4 || length + 1 > sizeof(name)) return 0;
+
+   memcpy(name, path, length - 4);
+   strcpy(name + length - 4, ".txt");
+
+   FILE *f = fopen(name, "r");
+   if (f == NULL) return 0;
+
+   int invert, count = 0, matched = 0;
+   uint_t x, y, w, h;
+   if (fscanf(f, "%d", &invert) != 1) invert = -1;
+
+   while (fscanf(f, " %u,%u,%u,%u", &x, &y, &w, &h) == 4)
+   {
+      uint_t cx = x + w / 2, cy = y + h / 2;
+      for (uint_t i = 0; i < location->digitCount; i++)
+      {
+         const DigitBox *box = &location->boxes[i];
+         if (box->x <= cx && cx < box->x + box->width &&
+            box->y <= cy && cy < box->y + box->height) {
+            matched++;
+            break;
+         }
+      }
+      count++;
+   }
+   fclose(f);
+
+   bool_t ok = invert == location->invert && matched == count &&
+      count == location->digitCount;
+   printf("  expected invert %d, %d digits: %s\n", invert, count,
+      ok ? "ok" : "MISMATCH");
+   return ok ? 0 : 1;
+}
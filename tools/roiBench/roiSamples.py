@@ -0,0 +1,122 @@
+"""
+writes synthetic meter frames for roiBench, each with the expected
+digit row next to it.
+
+usage:
+    python3 roiSamples.py <out dir>
+
+every sample is <name>.pgm (320x240, 8-bit) and <name>.txt that holds
+the invert flag followed by the x,y,w,h box of every digit glyph.
+"""
+
+import os, random, sys
+
+WIDTH, HEIGHT = 320, 240
+
+# 5x7 bitmap digits
+FONT = {
+    0: ["01110", "10001", "10011", "10101", "11001", "10001", "01110"],
+    1: ["00100", "01100", "00100", "00100", "00100", "00100", "01110"],
+    2: ["01110", "10001", "00001", "00010", "00100", "01000", "11111"],
+    3: ["11111", "00010", "00100", "00010", "00001", "10001", "01110"],
+    4: ["00010", "00110", "01010", "10010", "11111", "00010", "00010"],
+    5: ["11111", "10000", "11110", "00001", "00001", "10001", "01110"],
+    6: ["00110", "01000", "10000", "11110", "10001", "10001", "01110"],
+    7: ["11111", "00001", "00010", "00100", "01000", "01000", "01000"],
+    8: ["01110", "10001", "10001", "01110", "10001", "10001", "01110"],
+    9: ["01110", "10001", "10001", "01111", "00001", "00010", "01100"],
+}
+
+def writePgm(path, pixels):
+    with open(path, "wb") as f:
+        f.write(b"P5\n%d %d\n255\n" % (WIDTH, HEIGHT))
+        f.write(bytes(max(0, min(255, int(p))) for p in pixels))
+
+def fillRect(pixels, x, y, w, h, value):
+    for row in range(max(0, y), min(HEIGHT, y + h)):
+        for col in range(max(0, x), min(WIDTH, x + w)):
+            pixels[row * WIDTH + col] = value
+
+def drawDigit(pixels, digit, x, y, w, h, value):
+    """ scales the 5x7 glyph to (w x h), returns the inked bounds """
+    xs, ys = [], []
+    for row in range(h):
+        for col in range(w):
+            if FONT[digit][row * 7 // h][col * 5 // w] == "1":
+                pixels[(y + row) * WIDTH + x + col] = value
+                xs.append(x + col)
+                ys.append(y + row)
+    return min(xs), min(ys), max(xs) - min(xs) + 1, max(ys) - min(ys) + 1
+
+def background(rnd, low, high):
+    """ lit gradient between low and high """
+    gx, gy = rnd.uniform(-0.2, 0.2), rnd.uniform(-0.2, 0.2)
+    base = rnd.uniform(low, high)
+    return [base + gx * (i % WIDTH) + gy * (i // WIDTH) for i in range(WIDTH * HEIGHT)]
+
+def addNoise(rnd, pixels, sigma):
+    for i in range(len(pixels)):
+        pixels[i] += rnd.gauss(0, sigma)
+
+# ********************************************************************************************
+
+def printedCounter(rnd):
+    """ dark digits on a light face, a frame around it and small print """
+    pixels = background(rnd, 170, 210)
+    fillRect(pixels, 10, 10, 300, 4, 40)
+    fillRect(pixels, 10, 226, 300, 4, 40)
+    count, w, h = 5, 24, 44
+    x0, y0 = 50, 90
+    boxes = [drawDigit(pixels, rnd.randrange(10), x0 + i * 36, y0, w, h, 35)
+             for i in range(count)]
+
+    # serial number, too small to be the counter
+    for i in range(10):
+        drawDigit(pixels, rnd.randrange(10), 60 + i * 9, 180, 5, 7, 60)
+
+    addNoise(rnd, pixels, 6)
+    return True, boxes, pixels
+
+def drumCounter(rnd):
+    """ white digits on black drums seen through a light face """
+    pixels = background(rnd, 150, 200)
+    count, w, h = 8, 16, 30
+    x0, y0 = 28, 100
+    boxes = []
+    for i in range(count):
+        x = x0 + i * 34
+        fillRect(pixels, x - 6, y0 - 8, w + 12, h + 16, 25)
+        boxes.append(drawDigit(pixels, rnd.randrange(10), x, y0, w, h, 220))
+
+    addNoise(rnd, pixels, 8)
+    return False, boxes, pixels
+
+def dimCounter(rnd):
+    """ low contrast under a strong light falloff """
+    pixels = [120 + 80 * (1 - (i % WIDTH) / WIDTH) for i in range(WIDTH * HEIGHT)]
+    count, w, h = 6, 20, 36
+    x0, y0 = 60, 40
+    boxes = [drawDigit(pixels, rnd.randrange(10), x0 + i * 32, y0, w, h,
+                       pixels[y0 * WIDTH + x0 + i * 32] - 45)
+             for i in range(count)]
+
+    addNoise(rnd, pixels, 4)
+    return True, boxes, pixels
+
+SAMPLES = [("printed", printedCounter), ("drum", drumCounter), ("dim", dimCounter)]
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        sys.exit(1)
+
+    os.makedirs(sys.argv[1], exist_ok=True)
+    for seed, (name, make) in enumerate(SAMPLES):
+        invert, boxes, pixels = make(random.Random(seed))
+        path = os.path.join(sys.argv[1], name)
+        writePgm(path + ".pgm", pixels)
+        with open(path + ".txt", "w") as f:
+            f.write("%d %s\n" % (invert, " ".join("%d,%d,%d,%d" % b for b in boxes)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,12 @@
+#!/bin/sh
+# builds the host benchmark (uartBench) from the firmware sources
+cd "$(dirname "$0")"
+MAIN=../../main
+MAX_DIGIT_COUNT=$(sed -n 's/^#define MAX_DIGIT_COUNT \([0-9]*\).*/\1/p' $MAIN/source/envTypes.h)
+
+gcc -O2 -std=gnu11 -Wall -Wno-format -pthread -DIDF_VER=\"host\" -D__error_t_defined \
+   -DMAX_DIGIT_COUNT=$MAX_DIGIT_COUNT \
+   -IhostPort -I$MAIN -I$MAIN/common \
+   uartBench.c hostPort/hostPort.c \
+   $MAIN/source/serial/uartHelper.c $MAIN/source/serial/uartBroker.c \
+   -o uartBench
@@ -0,0 +1,7 @@
+#ifndef __HOST_GPIO_H__
+#define __HOST_GPIO_H__
+
+#define GPIO_NUM_32 32
+#define GPIO_NUM_33 33
+
+#endif
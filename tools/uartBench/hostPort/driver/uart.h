@@ -0,0 +1,71 @@
+#ifndef __HOST_UART_H__
+#define __HOST_UART_H__
+
+/**
+ * uart driver api backed by a tty device (e.g. the pty opened by
+ * k210/k210Emulator.py). the device is set with hostUartSetDevice
+ * before serialInit is called.
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+
+typedef int uart_port_t;
+#define UART_NUM_2 2
+#define UART_PIN_NO_CHANGE (-1)
+
+typedef enum { UART_DATA_8_BITS = 3 } uart_word_length_t;
+typedef enum { UART_PARITY_DISABLE = 0 } uart_parity_t;
+typedef enum { UART_STOP_BITS_1 = 1 } uart_stop_bits_t;
+typedef enum { UART_HW_FLOWCTRL_DISABLE = 0 } uart_hw_flowcontrol_t;
+typedef enum { UART_SCLK_APB = 0 } uart_sclk_t;
+typedef enum { UART_MODE_UART = 0 } uart_mode_t;
+
+typedef struct
+{
+   int baud_rate;
+   uart_word_length_t data_bits;
+   uart_parity_t parity;
+   uart_stop_bits_t stop_bits;
+   uart_hw_flowcontrol_t flow_ctrl;
+   uart_sclk_t source_clk;
+} uart_config_t;
+
+typedef enum
+{
+   UART_DATA,
+   UART_BREAK,
+   UART_BUFFER_FULL,
+   UART_FIFO_OVF,
+   UART_FRAME_ERR,
+   UART_PARITY_ERR,
+   UART_DATA_BREAK,
+   UART_PATTERN_DET,
+   UART_EVENT_MAX
+} uart_event_type_t;
+
+typedef struct
+{
+   uart_event_type_t type;
+   size_t size;
+   bool timeout_flag;
+} uart_event_t;
+
+void hostUartSetDevice(const char *path);
+
+int uart_driver_install(uart_port_t port, int rxBufferSize, int txBufferSize,
+   int queueSize, QueueHandle_t *queue, int intrAllocFlags);
+int uart_param_config(uart_port_t port, const uart_config_t *config);
+int uart_set_pin(uart_port_t port, int tx, int rx, int rts, int cts);
+int uart_set_mode(uart_port_t port, uart_mode_t mode);
+int uart_pattern_queue_reset(uart_port_t port, int queueLength);
+int uart_read_bytes(uart_port_t port, void *buf, uint32_t length, TickType_t ticksToWait);
+int uart_write_bytes(uart_port_t port, const void *src, size_t size);
+int uart_flush_input(uart_port_t port);
+int uart_get_buffered_data_len(uart_port_t port, size_t *size);
+int uart_pattern_pop_pos(uart_port_t port);
+int uart_get_baudrate(uart_port_t port, uint32_t *baudrate);
+int uart_set_baudrate(uart_port_t port, uint32_t baudrate);
+int uart_wait_tx_done(uart_port_t port, TickType_t ticksToWait);
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef __HOST_ESP_LOG_H__
+#define __HOST_ESP_LOG_H__
+
+#include <stdio.h>
+
+// 0: errors only, 1: everything
+extern int hostLogLevel;
+
+#define ESP_LOGE(tag, format, ...) \
+   fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGW(tag, format, ...) \
+   fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+
+#define ESP_LOGI(tag, format, ...) do { if (hostLogLevel > 0) \
+   fprintf(stderr, "I (%s) " format "\n", tag, ##__VA_ARGS__); } while (0)
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef __HOST_ESP_ROM_CRC_H__
+#define __HOST_ESP_ROM_CRC_H__
+
+#include <stdint.h>
+
+// same result as the rom function (zlib compatible crc32)
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len);
+
+#endif
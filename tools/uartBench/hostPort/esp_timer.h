@@ -0,0 +1,9 @@
+#ifndef __HOST_ESP_TIMER_H__
+#define __HOST_ESP_TIMER_H__
+
+#include <stdint.h>
+
+// microseconds since the program started
+int64_t esp_timer_get_time(void);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+/**
+ * minimal FreeRTOS api on top of pthreads, just enough to run
+ * the uart protocol code on a linux host (see hostPort.c).
+ * one tick is one millisecond.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t StackType_t;
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY ((TickType_t) 0xFFFFFFFF)
+#define pdMS_TO_TICKS(ms) ((TickType_t) (ms))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define tskIDLE_PRIORITY 0
+
+size_t xPortGetFreeHeapSize(void);
+int xPortGetCoreID(void);
+
+#include "task.h"
+#include "queue.h"
+
+#endif
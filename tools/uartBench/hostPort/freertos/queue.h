@@ -0,0 +1,13 @@
+#ifndef __HOST_QUEUE_H__
+#define __HOST_QUEUE_H__
+
+#include "FreeRTOS.h"
+
+typedef struct _HostQueue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait);
+BaseType_t xQueueReset(QueueHandle_t queue);
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef __HOST_SEMPHR_H__
+#define __HOST_SEMPHR_H__
+
+#include "FreeRTOS.h"
+
+typedef struct _HostSemaphore *SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef __HOST_TASK_H__
+#define __HOST_TASK_H__
+
+#include "FreeRTOS.h"
+
+typedef struct _HostTask *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+typedef struct
+{
+   TickType_t start;
+} TimeOut_t;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+   uint32_t stackDepth, void *param, UBaseType_t priority,
+   TaskHandle_t *handle, BaseType_t core);
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+
+void vTaskSetTimeOutState(TimeOut_t *timeOut);
+BaseType_t xTaskCheckForTimeOut(TimeOut_t *timeOut, TickType_t *ticksToWait);
+
+#endif
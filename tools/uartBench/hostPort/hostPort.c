@@ -0,0 +1,516 @@
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "driver/uart.h"
+#include "esp_timer.h"
+#include "esp_rom_crc.h"
+#include "esp_log.h"
+
+#define LOG_TAG "hostPort"
+
+// size of the driver side rx buffer (like the idf ring buffer)
+#define HOST_UART_RX_SIZE (64*1024)
+
+int hostLogLevel = 0;
+
+// ********************************************************************************************
+// time
+
+static int64_t monotonicUs()
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int64_t startUs = 0;
+
+int64_t esp_timer_get_time(void)
+{
+   if (startUs == 0) startUs = monotonicUs();
+   return monotonicUs() - startUs;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+   return (TickType_t) (esp_timer_get_time() / 1000);
+}
+
+// absolute deadline for pthread_cond_timedwait
+static struct timespec deadlineAfter(TickType_t ticks)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_REALTIME, &ts);
+   ts.tv_sec += ticks / 1000;
+   ts.tv_nsec += (long) (ticks % 1000) * 1000000;
+   if (ts.tv_nsec >= 1000000000) {
+      ts.tv_sec++;
+      ts.tv_nsec -= 1000000000;
+   }
+   return ts;
+}
+
+/**
+ * waits on (cond) until (ready) returns true or the ticks pass.
+ * (lock) must be held by the caller.
+ */
+static bool waitUntil(pthread_cond_t *cond, pthread_mutex_t *lock,
+   TickType_t ticks, bool (*ready)(void *), void *arg)
+{
+   struct timespec deadline = deadlineAfter(ticks);
+   while (!ready(arg))
+   {
+      if (ticks == 0) return false;
+      if (ticks == portMAX_DELAY)
+         pthread_cond_wait(cond, lock);
+      else if (pthread_cond_timedwait(cond, lock, &deadline) == ETIMEDOUT)
+         return ready(arg);
+   }
+   return true;
+}
+
+size_t xPortGetFreeHeapSize(void) { return 256*1024; }
+int xPortGetCoreID(void) { return 0; }
+
+// ********************************************************************************************
+// tasks and notifications
+
+struct _HostTask
+{
+   pthread_t thread;
+   pthread_mutex_t lock;
+   pthread_cond_t cond;
+   uint32_t notifyValue;
+   TaskFunction_t function;
+   void *param;
+};
+
+static __thread struct _HostTask *currentTask = NULL;
+
+static struct _HostTask* newTask()
+{
+   struct _HostTask *task = calloc(1, sizeof(struct _HostTask));
+   pthread_mutex_init(&task->lock, NULL);
+   pthread_cond_init(&task->cond, NULL);
+   return task;
+}
+
+static void* taskEntry(void *arg)
+{
+   currentTask = arg;
+   currentTask->function(currentTask->param);
+   return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name,
+   uint32_t stackDepth, void *param, UBaseType_t priority,
+   TaskHandle_t *handle, BaseType_t core)
+{
+   struct _HostTask *task = newTask();
+   task->function = function;
+   task->param = param;
+   if (handle != NULL) *handle = task;
+
+   if (pthread_create(&task->thread, NULL, taskEntry, task) != 0)
+      return pdFAIL;
+
+   pthread_detach(task->thread);
+   return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+   if (task == NULL) pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+   struct timespec ts = {ticks / 1000, (long) (ticks % 1000) * 1000000};
+   nanosleep(&ts, NULL);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+   // threads that were not created as tasks (e.g. main)
+   if (currentTask == NULL) currentTask = newTask();
+   return currentTask;
+}
+
+static bool notified(void *arg)
+{
+   return ((struct _HostTask*) arg)->notifyValue > 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait)
+{
+   struct _HostTask *task = xTaskGetCurrentTaskHandle();
+
+   pthread_mutex_lock(&task->lock);
+   waitUntil(&task->cond, &task->lock, ticksToWait, notified, task);
+
+   uint32_t value = task->notifyValue;
+   if (value > 0)
+      task->notifyValue = clearOnExit ? 0 : value - 1;
+   pthread_mutex_unlock(&task->lock);
+
+   return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+   pthread_mutex_lock(&task->lock);
+   task->notifyValue++;
+   pthread_cond_signal(&task->cond);
+   pthread_mutex_unlock(&task->lock);
+   return pdPASS;
+}
+
+void vTaskSetTimeOutState(TimeOut_t *timeOut)
+{
+   timeOut->start = xTaskGetTickCount();
+}
+
+BaseType_t xTaskCheckForTimeOut(TimeOut_t *timeOut, TickType_t *ticksToWait)
+{
+   if (*ticksToWait == portMAX_DELAY)
+      return pdFALSE;
+
+   TickType_t now = xTaskGetTickCount();
+   TickType_t elapsed = now - timeOut->start;
+   if (elapsed >= *ticksToWait)
+   {
+      *ticksToWait = 0;
+      return pdTRUE;
+   }
+
+   *ticksToWait -= elapsed;
+   timeOut->start = now;
+   return pdFALSE;
+}
+
+// ********************************************************************************************
+// semaphores
+
+struct _HostSemaphore
+{
+   pthread_mutex_t lock;
+   pthread_cond_t cond;
+   UBaseType_t count;
+   UBaseType_t maxCount;
+};
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t maxCount, UBaseType_t initialCount)
+{
+   struct _HostSemaphore *semaphore = calloc(1, sizeof(struct _HostSemaphore));
+   pthread_mutex_init(&semaphore->lock, NULL);
+   pthread_cond_init(&semaphore->cond, NULL);
+   semaphore->count = initialCount;
+   semaphore->maxCount = maxCount;
+   return semaphore;
+}
+
+// (priority inheritance doesn't matter for the benchmark)
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+   return xSemaphoreCreateCounting(1, 1);
+}
+
+static bool available(void *arg)
+{
+   return ((struct _HostSemaphore*) arg)->count > 0;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticksToWait)
+{
+   pthread_mutex_lock(&semaphore->lock);
+   bool taken = waitUntil(&semaphore->cond,
+      &semaphore->lock, ticksToWait, available, semaphore);
+   if (taken) semaphore->count--;
+   pthread_mutex_unlock(&semaphore->lock);
+
+   return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+   pthread_mutex_lock(&semaphore->lock);
+   bool given = semaphore->count < semaphore->maxCount;
+   if (given)
+   {
+      semaphore->count++;
+      pthread_cond_signal(&semaphore->cond);
+   }
+   pthread_mutex_unlock(&semaphore->lock);
+
+   return given ? pdTRUE : pdFALSE;
+}
+
+// ********************************************************************************************
+// queues
+
+struct _HostQueue
+{
+   pthread_mutex_t lock;
+   pthread_cond_t cond;
+   UBaseType_t length;
+   UBaseType_t itemSize;
+   UBaseType_t head;
+   UBaseType_t count;
+   uint8_t *items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+   struct _HostQueue *queue = calloc(1, sizeof(struct _HostQueue));
+   pthread_mutex_init(&queue->lock, NULL);
+   pthread_cond_init(&queue->cond, NULL);
+   queue->length = length;
+   queue->itemSize = itemSize;
+   queue->items = calloc(length, itemSize);
+   return queue;
+}
+
+static bool queueNotEmpty(void *arg)
+{
+   return ((struct _HostQueue*) arg)->count > 0;
+}
+
+static bool queueNotFull(void *arg)
+{
+   struct _HostQueue *queue = arg;
+   return queue->count < queue->length;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticksToWait)
+{
+   pthread_mutex_lock(&queue->lock);
+   bool sent = waitUntil(&queue->cond,
+      &queue->lock, ticksToWait, queueNotFull, queue);
+   if (sent)
+   {
+      UBaseType_t tail = (queue->head + queue->count) % queue->length;
+      memcpy(queue->items + tail * queue->itemSize, item, queue->itemSize);
+      queue->count++;
+      pthread_cond_broadcast(&queue->cond);
+   }
+   pthread_mutex_unlock(&queue->lock);
+
+   return sent ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticksToWait)
+{
+   pthread_mutex_lock(&queue->lock);
+   bool received = waitUntil(&queue->cond,
+      &queue->lock, ticksToWait, queueNotEmpty, queue);
+   if (received)
+   {
+      memcpy(item, queue->items + queue->head * queue->itemSize, queue->itemSize);
+      queue->head = (queue->head + 1) % queue->length;
+      queue->count--;
+      pthread_cond_broadcast(&queue->cond);
+   }
+   pthread_mutex_unlock(&queue->lock);
+
+   return received ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue)
+{
+   pthread_mutex_lock(&queue->lock);
+   queue->head = queue->count = 0;
+   pthread_cond_broadcast(&queue->cond);
+   pthread_mutex_unlock(&queue->lock);
+   return pdPASS;
+}
+
+// ********************************************************************************************
+// uart driver
+
+/**
+ * a reader thread moves the bytes from the tty into rxBuffer and
+ * posts UART_DATA events, like the idf driver does from its isr
+ */
+static const char *devicePath = NULL;
+static int deviceFd = -1;
+static uint32_t baudRate = 115200;
+static QueueHandle_t eventQueue;
+
+static pthread_mutex_t rxLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rxCond = PTHREAD_COND_INITIALIZER;
+static uint8_t rxBuffer[HOST_UART_RX_SIZE];
+static size_t rxHead = 0, rxCount = 0;
+
+void hostUartSetDevice(const char *path) { devicePath = path; }
+
+static void* uartReaderThread(void *arg)
+{
+   uint8_t tmp[1024];
+   struct pollfd pfd = {deviceFd, POLLIN, 0};
+
+   while (1)
+   {
+      if (poll(&pfd, 1, 100) <= 0) continue;
+
+      ssize_t n = read(deviceFd, tmp, sizeof(tmp));
+      if (n <= 0) {
+         if (n < 0 && errno == EAGAIN) continue;
+         ESP_LOGE(LOG_TAG, "uart device closed");
+         return NULL;
+      }
+
+      pthread_mutex_lock(&rxLock);
+      size_t space = HOST_UART_RX_SIZE - rxCount;
+      bool overflow = (size_t) n > space;
+      if (overflow) n = space;
+      for (ssize_t i = 0; i < n; i++)
+         rxBuffer[(rxHead + rxCount + i) % HOST_UART_RX_SIZE] = tmp[i];
+      rxCount += n;
+      pthread_cond_broadcast(&rxCond);
+      pthread_mutex_unlock(&rxLock);
+
+      uart_event_t event = {overflow ? UART_BUFFER_FULL : UART_DATA, n, false};
+      xQueueSend(eventQueue, &event, 0);
+   }
+}
+
+int uart_driver_install(uart_port_t port, int rxBufferSize, int txBufferSize,
+   int queueSize, QueueHandle_t *queue, int intrAllocFlags)
+{
+   if (devicePath == NULL) {
+      ESP_LOGE(LOG_TAG, "no uart device, call hostUartSetDevice first");
+      exit(1);
+   }
+
+   deviceFd = open(devicePath, O_RDWR | O_NOCTTY);
+   if (deviceFd < 0) {
+      ESP_LOGE(LOG_TAG, "couldn't open %s", devicePath);
+      exit(1);
+   }
+
+   struct termios tio;
+   tcgetattr(deviceFd, &tio);
+   cfmakeraw(&tio);
+   tcsetattr(deviceFd, TCSANOW, &tio);
+
+   // events are dropped when nobody reads them, the data is kept
+   eventQueue = xQueueCreate(queueSize * 16, sizeof(uart_event_t));
+   *queue = eventQueue;
+
+   pthread_t thread;
+   pthread_create(&thread, NULL, uartReaderThread, NULL);
+   pthread_detach(thread);
+   return 0;
+}
+
+int uart_param_config(uart_port_t port, const uart_config_t *config)
+{
+   baudRate = config->baud_rate;
+   return 0;
+}
+
+int uart_set_pin(uart_port_t port, int tx, int rx, int rts, int cts) { return 0; }
+int uart_set_mode(uart_port_t port, uart_mode_t mode) { return 0; }
+int uart_pattern_queue_reset(uart_port_t port, int queueLength) { return 0; }
+int uart_pattern_pop_pos(uart_port_t port) { return -1; }
+
+static bool rxReady(void *arg)
+{
+   return rxCount >= *(uint32_t*) arg;
+}
+
+int uart_read_bytes(uart_port_t port, void *buf, uint32_t length, TickType_t ticksToWait)
+{
+   pthread_mutex_lock(&rxLock);
+   waitUntil(&rxCond, &rxLock, ticksToWait, rxReady, &length);
+
+   uint32_t n = rxCount < length ? rxCount : length;
+   for (uint32_t i = 0; i < n; i++)
+      ((uint8_t*) buf)[i] = rxBuffer[(rxHead + i) % HOST_UART_RX_SIZE];
+   rxHead = (rxHead + n) % HOST_UART_RX_SIZE;
+   rxCount -= n;
+   pthread_mutex_unlock(&rxLock);
+
+   return n;
+}
+
+int uart_write_bytes(uart_port_t port, const void *src, size_t size)
+{
+   const uint8_t *data = src;
+   size_t written = 0;
+   while (written < size)
+   {
+      ssize_t n = write(deviceFd, data + written, size - written);
+      if (n < 0) {
+         if (errno == EAGAIN || errno == EINTR) continue;
+         return -1;
+      }
+      written += n;
+   }
+   return written;
+}
+
+int uart_flush_input(uart_port_t port)
+{
+   pthread_mutex_lock(&rxLock);
+   rxHead = rxCount = 0;
+   pthread_mutex_unlock(&rxLock);
+   return 0;
+}
+
+int uart_get_buffered_data_len(uart_port_t port, size_t *size)
+{
+   pthread_mutex_lock(&rxLock);
+   *size = rxCount;
+   pthread_mutex_unlock(&rxLock);
+   return 0;
+}
+
+int uart_get_baudrate(uart_port_t port, uint32_t *baudrate)
+{
+   *baudrate = baudRate;
+   return 0;
+}
+
+int uart_set_baudrate(uart_port_t port, uint32_t baudrate)
+{
+   baudRate = baudrate;
+   return 0;
+}
+
+// writes go straight to the device
+int uart_wait_tx_done(uart_port_t port, TickType_t ticksToWait) { return 0; }
+
+// ********************************************************************************************
+// rom functions
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t *buf, uint32_t len)
+{
+   static uint32_t table[256];
+   if (table[1] == 0)
+   {
+      for (uint32_t n = 0; n < 256; n++)
+      {
+         uint32_t c = n;
+         for (int k = 0; k < 8; k++)
+            c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+         table[n] = c;
+      }
+   }
+
+   crc = ~crc;
+   while (len--)
+      crc = table[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+   return ~crc;
+}
@@ -0,0 +1,317 @@
+/**
+ * drives the esp32 uart protocol code (uartHelper.c + uartBroker.c)
+ * on a linux host against k210/k210Emulator.py and reports
+ * throughput, per-command latency percentiles and recovery time.
+ * 
+ * usage: uartBench <tty> [pings] [ai reads] [frames] [codec]
+ *    codec: raw (default) or rle
+ * 
+ * see build.sh for the build and README.md for a complete run
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "os_port.h"
+#include "cpu_endian.h"
+#include "driver/uart.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "source/serial/uartHelper.h"
+#include "source/serial/uartBroker.h"
+
+// envTypes.h drags in the network stack, build.sh takes the
+// digit limit from there instead
+#ifndef MAX_DIGIT_COUNT
+#error "MAX_DIGIT_COUNT must come from envTypes.h (see build.sh)"
+#endif
+
+#define MAX_SAMPLES 4096
+
+typedef struct _Stats Stats;
+
+// latencies (microseconds) of one kind of command
+struct _Stats
+{
+   const char *name;
+   int64_t samples[MAX_SAMPLES];
+   uint_t count;
+   uint_t failures;
+};
+
+// time from a failed command to the next successful one
+static int64_t failedAt = -1;
+static Stats recovery = {"recovery"};
+
+// ********************************************************************************************
+// forward declaration of functions
+
+static void statsAdd(Stats *stats, int64_t value);
+static void statsReport(const Stats *stats);
+static bool_t benchExecute(Stats *stats, UartRequest *request);
+static void benchPing(uint_t count);
+static void benchAiRead(uint_t count);
+static void benchFrames(uint_t count, uint8_t codec);
+
+// ********************************************************************************************
+
+int main(int argc, char **argv)
+{
+   if (argc < 2) {
+      fprintf(stderr, "usage: %s <tty> [pings] [ai reads] [frames] [raw|rle]\n", argv[0]);
+      return 1;
+   }
+
+   uint_t pings = argc > 2 ? atoi(argv[2]) : 200;
+   uint_t reads = argc > 3 ? atoi(argv[3]) : 20;
+   uint_t frames = argc > 4 ? atoi(argv[4]) : 5;
+   uint8_t codec = argc > 5 && !strcmp(argv[5], "rle") ?
+      K210_CODEC_RLE : K210_CODEC_RAW;
+
+   if (getenv("UART_BENCH_VERBOSE")) hostLogLevel = 1;
+
+   hostUartSetDevice(argv[1]);
+   serialInit();
+   uartBrokerInit();
+
+   benchPing(pings);
+   benchAiRead(reads);
+   benchFrames(frames, codec);
+   statsReport(&recovery);
+   return 0;
+}
+
+// ********************************************************************************************
+
+static void statsAdd(Stats *stats, int64_t value)
+{
+   if (stats->count < MAX_SAMPLES)
+      stats->samples[stats->count++] = value;
+}
+
+static int compareSamples(const void *a, const void *b)
+{
+   int64_t x = *(const int64_t*) a, y = *(const int64_t*) b;
+   return (x > y) - (x < y);
+}
+
+static int64_t percentile(const Stats *stats, uint_t p)
+{
+   return stats->samples[(stats->count - 1) * p / 100];
+}
+
+static void statsReport(const Stats *stats)
+{
+   if (stats->count == 0) {
+      printf("%-10s no samples, %u failed\n", stats->name, stats->failures);
+      return;
+   }
+
+   Stats sorted = *stats;
+   qsort(sorted.samples, sorted.count, sizeof(int64_t), compareSamples);
+
+   printf("%-10s n=%-5u failed=%-4u p50 %7.2f ms  p90 %7.2f ms  "
+      "p99 %7.2f ms  max %7.2f ms\n", stats->name, sorted.count,
+      sorted.failures, percentile(&sorted, 50) / 1000.0,
+      percentile(&sorted, 90) / 1000.0, percentile(&sorted, 99) / 1000.0,
+      sorted.samples[sorted.count - 1] / 1000.0);
+}
+
+// ********************************************************************************************
+
+// runs a request through the broker and records its latency
+static bool_t benchExecute(Stats *stats, UartRequest *request)
+{
+   int64_t start = esp_timer_get_time();
+   bool_t ok = uartBrokerExecute(request);
+   int64_t now = esp_timer_get_time();
+
+   if (!ok)
+   {
+      stats->failures++;
+      if (failedAt < 0) failedAt = start;
+      return FALSE;
+   }
+
+   statsAdd(stats, now - start);
+   if (failedAt >= 0)
+   {
+      statsAdd(&recovery, now - failedAt);
+      failedAt = -1;
+   }
+   return TRUE;
+}
+
+// ********************************************************************************************
+
+static void benchPing(uint_t count)
+{
+   static Stats stats = {"ping"};
+   uint8_t payload[16], response[16];
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      memset(payload, i, sizeof(payload));
+
+      UartRequest request;
+      uartRequestInit(&request, K210_CMD_PING,
+         payload, sizeof(payload), response, sizeof(response));
+      request.retries = 0;
+
+      if (benchExecute(&stats, &request) &&
+         memcmp(payload, response, sizeof(payload)))
+         printf("ping %u: echo mismatch\n", i);
+   }
+
+   statsReport(&stats);
+}
+
+// ********************************************************************************************
+
+/**
+ * "ai read" asks for an inference and then for its result,
+ * "ai latest" only fetches the result of the continuous loop
+ */
+static void benchAiRead(uint_t count)
+{
+   static Stats stats = {"ai read"};
+   static Stats latestStats = {"ai latest"};
+
+   // a 5 digit layout so that the emulator knows what to send
+   uint8_t config[2 + 5*8] = {5, 0};
+   for (uint_t i = 0; i < 5; i++)
+   {
+      STORE16LE(40 + i*48, config + 2 + i*8);
+      STORE16LE(100, config + 4 + i*8);
+      STORE16LE(40, config + 6 + i*8);
+      STORE16LE(60, config + 8 + i*8);
+   }
+
+   UartRequest request;
+   uartRequestInit(&request, K210_CMD_CONFIG, config, sizeof(config), NULL, 0);
+   if (!uartBrokerExecute(&request)) {
+      printf("config rejected, skipping ai reads\n");
+      return;
+   }
+
+   for (uint_t i = 0; i < count; i++)
+   {
+      int64_t start = esp_timer_get_time();
+
+      uartRequestInit(&request, K210_CMD_AI_READ, NULL, 0, NULL, 0);
+      request.waitTimeMS = 400;
+      if (!uartBrokerExecute(&request)) {
+         stats.failures++;
+         continue;
+      }
+
+      // header, then one digit and one probability per window
+      uint8_t result[K210_AI_RESULT_HEADER_SIZE + 2 * MAX_DIGIT_COUNT];
+      uartRequestInit(&request, K210_CMD_AI_SEND, NULL, 0, result, sizeof(result));
+      request.waitTimeMS = 300;
+      request.retries = 2;
+      if (!uartBrokerExecute(&request)) {
+         stats.failures++;
+         continue;
+      }
+
+      statsAdd(&stats, esp_timer_get_time() - start);
+   }
+
+   uint32_t lastFrame = 0;
+   for (uint_t i = 0; i < count; i++)
+   {
+      int64_t start = esp_timer_get_time();
+
+      // header, then one digit and one probability per window
+      uint8_t result[K210_AI_RESULT_HEADER_SIZE + 2 * MAX_DIGIT_COUNT];
+      uartRequestInit(&request, K210_CMD_AI_SEND, NULL, 0, result, sizeof(result));
+      request.waitTimeMS = 300;
+      request.retries = 2;
+      if (!uartBrokerExecute(&request) ||
+         request.responseLength < K210_AI_RESULT_HEADER_SIZE) {
+         latestStats.failures++;
+         continue;
+      }
+
+      statsAdd(&latestStats, esp_timer_get_time() - start);
+
+      uint32_t frame = LOAD32LE(result);
+      if (frame == lastFrame)
+         printf("ai latest %u: frame %u didn't move on\n", i, frame);
+      lastFrame = frame;
+
+      // let the continuous loop finish another inference
+      vTaskDelay(pdMS_TO_TICKS(200));
+   }
+
+   statsReport(&stats);
+   statsReport(&latestStats);
+}
+
+// ********************************************************************************************
+
+/**
+ * captures and fetches whole frames chunk by chunk like camera.c
+ * (there is no socket here for the pipeline to overlap with)
+ */
+static void benchFrames(uint_t count, uint8_t codec)
+{
+   static Stats captureStats = {"capture"};
+   static Stats chunkStats = {"chunk"};
+
+   static uint8_t buffer[4 + K210_CAM_CHUNK_SIZE];
+   size_t totalBytes = 0;
+   int64_t totalTime = 0;
+
+   for (uint_t frame = 0; frame < count; frame++)
+   {
+      uint8_t args[2] = {codec, 70}, info[9];
+      UartRequest request;
+      uartRequestInit(&request, K210_CMD_CAM_CAPTURE,
+         args, sizeof(args), info, sizeof(info));
+      request.waitTimeMS = 1000;
+
+      if (!benchExecute(&captureStats, &request) ||
+         request.responseLength != sizeof(info))
+         continue;
+
+      size_t size = LOAD32LE(info + 4);
+      int64_t start = esp_timer_get_time();
+
+      size_t offset = 0;
+      while (offset < size)
+      {
+         size_t chunk = size - offset < K210_CAM_CHUNK_SIZE ?
+            size - offset : K210_CAM_CHUNK_SIZE;
+
+         uint8_t chunkArgs[6];
+         STORE32LE(offset, chunkArgs);
+         STORE16LE(chunk, chunkArgs + 4);
+
+         uartRequestInit(&request, K210_CMD_CAM_CHUNK,
+            chunkArgs, sizeof(chunkArgs), buffer, sizeof(buffer));
+         request.waitTimeMS = 500;
+         request.retries = 0;
+
+         // chunks are requested again until they arrive intact
+         if (!benchExecute(&chunkStats, &request)) continue;
+         if (request.responseLength != chunk + 4 || LOAD32LE(buffer) != offset) {
+            chunkStats.failures++;
+            continue;
+         }
+         offset += chunk;
+      }
+
+      totalTime += esp_timer_get_time() - start;
+      totalBytes += size;
+   }
+
+   statsReport(&captureStats);
+   statsReport(&chunkStats);
+
+   if (totalTime > 0)
+      printf("%-10s %u bytes in %.1f ms, %.1f KB/s at %u baud\n", "frames",
+         (uint_t) totalBytes, totalTime / 1000.0,
+         totalBytes * 1000.0 / totalTime, uartGetBaudRate());
+}
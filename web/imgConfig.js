@@ -2,54 +2,115 @@ let errorBox = element.querySelector('.error-massage');
 let instructionBox = document.getElementById("instruction")
 let imageElement = document.getElementById('camera-img');
 
-// rbgData - 3 bytes per pixel - alpha-channel data not used (or valid)
-function createImageFromData(data, width, height)
+// parses a binary pgm image ("P5\n<width> <height>\n<maxval>\n" + pixels)
+function parsePgm(buffer)
+{
+    let bytes = new Uint8Array(buffer);
+    let fields = [], pos = 0;
+    while (fields.length < 4 && pos < bytes.length) {
+        let start = pos;
+        while (pos < bytes.length && bytes[pos] > 32) pos++;
+        fields.push(String.fromCharCode(...bytes.subarray(start, pos)));
+        pos++; // single whitespace after each field
+    }
+    if (fields[0] !== "P5")
+        throw new Error("unexpected camera image format");
+
+    let width = parseInt(fields[1]), height = parseInt(fields[2]);
+    return {width: width, height: height,
+        pixels: bytes.subarray(pos, pos + width*height)};
+}
+
+// parses a 4-bit preview (u16 LE width and height + two pixels per byte)
+function parseGray4(buffer)
+{
+    let view = new DataView(buffer);
+    let width = view.getUint16(0, true), height = view.getUint16(2, true);
+    let packed = new Uint8Array(buffer, 4);
+    let rowBytes = (width + 1) >> 1;
+
+    let pixels = new Uint8Array(width*height);
+    for (let y = 0; y < height; y++) {
+        for (let x = 0; x < width; x++) {
+            let b = packed[y*rowBytes + (x >> 1)];
+            pixels[y*width + x] = ((x & 1) ? b & 0x0F : b >> 4) * 17;
+        }
+    }
+    return {width: width, height: height, pixels: pixels};
+}
+
+// paints 8-bit grayscale pixels through a 32-bit view of the image data
+function createImageFromData(pixels, width, height)
 {
     let mCanvas = document.createElement('canvas');
     mCanvas.width = width;
     mCanvas.height = height;
 
-    let mContext = mCanvas.getContext('2d');
-    let mImgData = mContext.createImageData(width, height);
+    let rgba = new Uint32Array(width*height);
+    for (let pix = 0; pix < rgba.length; pix++)
+        rgba[pix] = 0xFF000000 | pixels[pix] * 0x010101;
 
-    let srcIndex = 0, dstIndex = 0;
-    for (let pix = 0; pix < width*height;  pix++)
-    {
-        let value = (data[srcIndex] - 48)*16 + (data[srcIndex+1] - 48);
-        mImgData.data[dstIndex] = value;
-        mImgData.data[dstIndex+1] = value;
-        mImgData.data[dstIndex+2] = value;
-        mImgData.data[dstIndex+3] = 255;
-        srcIndex += 2;
-        dstIndex += 4;
-    }
-    mContext.putImageData(mImgData, 0, 0);
+    let mImgData = new ImageData(
+        new Uint8ClampedArray(rgba.buffer), width, height);
+    mCanvas.getContext('2d').putImageData(mImgData, 0, 0);
     return mCanvas;
 }
 
+function fetchCameraImage()
+{
+    return fetch('/camera?format=pgm', {method: 'GET'})
+    .then((response) => {
+        if (!response.ok)
+            throw new Error("camera is not available!");
+        return response.arrayBuffer();
+    })
+    .then((buffer) => {
+        console.log("Array size:", buffer.byteLength);
+        let img = parsePgm(buffer);
+        return createImageFromData(img.pixels, img.width, img.height);
+    });
+}
+
+// a 160x120 4-bit thumbnail, about a tenth of the full frame
+function fetchCameraPreview()
+{
+    return fetch('/camera?scale=2&bpp=4', {method: 'GET'})
+    .then((response) => {
+        if (!response.ok)
+            throw new Error("camera is not available!");
+        return response.arrayBuffer();
+    })
+    .then((buffer) => {
+        let img = parseGray4(buffer);
+        return createImageFromData(img.pixels, img.width, img.height);
+    });
+}
+
+/**
+ * the preview is shown (stretched) while the full frame loads.
+ * captures are serialized on the device anyway, so the full frame
+ * is only requested once the preview is in.
+ */
 function loadCameraImag()
 {
-    fetch('/camera', {
-        method: 'GET',
+    let previewShown = false;
+
+    fetchCameraPreview()
+    .then((mCanvas) => {
+        imageElement.src = mCanvas.toDataURL();
+        previewShown = true;
     })
-    .then((response) => response.blob())
-    .then((blob) => {
-        console.log(blob);
-        let fileReader = new FileReader();
-        fileReader.onload = function(event) {
-            console.log("Array size:", fileReader.result.byteLength)
-            let mCanvas = createImageFromData(
-                new Uint8Array(fileReader.result), 320, 240);
-            // make a base64 string of the image data (the array above)
-            imageElement.src = mCanvas.toDataURL();
-        };
-        fileReader.readAsArrayBuffer(blob);
+    .catch((error) => console.log("no preview:", error.message))
+    .then(() => fetchCameraImage())
+    .then((mCanvas) => {
+        // make a base64 string of the image data (the canvas above)
+        imageElement.src = mCanvas.toDataURL();
     })
     .catch((error) => {
         errorBox.style.color = "red";
         errorBox.textContent = error.message;
         errorBox.style.display = "block";
-        imageElement.src = "assets/cam-icon.svg"
+        if (!previewShown) imageElement.src = "assets/cam-icon.svg"
     });
 }
 
@@ -1,42 +1,60 @@
 let resultBox = document.getElementById('result');
 let imageElement = document.getElementById('camera-img');
 
-function createImageFromData(data, width, height)
+// parses a binary pgm image ("P5\n<width> <height>\n<maxval>\n" + pixels)
+function parsePgm(buffer)
+{
+    let bytes = new Uint8Array(buffer);
+    let fields = [], pos = 0;
+    while (fields.length < 4 && pos < bytes.length) {
+        let start = pos;
+        while (pos < bytes.length && bytes[pos] > 32) pos++;
+        fields.push(String.fromCharCode(...bytes.subarray(start, pos)));
+        pos++; // single whitespace after each field
+    }
+    if (fields[0] !== "P5")
+        throw new Error("unexpected camera image format");
+
+    let width = parseInt(fields[1]), height = parseInt(fields[2]);
+    return {width: width, height: height,
+        pixels: bytes.subarray(pos, pos + width*height)};
+}
+
+// paints 8-bit grayscale pixels through a 32-bit view of the image data
+function createImageFromData(pixels, width, height)
 {
     let mCanvas = document.createElement('canvas');
     mCanvas.width = width;
     mCanvas.height = height;
 
-    let mContext = mCanvas.getContext('2d');
-    let mImgData = mContext.createImageData(width, height);
+    let rgba = new Uint32Array(width*height);
+    for (let pix = 0; pix < rgba.length; pix++)
+        rgba[pix] = 0xFF000000 | pixels[pix] * 0x010101;
 
-    let srcIndex = 0, dstIndex = 0;
-    for (let pix = 0; pix < width*height;  pix++)
-    {
-        let value = (data[srcIndex] - 48)*16 + (data[srcIndex+1] - 48);
-        mImgData.data[dstIndex] = value;
-        mImgData.data[dstIndex+1] = value;
-        mImgData.data[dstIndex+2] = value;
-        mImgData.data[dstIndex+3] = 255;
-        srcIndex += 2;
-        dstIndex += 4;
-    }
-    mContext.putImageData(mImgData, 0, 0);
+    let mImgData = new ImageData(
+        new Uint8ClampedArray(rgba.buffer), width, height);
+    mCanvas.getContext('2d').putImageData(mImgData, 0, 0);
     return mCanvas;
 }
 
-fetch('/camera', {method: 'GET'})
-.then((response) => response.blob())
-.then((blob) => {
-    console.log(blob);
-    let fileReader = new FileReader();
-    fileReader.onload = function(event) {
-        console.log("Array size:", fileReader.result.byteLength)
-        let mCanvas = createImageFromData(
-            new Uint8Array(fileReader.result), 320, 240);
-        imageElement.src = mCanvas.toDataURL();
-    };
-    fileReader.readAsArrayBuffer(blob);
+function fetchCameraImage()
+{
+    return fetch('/camera?format=pgm', {method: 'GET'})
+    .then((response) => {
+        if (!response.ok)
+            throw new Error("camera is not available!");
+        return response.arrayBuffer();
+    })
+    .then((buffer) => {
+        console.log("Array size:", buffer.byteLength);
+        let img = parsePgm(buffer);
+        return createImageFromData(img.pixels, img.width, img.height);
+    });
+}
+
+fetchCameraImage()
+.then((mCanvas) => {
+    imageElement.src = mCanvas.toDataURL();
 })
 .catch((error) => {
     resultBox.style.color = "#f06060";